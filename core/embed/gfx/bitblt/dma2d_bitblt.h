@@ -49,5 +49,6 @@ bool dma2d_rgba8888_copy_rgb565(const gfx_bitblt_t* bb);
 bool dma2d_rgba8888_copy_rgba8888(const gfx_bitblt_t* bb);
 bool dma2d_rgba8888_blend_mono4(const gfx_bitblt_t* bb);
 bool dma2d_rgba8888_blend_mono8(const gfx_bitblt_t* bb);
+bool dma2d_rgba8888_blend_rgba8888(const gfx_bitblt_t* bb);
 
 #endif  // TREZORHAL_DMA2D_BITBLT_H
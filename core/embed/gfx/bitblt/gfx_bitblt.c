@@ -17,7 +17,12 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <trezor_rtl.h>
+
 #include "dma2d_bitblt.h"
+#include "gfx_bitblt_stats.h"
+
+gfx_bitblt_stats_t g_gfx_bitblt_stats;
 
 void gfx_bitblt_init(void) {
 #if defined(USE_DMA2D) && !defined(TREZOR_EMULATOR)
@@ -36,3 +41,11 @@ void gfx_bitblt_wait(void) {
   dma2d_wait();
 #endif
 }
+
+void gfx_bitblt_get_stats(gfx_bitblt_stats_t* stats) {
+  *stats = g_gfx_bitblt_stats;
+}
+
+void gfx_bitblt_reset_stats(void) {
+  memset(&g_gfx_bitblt_stats, 0, sizeof(g_gfx_bitblt_stats));
+}
@@ -19,7 +19,10 @@
 
 #include <gfx/gfx_bitblt.h>
 
+#include "gfx_bitblt_stats.h"
+
 void gfx_mono8_fill(const gfx_bitblt_t* bb) {
+  gfx_bitblt_count_sw(bb);
   uint8_t* dst_ptr = (uint8_t*)bb->dst_row + bb->dst_x;
   uint16_t height = bb->height;
 
@@ -34,6 +37,7 @@ void gfx_mono8_fill(const gfx_bitblt_t* bb) {
 }
 
 void gfx_mono8_copy_mono1p(const gfx_bitblt_t* bb) {
+  gfx_bitblt_count_sw(bb);
   uint8_t* dst_ptr = (uint8_t*)bb->dst_row + bb->dst_x;
   uint8_t* src = (uint8_t*)bb->src_row;
   uint16_t src_ofs = bb->src_stride * bb->src_y + bb->src_x;
@@ -54,6 +58,7 @@ void gfx_mono8_copy_mono1p(const gfx_bitblt_t* bb) {
 }
 
 void gfx_mono8_copy_mono4(const gfx_bitblt_t* bb) {
+  gfx_bitblt_count_sw(bb);
   uint8_t* dst_ptr = (uint8_t*)bb->dst_row + bb->dst_x;
   uint8_t* src_row = (uint8_t*)bb->src_row;
   uint16_t height = bb->height;
@@ -73,6 +78,7 @@ void gfx_mono8_copy_mono4(const gfx_bitblt_t* bb) {
 }
 
 void gfx_mono8_blend_mono1p(const gfx_bitblt_t* bb) {
+  gfx_bitblt_count_sw(bb);
   uint8_t* dst_ptr = (uint8_t*)bb->dst_row + bb->dst_x;
   uint8_t* src = (uint8_t*)bb->src_row;
   uint16_t src_ofs = bb->src_stride * bb->src_y + bb->src_x;
@@ -92,6 +98,7 @@ void gfx_mono8_blend_mono1p(const gfx_bitblt_t* bb) {
 }
 
 void gfx_mono8_blend_mono4(const gfx_bitblt_t* bb) {
+  gfx_bitblt_count_sw(bb);
   uint8_t* dst_ptr = (uint8_t*)bb->dst_row + bb->dst_x;
   uint8_t* src_row = (uint8_t*)bb->src_row;
   uint16_t height = bb->height;
@@ -17,17 +17,21 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <trezor_rtl.h>
+
 #include <gfx/gfx_bitblt.h>
 
 #if USE_DMA2D
 #include "dma2d_bitblt.h"
 #endif
+#include "gfx_bitblt_stats.h"
 
 void gfx_rgb565_fill(const gfx_bitblt_t* bb) {
 #if defined(USE_DMA2D) && !defined(TREZOR_EMULATOR)
   if (!dma2d_rgb565_fill(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint16_t* dst_ptr = (uint16_t*)bb->dst_row + bb->dst_x;
     uint16_t height = bb->height;
 
@@ -51,6 +55,7 @@ void gfx_rgb565_fill(const gfx_bitblt_t* bb) {
 }
 
 void gfx_rgb565_copy_mono1p(const gfx_bitblt_t* bb) {
+  gfx_bitblt_count_sw(bb);
   uint16_t* dst_ptr = (uint16_t*)bb->dst_row + bb->dst_x;
   uint8_t* src = (uint8_t*)bb->src_row;
   uint16_t src_ofs = bb->src_stride * bb->src_y + bb->src_x;
@@ -75,6 +80,7 @@ void gfx_rgb565_copy_mono4(const gfx_bitblt_t* bb) {
   if (!dma2d_rgb565_copy_mono4(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     const gfx_color16_t* gradient =
         gfx_color16_gradient_a4(bb->src_fg, bb->src_bg);
 
@@ -99,14 +105,13 @@ void gfx_rgb565_copy_rgb565(const gfx_bitblt_t* bb) {
   if (!dma2d_rgb565_copy_rgb565(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint16_t* dst_ptr = (uint16_t*)bb->dst_row + bb->dst_x;
     uint16_t* src_ptr = (uint16_t*)bb->src_row + bb->src_x;
     uint16_t height = bb->height;
 
     while (height-- > 0) {
-      for (int x = 0; x < bb->width; x++) {
-        dst_ptr[x] = src_ptr[x];
-      }
+      memcpy(dst_ptr, src_ptr, bb->width * sizeof(*dst_ptr));
       dst_ptr += bb->dst_stride / sizeof(*dst_ptr);
       src_ptr += bb->src_stride / sizeof(*src_ptr);
     }
@@ -118,17 +123,26 @@ void gfx_rgb565_blend_mono4(const gfx_bitblt_t* bb) {
   if (!dma2d_rgb565_blend_mono4(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint16_t* dst_ptr = (uint16_t*)bb->dst_row + bb->dst_x;
     uint8_t* src_row = (uint8_t*)bb->src_row;
     uint16_t height = bb->height;
 
+    uint16_t fg = gfx_color_to_color16(bb->src_fg);
+
     while (height-- > 0) {
       for (int x = 0; x < bb->width; x++) {
         uint8_t fg_data = src_row[(x + bb->src_x) / 2];
         uint8_t fg_alpha = (x + bb->src_x) & 1 ? fg_data >> 4 : fg_data & 0x0F;
         fg_alpha = fg_alpha * bb->src_alpha / 15;
-        dst_ptr[x] = gfx_color16_blend_a8(
-            bb->src_fg, gfx_color16_to_color(dst_ptr[x]), fg_alpha);
+        // most pixels of glyphs and icons are either empty or opaque, the
+        // blend returns the colors unchanged for them
+        if (fg_alpha == 255) {
+          dst_ptr[x] = fg;
+        } else if (fg_alpha != 0) {
+          dst_ptr[x] = gfx_color16_blend_a8(
+              bb->src_fg, gfx_color16_to_color(dst_ptr[x]), fg_alpha);
+        }
       }
       dst_ptr += bb->dst_stride / sizeof(*dst_ptr);
       src_row += bb->src_stride / sizeof(*src_row);
@@ -141,15 +155,23 @@ void gfx_rgb565_blend_mono8(const gfx_bitblt_t* bb) {
   if (!dma2d_rgb565_blend_mono8(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint16_t* dst_ptr = (uint16_t*)bb->dst_row + bb->dst_x;
     uint8_t* src_ptr = (uint8_t*)bb->src_row + bb->src_x;
     uint16_t height = bb->height;
 
+    uint16_t fg = gfx_color_to_color16(bb->src_fg);
+
     while (height-- > 0) {
       for (int x = 0; x < bb->width; x++) {
         uint8_t fg_alpha = src_ptr[x];
-        dst_ptr[x] = gfx_color16_blend_a8(
-            bb->src_fg, gfx_color16_to_color(dst_ptr[x]), fg_alpha);
+        // see gfx_rgb565_blend_mono4()
+        if (fg_alpha == 255) {
+          dst_ptr[x] = fg;
+        } else if (fg_alpha != 0) {
+          dst_ptr[x] = gfx_color16_blend_a8(
+              bb->src_fg, gfx_color16_to_color(dst_ptr[x]), fg_alpha);
+        }
       }
       dst_ptr += bb->dst_stride / sizeof(*dst_ptr);
       src_ptr += bb->src_stride / sizeof(*src_ptr);
@@ -17,17 +17,21 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <trezor_rtl.h>
+
 #include <gfx/gfx_bitblt.h>
 
 #if USE_DMA2D
 #include "dma2d_bitblt.h"
 #endif
+#include "gfx_bitblt_stats.h"
 
 void gfx_rgba8888_fill(const gfx_bitblt_t* bb) {
 #if defined(USE_DMA2D) && !defined(TREZOR_EMULATOR)
   if (!dma2d_rgba8888_fill(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint32_t* dst_ptr = (uint32_t*)bb->dst_row + bb->dst_x;
     uint16_t height = bb->height;
 
@@ -52,6 +56,7 @@ void gfx_rgba8888_fill(const gfx_bitblt_t* bb) {
 }
 
 void gfx_rgba8888_copy_mono1p(const gfx_bitblt_t* bb) {
+  gfx_bitblt_count_sw(bb);
   uint32_t* dst_ptr = (uint32_t*)bb->dst_row + bb->dst_x;
   uint8_t* src = (uint8_t*)bb->src_row;
   uint16_t src_ofs = bb->src_stride * bb->src_y + bb->src_x;
@@ -76,6 +81,7 @@ void gfx_rgba8888_copy_mono4(const gfx_bitblt_t* bb) {
   if (!dma2d_rgba8888_copy_mono4(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     const gfx_color32_t* gradient =
         gfx_color32_gradient_a4(bb->src_fg, bb->src_bg);
 
@@ -100,6 +106,7 @@ void gfx_rgba8888_copy_rgb565(const gfx_bitblt_t* bb) {
   if (!dma2d_rgba8888_copy_rgb565(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint32_t* dst_ptr = (uint32_t*)bb->dst_row + bb->dst_x;
     uint16_t* src_ptr = (uint16_t*)bb->src_row + bb->src_x;
     uint16_t height = bb->height;
@@ -119,14 +126,13 @@ void gfx_rgba8888_copy_rgba8888(const gfx_bitblt_t* bb) {
   if (!dma2d_rgba8888_copy_rgba8888(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint32_t* dst_ptr = (uint32_t*)bb->dst_row + bb->dst_x;
     uint32_t* src_ptr = (uint32_t*)bb->src_row + bb->src_x;
     uint16_t height = bb->height;
 
     while (height-- > 0) {
-      for (int x = 0; x < bb->width; x++) {
-        dst_ptr[x] = src_ptr[x];
-      }
+      memcpy(dst_ptr, src_ptr, bb->width * sizeof(*dst_ptr));
       dst_ptr += bb->dst_stride / sizeof(*dst_ptr);
       src_ptr += bb->src_stride / sizeof(*src_ptr);
     }
@@ -138,6 +144,7 @@ void gfx_rgba8888_blend_mono4(const gfx_bitblt_t* bb) {
   if (!dma2d_rgba8888_blend_mono4(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint32_t* dst_ptr = (uint32_t*)bb->dst_row + bb->dst_x;
     uint8_t* src_row = (uint8_t*)bb->src_row;
     uint16_t height = bb->height;
@@ -161,6 +168,7 @@ void gfx_rgba8888_blend_mono8(const gfx_bitblt_t* bb) {
   if (!dma2d_rgba8888_blend_mono8(bb))
 #endif
   {
+    gfx_bitblt_count_sw(bb);
     uint32_t* dst_ptr = (uint32_t*)bb->dst_row + bb->dst_x;
     uint8_t* src_ptr = (uint8_t*)bb->src_row + bb->src_x;
     uint16_t height = bb->height;
@@ -176,3 +184,29 @@ void gfx_rgba8888_blend_mono8(const gfx_bitblt_t* bb) {
     }
   }
 }
+
+void gfx_rgba8888_blend_rgba8888(const gfx_bitblt_t* bb) {
+#if defined(USE_DMA2D) && !defined(TREZOR_EMULATOR)
+  if (!dma2d_rgba8888_blend_rgba8888(bb))
+#endif
+  {
+    gfx_bitblt_count_sw(bb);
+    uint32_t* dst_ptr = (uint32_t*)bb->dst_row + bb->dst_x;
+    uint32_t* src_ptr = (uint32_t*)bb->src_row + bb->src_x;
+    uint16_t height = bb->height;
+
+    while (height-- > 0) {
+      for (int x = 0; x < bb->width; x++) {
+        uint32_t fg = src_ptr[x];
+        uint32_t bg = dst_ptr[x];
+        uint8_t fg_alpha = gfx_color32_to_a(fg) * bb->src_alpha / 255;
+        dst_ptr[x] = gfx_color32_rgb(
+            a8_lerp(gfx_color32_to_r(fg), gfx_color32_to_r(bg), fg_alpha),
+            a8_lerp(gfx_color32_to_g(fg), gfx_color32_to_g(bg), fg_alpha),
+            a8_lerp(gfx_color32_to_b(fg), gfx_color32_to_b(bg), fg_alpha));
+      }
+      dst_ptr += bb->dst_stride / sizeof(*dst_ptr);
+      src_ptr += bb->src_stride / sizeof(*src_ptr);
+    }
+  }
+}
@@ -0,0 +1,39 @@
+/*
+ * This file is part of the Trezor project, https://trezor.io/
+ *
+ * Copyright (c) SatoshiLabs
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GFX_BITBLT_STATS_H
+#define GFX_BITBLT_STATS_H
+
+#include <gfx/gfx_bitblt.h>
+
+extern gfx_bitblt_stats_t g_gfx_bitblt_stats;
+
+// Counts an operation done by the DMA2D
+static inline void gfx_bitblt_count_hw(const gfx_bitblt_t* bb) {
+  g_gfx_bitblt_stats.hw_ops++;
+  g_gfx_bitblt_stats.hw_pixels += (uint32_t)bb->width * bb->height;
+}
+
+// Counts an operation done by the CPU
+static inline void gfx_bitblt_count_sw(const gfx_bitblt_t* bb) {
+  g_gfx_bitblt_stats.sw_ops++;
+  g_gfx_bitblt_stats.sw_pixels += (uint32_t)bb->width * bb->height;
+}
+
+#endif  // GFX_BITBLT_STATS_H
@@ -23,6 +23,7 @@
 #include <gfx/gfx_color.h>
 
 #include "../dma2d_bitblt.h"
+#include "../gfx_bitblt_stats.h"
 
 static DMA2D_HandleTypeDef dma2d_handle = {
     .Instance = (DMA2D_TypeDef*)DMA2D_BASE,
@@ -108,6 +109,7 @@ bool dma2d_rgb565_fill(const gfx_bitblt_t* bb) {
 #endif
   }
 
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -229,6 +231,7 @@ bool dma2d_rgb565_copy_mono4(const gfx_bitblt_t* params) {
   HAL_DMA2D_Start(&dma2d_handle, (uint32_t)bb->src_row + bb->src_x / 2,
                   (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint16_t),
                   bb->width, bb->height);
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -256,6 +259,7 @@ bool dma2d_rgb565_copy_rgb565(const gfx_bitblt_t* bb) {
                   (uint32_t)bb->src_row + bb->src_x * sizeof(uint16_t),
                   (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint16_t),
                   bb->width, bb->height);
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -348,6 +352,7 @@ bool dma2d_rgb565_blend_mono4(const gfx_bitblt_t* params) {
         bb->height);
   }
 
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -382,6 +387,7 @@ bool dma2d_rgb565_blend_mono8(const gfx_bitblt_t* bb) {
                           (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint16_t),
                           bb->width, bb->height);
 
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -433,6 +439,7 @@ bool dma2d_rgba8888_fill(const gfx_bitblt_t* bb) {
     return false;
 #endif
   }
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -516,6 +523,7 @@ bool dma2d_rgba8888_copy_mono4(const gfx_bitblt_t* params) {
   HAL_DMA2D_Start(&dma2d_handle, (uint32_t)bb->src_row + bb->src_x / 2,
                   (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint32_t),
                   bb->width, bb->height);
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -543,6 +551,7 @@ bool dma2d_rgba8888_copy_rgb565(const gfx_bitblt_t* bb) {
                   (uint32_t)bb->src_row + bb->src_x * sizeof(uint16_t),
                   (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint32_t),
                   bb->width, bb->height);
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -635,6 +644,7 @@ bool dma2d_rgba8888_blend_mono4(const gfx_bitblt_t* params) {
         bb->height);
   }
 
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -669,6 +679,7 @@ bool dma2d_rgba8888_blend_mono8(const gfx_bitblt_t* bb) {
                           (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint32_t),
                           bb->width, bb->height);
 
+  gfx_bitblt_count_hw(bb);
   return true;
 }
 
@@ -696,5 +707,49 @@ bool dma2d_rgba8888_copy_rgba8888(const gfx_bitblt_t* bb) {
                   (uint32_t)bb->src_row + bb->src_x * sizeof(uint32_t),
                   (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint32_t),
                   bb->width, bb->height);
+  gfx_bitblt_count_hw(bb);
+  return true;
+}
+
+bool dma2d_rgba8888_blend_rgba8888(const gfx_bitblt_t* bb) {
+  dma2d_wait();
+
+  if (!dma2d_accessible(bb->dst_row) || !dma2d_accessible(bb->src_row)) {
+    return false;
+  }
+
+  dma2d_handle.Init.ColorMode = DMA2D_OUTPUT_ARGB8888;
+  dma2d_handle.Init.Mode = DMA2D_M2M_BLEND;
+  dma2d_handle.Init.OutputOffset =
+      bb->dst_stride / sizeof(uint32_t) - bb->width;
+  HAL_DMA2D_Init(&dma2d_handle);
+
+  dma2d_handle.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
+  dma2d_handle.LayerCfg[1].InputOffset =
+      bb->src_stride / sizeof(uint32_t) - bb->width;
+  if (bb->src_alpha == 255) {
+    dma2d_handle.LayerCfg[1].AlphaMode = 0;
+    dma2d_handle.LayerCfg[1].InputAlpha = 0;
+  } else {
+    // multiply the alpha channel of the source by src_alpha
+    dma2d_handle.LayerCfg[1].AlphaMode = DMA2D_COMBINE_ALPHA;
+    dma2d_handle.LayerCfg[1].InputAlpha = bb->src_alpha;
+  }
+  HAL_DMA2D_ConfigLayer(&dma2d_handle, 1);
+
+  dma2d_handle.LayerCfg[0].InputColorMode = DMA2D_INPUT_ARGB8888;
+  dma2d_handle.LayerCfg[0].InputOffset =
+      bb->dst_stride / sizeof(uint32_t) - bb->width;
+  dma2d_handle.LayerCfg[0].AlphaMode = 0;
+  dma2d_handle.LayerCfg[0].InputAlpha = 0;
+  HAL_DMA2D_ConfigLayer(&dma2d_handle, 0);
+
+  HAL_DMA2D_BlendingStart(
+      &dma2d_handle, (uint32_t)bb->src_row + bb->src_x * sizeof(uint32_t),
+      (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint32_t),
+      (uint32_t)bb->dst_row + bb->dst_x * sizeof(uint32_t), bb->width,
+      bb->height);
+
+  gfx_bitblt_count_hw(bb);
   return true;
 }
@@ -283,14 +283,22 @@ void gfx_draw_qrcode(gfx_offset_t offset, uint8_t scale, const char* data) {
   x += scale;
   y += scale;
 
-  // Draw black modules
-  for (int i = 0; i < side; i++) {
-    for (int j = 0; j < side; j++) {
-      if (qrcodegen_getModule(codedata, i, j)) {
-        gfx_rect_t rect =
-            gfx_rect_wh(x + i * scale, y + j * scale, scale, scale);
-        gfx_draw_bar(rect, COLOR_BLACK);
+  // Draw black modules, each horizontal run of them with a single bar
+  for (int j = 0; j < side; j++) {
+    int i = 0;
+    while (i < side) {
+      if (!qrcodegen_getModule(codedata, i, j)) {
+        i++;
+        continue;
       }
+      int run = 1;
+      while (i + run < side && qrcodegen_getModule(codedata, i + run, j)) {
+        run++;
+      }
+      gfx_rect_t rect =
+          gfx_rect_wh(x + i * scale, y + j * scale, run * scale, scale);
+      gfx_draw_bar(rect, COLOR_BLACK);
+      i += run;
     }
   }
 }
@@ -84,6 +84,24 @@ void gfx_bitblt_deinit(void);
 // If the bitblt operation is asynchronous, waits until it's finished
 void gfx_bitblt_wait(void);
 
+// Counters of the bitblt operations done since the last reset
+typedef struct {
+  // Operations done by the DMA2D
+  uint32_t hw_ops;
+  // Pixels written by the DMA2D
+  uint32_t hw_pixels;
+  // Operations done by the CPU
+  uint32_t sw_ops;
+  // Pixels written by the CPU
+  uint32_t sw_pixels;
+} gfx_bitblt_stats_t;
+
+// Gets the counters of the bitblt operations
+void gfx_bitblt_get_stats(gfx_bitblt_stats_t* stats);
+
+// Resets the counters of the bitblt operations
+void gfx_bitblt_reset_stats(void);
+
 // Functions for RGB565 bitmap/framebuffer
 
 // Fills a rectangle with a solid color
@@ -117,6 +135,9 @@ void gfx_rgba8888_blend_mono4(const gfx_bitblt_t* bb);
 // Blends a mono bitmap (with 8-bit alpha channel)
 // with the destination bitmap
 void gfx_rgba8888_blend_mono8(const gfx_bitblt_t* bb);
+// Blends an RGBA8888 bitmap (with its alpha channel scaled by `src_alpha`)
+// with the destination bitmap
+void gfx_rgba8888_blend_rgba8888(const gfx_bitblt_t* bb);
 
 // Functions for Mono8 bitmap/framebuffer
 void gfx_mono8_fill(const gfx_bitblt_t* bb);
@@ -291,7 +291,7 @@ static inline gfx_color16_t gfx_color16_blend_a8(gfx_color32_t fg,
 
   uint16_t fg_b = gfx_color32_to_b(fg);
   uint16_t bg_b = gfx_color32_to_b(bg);
-  uint16_t b = g = a8_lerp(fg_b, bg_b, alpha);
+  uint16_t b = a8_lerp(fg_b, bg_b, alpha);
 
   return gfx_color16_rgb(r, g, b);
 }
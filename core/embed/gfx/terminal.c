@@ -63,32 +63,58 @@ static uint64_t term_glyph_bits(char ch) {
   return result.u64;
 }
 
+// Size of one pixel line of a terminal row in bytes
+#define TERMINAL_ROW_STRIDE ((TERMINAL_COLS * 6 + 7) / 8)
+
 // Redraws specified rows to the display
+//
+// The glyphs of a row are first composed into a single 1bpp bitmap that is
+// then drawn to the display at once, instead of issuing a bitblt operation
+// for each character.
 static void term_redraw_rows(int start_row, int row_count) {
-  uint64_t glyph_bits = 0;
+  uint8_t row_bits[8][TERMINAL_ROW_STRIDE];
+
   gfx_bitblt_t bb = {
       .height = 8,
-      .width = 6,
+      .width = TERMINAL_COLS * 6,
       .dst_row = NULL,
       .dst_x = 0,
       .dst_y = 0,
       .dst_stride = 0,
 
-      .src_row = &glyph_bits,
+      .src_row = row_bits,
       .src_x = 0,
       .src_y = 0,
-      .src_stride = 8,
+      .src_stride = TERMINAL_ROW_STRIDE * 8,
       .src_fg = terminal_fgcolor,
       .src_bg = terminal_bgcolor,
   };
 
   for (int y = start_row; y < start_row + row_count; y++) {
-    bb.dst_y = y * 8;
+    memset(row_bits, 0, sizeof(row_bits));
     for (int x = 0; x < TERMINAL_COLS; x++) {
-      glyph_bits = term_glyph_bits(terminal_fb[y][x]);
-      bb.dst_x = x * 6;
-      display_copy_mono1p(&bb);
+      union {
+        uint64_t u64;
+        uint8_t bytes[8];
+      } glyph = {.u64 = term_glyph_bits(terminal_fb[y][x])};
+
+      if (glyph.u64 == 0) {
+        continue;
+      }
+
+      // Glyph pixels occupy the upper 6 bits of each byte
+      int bit = x * 6;
+      int shift = bit & 7;
+      for (int i = 0; i < 8; i++) {
+        uint16_t bits = (uint16_t)(glyph.bytes[i] & 0xFC) << (8 - shift);
+        row_bits[i][bit / 8] |= bits >> 8;
+        if (shift > 2) {
+          row_bits[i][bit / 8 + 1] |= bits & 0xFF;
+        }
+      }
     }
+    bb.dst_y = y * 8;
+    display_copy_mono1p(&bb);
   }
 }
 
@@ -197,6 +197,12 @@ int backlight_set(int val) {
   drv->current_level = val;
   int set_step = MAX_STEPS * val / 255;
 
+  if (set_step == drv->current_step) {
+    // The DAC is already at the requested step, the line idles high after
+    // the previous pulse train, so there is nothing to send
+    return drv->current_level;
+  }
+
   if (set_step == 0) {
     backlight_shutdown();
     drv->current_step = 0;
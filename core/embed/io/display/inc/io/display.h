@@ -135,6 +135,9 @@ void display_wait_for_sync(void);
 //
 // The function waits for vertical synchronization and
 // swaps the active (currently displayed) and the inactive frame buffers.
+//
+// Drivers may postpone the refresh while the backlight is off and
+// send only the last frame when the backlight is turned on again.
 void display_refresh(void);
 
 // Following functions define display's bitblt interface.
@@ -22,6 +22,7 @@
 #include <trezor_rtl.h>
 
 #include <gfx/gfx_bitblt.h>
+#include <io/backlight.h>
 #include <io/display.h>
 #include <sys/irq.h>
 #include <sys/mpu.h>
@@ -234,6 +235,15 @@ void display_refresh(void) {
   mpu_set_active_fb(NULL, 0);
 
 #ifndef BOARDLOADER
+  if (backlight_get() == 0 && !is_mode_exception()) {
+    // Nothing is visible, keep drawing into the same frame buffer and
+    // send only the last frame once the backlight is turned on again
+    drv->refresh_deferred = true;
+    return;
+  }
+
+  drv->refresh_deferred = false;
+
   // Mark the buffer ready to switch to
   fb_queue_put(&drv->ready_frames, fb_queue_take(&drv->empty_frames));
 
@@ -258,6 +268,11 @@ void display_ensure_refreshed(void) {
   if (!is_mode_exception()) {
     bool copy_pending;
 
+    if (drv->refresh_deferred) {
+      drv->refresh_deferred = false;
+      fb_queue_put(&drv->ready_frames, fb_queue_take(&drv->empty_frames));
+    }
+
     // Wait until all frame buffers are written to the display
     //  so we can be sure there's not scheduled or pending
     // background copying
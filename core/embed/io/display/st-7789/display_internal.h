@@ -21,6 +21,8 @@ typedef struct {
   // and the interrupt context)
   fb_queue_t empty_frames;
   fb_queue_t ready_frames;
+  // Set if the last frame was not sent because the backlight is off
+  bool refresh_deferred;
 #endif
 
   // Current display orientation (0, 90, 180, 270)
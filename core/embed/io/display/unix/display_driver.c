@@ -61,6 +61,9 @@ typedef struct {
   int orientation_angle;
   // Current backlight level ranging from 0 to 255
   int backlight_level;
+  // Set if SDL runs with the dummy video driver (e.g. in the device tests),
+  // nothing is presented then, only `display_save` reads the buffer
+  bool headless;
 
   SDL_Window *window;
   SDL_Renderer *renderer;
@@ -102,6 +105,9 @@ bool display_init(display_content_mode_t mode) {
   }
   atexit(display_exit_handler);
 
+  const char *video_driver = SDL_GetCurrentVideoDriver();
+  drv->headless = video_driver != NULL && strcmp(video_driver, "dummy") == 0;
+
   char *window_title = NULL;
   char *window_title_alloc = NULL;
   if (asprintf(&window_title_alloc, "Trezor^emu: %s", profile_name()) > 0) {
@@ -328,6 +334,11 @@ void display_refresh(void) {
   copy_mono_framebuf(drv);
 #endif
 
+  if (drv->headless) {
+    // the window is never shown, skip the texture upload and rendering
+    return;
+  }
+
   if (drv->background) {
     const SDL_Rect r = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT};
     SDL_RenderCopy(drv->renderer, drv->background, NULL, &r);
@@ -68,6 +68,10 @@ typedef struct {
   int orientation_angle;
   // Current backlight level ranging from 0 to 255
   int backlight_level;
+  // Copy of the display RAM, in the format sent over SPI
+  uint8_t shadow[DISPLAY_RESX * DISPLAY_RESY / 8];
+  // Set if `shadow` matches the display RAM
+  bool shadow_valid;
 } display_driver_t;
 
 // Display driver instance
@@ -93,6 +97,8 @@ static display_driver_t g_display_driver = {
 #define OLED_SETHIGHCOLUMN 0x10
 #define OLED_SETSTARTLINE 0x40
 #define OLED_MEMORYMODE 0x20
+#define OLED_SETCOLUMNADDR 0x21
+#define OLED_SETPAGEADDR 0x22
 #define OLED_COMSCANINC 0xC0
 #define OLED_COMSCANDEC 0xC8
 #define OLED_SEGREMAP 0xA0
@@ -179,16 +185,17 @@ static void display_send_bytes(display_driver_t *drv, const uint8_t *data,
    (*(src + (6 * DISPLAY_RESX)) >= 128 ? 64 : 0) |    \
    (*(src + (7 * DISPLAY_RESX)) >= 128 ? 128 : 0))
 
-// Copies the framebuffer to the display via SPI interface
-static void display_sync_with_fb(display_driver_t *drv) {
-  static const uint8_t cursor_set_seq[3] = {OLED_SETLOWCOLUMN | 0x00,
-                                            OLED_SETHIGHCOLUMN | 0x00,
-                                            OLED_SETSTARTLINE | 0x00};
+// Sends the packed pixels of one page (8 rows) to the display via SPI
+// interface
+static bool display_send_page(display_driver_t *drv, int page,
+                              const uint8_t *data) {
+  const uint8_t range_set_seq[6] = {
+      OLED_SETCOLUMNADDR, 0, DISPLAY_RESX - 1, OLED_SETPAGEADDR, page, page};
 
   // SPI select
   HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_RESET);
-  // Set the cursor to the screen top-left corner
-  display_send_bytes(drv, &cursor_set_seq[0], sizeof(cursor_set_seq));
+  // Limit the display RAM window to the page
+  display_send_bytes(drv, &range_set_seq[0], sizeof(range_set_seq));
 
   // SPI deselect
   HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
@@ -197,50 +204,78 @@ static void display_sync_with_fb(display_driver_t *drv) {
   // SPI select
   HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_RESET);
 
-  // Send whole framebuffer to the display
+  bool ok = HAL_OK == HAL_SPI_Transmit(&drv->spi, (uint8_t *)data,
+                                       DISPLAY_RESX, 1000);
+
+  while (HAL_SPI_STATE_READY != HAL_SPI_GetState(&drv->spi)) {
+  }
+
+  // SPI deselect
+  HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
+  // Set to CMD
+  HAL_GPIO_WritePin(OLED_DC_PORT, OLED_DC_PIN, GPIO_PIN_RESET);
+
+  return ok;
+}
+
+// Copies the framebuffer to the display via SPI interface
+//
+// Only the pages that differ from the last sent content are transferred.
+static void display_sync_with_fb(display_driver_t *drv) {
+  static const uint8_t range_reset_seq[7] = {
+      OLED_SETCOLUMNADDR,   0, DISPLAY_RESX - 1, OLED_SETPAGEADDR, 0,
+      DISPLAY_RESY / 8 - 1, OLED_SETSTARTLINE | 0x00};
+
+  bool sent = false;
+  bool failed = false;
 
   mpu_set_active_fb(drv->framebuf, FRAME_BUFFER_SIZE);
 
-  if (drv->orientation_angle == 0) {
-    for (int y = DISPLAY_RESY / 8 - 1; y >= 0; y--) {
-      uint8_t buff[DISPLAY_RESX];
-      uint8_t *src = &drv->framebuf[y * DISPLAY_RESX * 8];
+  for (int page = 0; page < DISPLAY_RESY / 8; page++) {
+    uint8_t buff[DISPLAY_RESX];
 
+    if (drv->orientation_angle == 0) {
+      uint8_t *src = &drv->framebuf[(DISPLAY_RESY / 8 - 1 - page) *
+                                    DISPLAY_RESX * 8];
       for (int x = DISPLAY_RESX - 1; x >= 0; x--) {
         buff[x] = COLLECT_ROW_BYTE(src);
         src++;
       }
-
-      if (HAL_OK != HAL_SPI_Transmit(&drv->spi, &buff[0], sizeof(buff), 1000)) {
-        // TODO: error
-        return;
-      }
-    }
-  } else {
-    for (int y = 0; y < DISPLAY_RESY / 8; y++) {
-      uint8_t buff[DISPLAY_RESX];
-      uint8_t *src = &drv->framebuf[y * DISPLAY_RESX * 8];
-
+    } else {
+      uint8_t *src = &drv->framebuf[page * DISPLAY_RESX * 8];
       for (int x = 0; x < DISPLAY_RESX; x++) {
         buff[x] = COLLECT_ROW_BYTE_REV(src);
         src++;
       }
+    }
 
-      if (HAL_OK != HAL_SPI_Transmit(&drv->spi, &buff[0], sizeof(buff), 1000)) {
-        // TODO: error
-        return;
-      }
+    uint8_t *shadow = &drv->shadow[page * DISPLAY_RESX];
+
+    if (drv->shadow_valid && memcmp(shadow, buff, sizeof(buff)) == 0) {
+      continue;
     }
-  }
 
-  while (HAL_SPI_STATE_READY != HAL_SPI_GetState(&drv->spi)) {
+    if (!display_send_page(drv, page, buff)) {
+      // TODO: error
+      failed = true;
+      break;
+    }
+
+    memcpy(shadow, buff, sizeof(buff));
+    sent = true;
   }
+
   mpu_set_active_fb(NULL, 0);
 
-  // SPI deselect
-  HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
-  // Set to CMD
-  HAL_GPIO_WritePin(OLED_DC_PORT, OLED_DC_PIN, GPIO_PIN_RESET);
+  drv->shadow_valid = !failed;
+
+  if (sent) {
+    // Restore the full screen window, the next boot stage may still
+    // send the whole framebuffer at once
+    HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_RESET);
+    display_send_bytes(drv, &range_reset_seq[0], sizeof(range_reset_seq));
+    HAL_GPIO_WritePin(OLED_CS_PORT, OLED_CS_PIN, GPIO_PIN_SET);
+  }
 }
 
 bool display_init(display_content_mode_t mode) {
@@ -71,6 +71,9 @@ typedef struct {
   // This prevents the repeated set of `DRV2625_REG_MODE` register
   // which would otherwise stop all playback.
   bool playing_rtp;
+  // Library effect currently loaded in the waveform sequencer (0 if none).
+  // Replaying it only needs the `DRV2625_REG_GO` write.
+  uint8_t lib_effect;
 
 } haptic_driver_t;
 
@@ -278,6 +281,7 @@ static bool haptic_play_rtp(int8_t amplitude, uint16_t duration_ms) {
     }
 
     driver->playing_rtp = true;
+    driver->lib_effect = 0;
   }
 
   if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_RTP, (uint8_t)amplitude)) {
@@ -306,19 +310,24 @@ static bool haptic_play_lib(drv2625_lib_effect_t effect) {
     return false;
   }
 
-  driver->playing_rtp = false;
+  if (driver->lib_effect != effect) {
+    driver->playing_rtp = false;
+    driver->lib_effect = 0;
 
-  if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_MODE,
-                       DRV2625_REG_MODE_WAVEFORM)) {
-    return false;
-  }
+    if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_MODE,
+                         DRV2625_REG_MODE_WAVEFORM)) {
+      return false;
+    }
 
-  if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_WAVESEQ1, effect)) {
-    return false;
-  }
+    if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_WAVESEQ1, effect)) {
+      return false;
+    }
 
-  if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_WAVESEQ2, 0)) {
-    return false;
+    if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_WAVESEQ2, 0)) {
+      return false;
+    }
+
+    driver->lib_effect = effect;
   }
 
   if (!drv2625_set_reg(driver->i2c_bus, DRV2625_REG_GO, DRV2625_REG_GO_GO)) {
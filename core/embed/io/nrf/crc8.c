@@ -26,6 +26,11 @@ uint8_t crc8_ccitt(uint8_t val, const void *buf, size_t cnt) {
 
 uint8_t crc8(const uint8_t *src, size_t len, uint8_t polynomial,
              uint8_t initial_value, bool reversed) {
+  if (polynomial == 0x07 && !reversed) {
+    // CRC-8-CCITT, computed by nibbles from a table instead of bit by bit
+    return crc8_ccitt(initial_value, src, len);
+  }
+
   uint8_t crc = initial_value;
   size_t i, j;
 
@@ -771,6 +771,24 @@ int process_msg_FirmwareUpload(uint8_t iface_num, uint32_t msg_size,
 
   ensure((chunk_size % FLASH_BLOCK_SIZE == 0) * sectrue, NULL);
 
+  firmware_remaining -= chunk_requested;
+  headers_offset = 0;
+  firmware_block++;
+  firmware_upload_chunk_retry = FIRMWARE_UPLOAD_CHUNK_RETRY_COUNT;
+
+  if (firmware_remaining > 0) {
+    // request the next chunk before programming this one, so the host prepares
+    // and sends it while the flash is erased and written. The chunk is not read
+    // before this function returns, and a failed write halts the device anyway.
+    chunk_requested = (firmware_remaining > IMAGE_CHUNK_SIZE)
+                          ? IMAGE_CHUNK_SIZE
+                          : firmware_remaining;
+    MSG_SEND_INIT(FirmwareRequest);
+    MSG_SEND_ASSIGN_REQUIRED_VALUE(offset, firmware_block * IMAGE_CHUNK_SIZE);
+    MSG_SEND_ASSIGN_REQUIRED_VALUE(length, chunk_requested);
+    MSG_SEND(FirmwareRequest);
+  }
+
   while (bytes_remaining > 0) {
     // erase flash before writing
     uint32_t bytes_erased = 0;
@@ -800,8 +818,6 @@ int process_msg_FirmwareUpload(uint8_t iface_num, uint32_t msg_size,
     bytes_remaining -= bytes_to_write;
   }
 
-  firmware_remaining -= chunk_requested;
-
   if (firmware_remaining == 0) {
     // erase the rest (unused part) of the FIRMWARE_AREA
     uint32_t bytes_erased = 0;
@@ -811,21 +827,7 @@ int process_msg_FirmwareUpload(uint8_t iface_num, uint32_t msg_size,
           NULL);
       erase_offset += bytes_erased;
     } while (bytes_erased > 0);
-  }
-
-  headers_offset = 0;
-  firmware_block++;
-  firmware_upload_chunk_retry = FIRMWARE_UPLOAD_CHUNK_RETRY_COUNT;
 
-  if (firmware_remaining > 0) {
-    chunk_requested = (firmware_remaining > IMAGE_CHUNK_SIZE)
-                          ? IMAGE_CHUNK_SIZE
-                          : firmware_remaining;
-    MSG_SEND_INIT(FirmwareRequest);
-    MSG_SEND_ASSIGN_REQUIRED_VALUE(offset, firmware_block * IMAGE_CHUNK_SIZE);
-    MSG_SEND_ASSIGN_REQUIRED_VALUE(length, chunk_requested);
-    MSG_SEND(FirmwareRequest);
-  } else {
     MSG_SEND_INIT(Success);
     MSG_SEND(Success);
   }
@@ -19,6 +19,7 @@
 
 #include <trezor_rtl.h>
 
+#include <gfx/gfx_bitblt.h>
 #include <gfx/gfx_draw.h>
 #include <io/display.h>
 #include <rtl/cli.h>
@@ -117,6 +118,25 @@ static void prodtest_display_set_backlight(cli_t* cli) {
   cli_ok(cli, "");
 }
 
+static void prodtest_display_bitblt_stats(cli_t* cli) {
+  if (cli_arg_count(cli) > 0) {
+    cli_error_arg_count(cli);
+    return;
+  }
+
+  gfx_bitblt_stats_t stats;
+  gfx_bitblt_get_stats(&stats);
+  gfx_bitblt_reset_stats();
+
+  cli_trace(cli, "DMA2D: %u operations, %u pixels", stats.hw_ops,
+            stats.hw_pixels);
+  cli_trace(cli, "CPU: %u operations, %u pixels", stats.sw_ops,
+            stats.sw_pixels);
+
+  cli_ok(cli, "%u %u %u %u", stats.hw_ops, stats.hw_pixels, stats.sw_ops,
+         stats.sw_pixels);
+}
+
 // clang-format off
 
 PRODTEST_CLI_CMD(
@@ -139,3 +159,10 @@ PRODTEST_CLI_CMD(
   .info = "Set the display backlight level",
   .args = "<level>"
 );
+
+PRODTEST_CLI_CMD(
+  .name = "display-bitblt-stats",
+  .func = prodtest_display_bitblt_stats,
+  .info = "Get and reset the counters of the bitblt operations",
+  .args = ""
+);
@@ -106,8 +106,22 @@ void cli_ok_hexdata(cli_t* cli, const void* data, size_t size) {
 
   if (size > 0) {
     cli_printf(cli, " ");
+    // Encode the data in chunks instead of formatting and writing every byte
+    // separately, the payloads (e.g. certificates) are up to a few kilobytes
+    static const char hex_digits[] = "0123456789ABCDEF";
+    char buffer[64];
+    size_t len = 0;
     for (size_t i = 0; i < size; i++) {
-      cli_printf(cli, "%02X", ((uint8_t*)data)[i]);
+      uint8_t byte = ((const uint8_t*)data)[i];
+      buffer[len++] = hex_digits[byte >> 4];
+      buffer[len++] = hex_digits[byte & 0x0F];
+      if (len == sizeof(buffer)) {
+        cli->write(cli->callback_context, buffer, len);
+        len = 0;
+      }
+    }
+    if (len > 0) {
+      cli->write(cli->callback_context, buffer, len);
     }
   }
   cli_printf(cli, "\r\n");
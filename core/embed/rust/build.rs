@@ -352,6 +352,7 @@ fn generate_trezorhal_bindings() {
         .allowlist_function("gfx_rgba8888_copy_rgba8888")
         .allowlist_function("gfx_rgba8888_blend_mono4")
         .allowlist_function("gfx_rgba8888_blend_mono8")
+        .allowlist_function("gfx_rgba8888_blend_rgba8888")
         .allowlist_function("gfx_mono8_fill")
         .allowlist_function("gfx_mono8_copy_mono1p")
         .allowlist_function("gfx_mono8_copy_mono4")
@@ -16,6 +16,17 @@ mod ffi_override {
             pk: *const cty::c_uchar,
             RS: *const cty::c_uchar,
         ) -> cty::c_int;
+
+        pub fn ed25519_sign_open_batch(
+            m: *const *const cty::c_uchar,
+            mlen: *const usize,
+            pk: *const *const cty::c_uchar,
+            RS: *const *const cty::c_uchar,
+            num: usize,
+            valid: *mut cty::c_int,
+            scratch: *mut cty::c_void,
+            scratch_size: usize,
+        ) -> cty::c_int;
     }
 }
 
@@ -34,3 +45,56 @@ pub fn verify(message: &[u8], public_key: &PublicKey, signature: &Signature) ->
         Err(Error::SignatureVerificationFailed)
     }
 }
+
+/// Number of signatures checked by a single multi-scalar multiplication in
+/// `verify_batch`.
+const VERIFY_BATCH_SIZE: usize = 4;
+
+/// Size in bytes of the scratch space of `ed25519_sign_open_batch` for
+/// `VERIFY_BATCH_SIZE` signatures, see `ED25519_BATCH_SCRATCH_SIZE`.
+const VERIFY_BATCH_SCRATCH_SIZE: usize = (2 * VERIFY_BATCH_SIZE + 1) * 196;
+
+/// Verify the signatures of all the messages, succeeding only if every one of
+/// them is valid.
+pub fn verify_batch(
+    messages: &[&[u8]],
+    public_keys: &[PublicKey],
+    signatures: &[Signature],
+) -> Result<(), Error> {
+    if messages.len() != public_keys.len() || messages.len() != signatures.len() {
+        return Err(Error::SignatureVerificationFailed);
+    }
+    let mut scratch = [0u32; VERIFY_BATCH_SCRATCH_SIZE / 4];
+    for ((m, pk), sig) in messages
+        .chunks(VERIFY_BATCH_SIZE)
+        .zip(public_keys.chunks(VERIFY_BATCH_SIZE))
+        .zip(signatures.chunks(VERIFY_BATCH_SIZE))
+    {
+        let mut m_ptrs = [core::ptr::null(); VERIFY_BATCH_SIZE];
+        let mut mlen = [0usize; VERIFY_BATCH_SIZE];
+        let mut pk_ptrs = [core::ptr::null(); VERIFY_BATCH_SIZE];
+        let mut sig_ptrs = [core::ptr::null(); VERIFY_BATCH_SIZE];
+        for i in 0..m.len() {
+            m_ptrs[i] = m[i].as_ptr();
+            mlen[i] = m[i].len();
+            pk_ptrs[i] = pk[i].as_ptr();
+            sig_ptrs[i] = sig[i].as_ptr();
+        }
+        let res = unsafe {
+            ffi_override::ed25519_sign_open_batch(
+                m_ptrs.as_ptr(),
+                mlen.as_ptr(),
+                pk_ptrs.as_ptr(),
+                sig_ptrs.as_ptr(),
+                m.len(),
+                core::ptr::null_mut(),
+                scratch.as_mut_ptr().cast(),
+                VERIFY_BATCH_SCRATCH_SIZE,
+            )
+        };
+        if res != 0 {
+            return Err(Error::SignatureVerificationFailed);
+        }
+    }
+    Ok(())
+}
@@ -237,7 +237,8 @@ impl Decoder {
             }
             FieldType::Enum(enum_type) => {
                 let enum_val = num.try_into()?;
-                if enum_type.values.contains(&enum_val) {
+                // The values are sorted, see `build_enums_with_offsets` in pb2py.
+                if enum_type.values.binary_search(&enum_val).is_ok() {
                     Ok(enum_val.into())
                 } else {
                     Err(error::invalid_value(field.name.into()))
@@ -26,7 +26,17 @@ impl MsgDef {
     }
 
     pub fn field(&self, tag: u8) -> Option<&FieldDef> {
-        self.fields.iter().find(|field| field.tag == tag)
+        // The fields are sorted by their tags, which are mostly numbered from 1
+        // without gaps, so the field is usually found at `tag - 1`.
+        let index = (tag as usize).wrapping_sub(1);
+        match self.fields.get(index) {
+            Some(field) if field.tag == tag => Some(field),
+            _ => self
+                .fields
+                .binary_search_by_key(&tag, |field| field.tag)
+                .ok()
+                .map(|i| &self.fields[i]),
+        }
     }
 }
 
@@ -125,9 +125,23 @@ pub struct Translations<'a> {
     header: TranslationsHeader<'a>,
     translations: &'a [u8],
     translations_offsets: &'a [u16],
+    /// Set if the whole translations section is valid UTF-8 and every offset
+    /// lies on a char boundary, so that no string has to be validated again.
+    translations_utf8: bool,
     fonts: Table<'a>,
 }
 
+/// Returns whether all bytes of `data` are `EMPTY_BYTE`. The rest of the
+/// translations area behind a blob on flash is large, so the aligned part is
+/// compared by words.
+fn is_empty(data: &[u8]) -> bool {
+    const EMPTY_WORD: u32 = u32::from_ne_bytes([EMPTY_BYTE; 4]);
+    // SAFETY: any bytes are valid u32 values, so casting any data to
+    // a sequence of u32 values is safe.
+    let (prefix, words, suffix) = unsafe { data.align_to::<u32>() };
+    prefix.iter().chain(suffix).all(|&b| b == EMPTY_BYTE) && words.iter().all(|&w| w == EMPTY_WORD)
+}
+
 fn read_u16_prefixed_block<'a>(reader: &mut InputStream<'a>) -> Result<InputStream<'a>, Error> {
     let len = reader.read_u16_le()? as usize;
     reader.read_stream(len)
@@ -142,9 +156,7 @@ impl<'a> Translations<'a> {
         let (header, payload_reader) = TranslationsHeader::parse_from(&mut blob_reader)?;
 
         // validate that the trailing bytes, if any, are empty
-        let remaining = blob_reader.rest();
-        if !remaining.iter().all(|&b| b == EMPTY_BYTE) {
-            // TODO optimize to quadwords?
+        if !is_empty(blob_reader.rest()) {
             return Err(value_error!(c"Trailing data in translations blob"));
         }
 
@@ -177,6 +189,11 @@ impl<'a> Translations<'a> {
         }
         let translations = translations_reader.rest();
         validate_offset_table(translations.len(), translations_offsets.iter().copied())?;
+        let translations_utf8 = str::from_utf8(translations).is_ok_and(|s| {
+            translations_offsets
+                .iter()
+                .all(|&offset| s.is_char_boundary(offset as usize))
+        });
 
         // construct and validate font table
         let fonts = Table::new(fonts_reader)?;
@@ -191,6 +208,7 @@ impl<'a> Translations<'a> {
             header,
             translations,
             translations_offsets,
+            translations_utf8,
             fonts,
         })
     }
@@ -228,7 +246,13 @@ impl<'a> Translations<'a> {
             return None;
         }
 
-        str::from_utf8(string).ok()
+        if self.translations_utf8 {
+            // SAFETY: `string` is delimited by two offsets on char boundaries of
+            // the section that was checked to be valid UTF-8 in `new()`.
+            Some(unsafe { str::from_utf8_unchecked(string) })
+        } else {
+            str::from_utf8(string).ok()
+        }
     }
 
     /// Returns the font table at the given index.
@@ -369,6 +369,7 @@ impl<'a> BitBltCopy<'a> {
             match self.src.format() {
                 BitmapFormat::MONO4 => ffi::gfx_rgba8888_blend_mono4(&bitblt),
                 BitmapFormat::MONO8 => ffi::gfx_rgba8888_blend_mono8(&bitblt),
+                BitmapFormat::RGBA8888 => ffi::gfx_rgba8888_blend_rgba8888(&bitblt),
                 _ => unimplemented!(),
             }
         }
@@ -416,7 +416,6 @@ pub struct Homescreen {
     label_width: i16,
     label_height: i16,
     notification: Option<(TString<'static>, u8)>,
-    image: Option<BinaryData<'static>>,
     bg_image: ImageBuffer<Rgb565Canvas<'static>>,
     hold_to_lock: bool,
     loader: Loader,
@@ -454,7 +453,6 @@ impl Homescreen {
             label_width,
             label_height,
             notification,
-            image,
             bg_image: buf,
             hold_to_lock,
             loader: Loader::with_lock_icon().with_durations(LOADER_DURATION, LOADER_DURATION / 3),
@@ -581,15 +579,8 @@ impl Component for Homescreen {
             let t = self.attach_animation.eval();
             let opacity = self.attach_animation.opacity(t);
 
-            if let Some(image) = self.image {
-                if let ImageInfo::Jpeg(_) = ImageInfo::parse(image) {
-                    shape::JpegImage::new_image(AREA.center(), image)
-                        .with_align(Alignment2D::CENTER)
-                        .render(target);
-                }
-            } else {
-                render_default_hs(target);
-            }
+            // the image was decoded to `bg_image` in `new()`
+            shape::RawImage::new(AREA, self.bg_image.view()).render(target);
 
             let y_offset = self.label_anim.eval(self.label_width);
 
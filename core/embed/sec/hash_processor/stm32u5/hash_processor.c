@@ -12,6 +12,10 @@
 HASH_HandleTypeDef hhash = {0};
 DMA_HandleTypeDef DMA_Handle = {0};
 
+// set between hash_processor_sha256_init and hash_processor_sha256_final,
+// while the peripheral holds the state of an incremental hash
+static bool hash_processor_busy = false;
+
 void hash_processor_init(void) {
   __HAL_RCC_HASH_CLK_ENABLE();
   __HAL_RCC_GPDMA1_CLK_ENABLE();
@@ -85,6 +89,7 @@ void hash_processor_sha256_calc(const uint8_t *data, uint32_t len,
 
 void hash_processor_sha256_init(hash_sha256_context_t *ctx) {
   memzero(ctx, sizeof(hash_sha256_context_t));
+  hash_processor_busy = true;
 }
 
 void hash_processor_sha256_update(hash_sha256_context_t *ctx,
@@ -131,6 +136,19 @@ void hash_processor_sha256_final(hash_sha256_context_t *ctx, uint8_t *output) {
   memzero(ctx->buffer, HASH_SHA256_BUFFER_SIZE);
   memcpy(output, tmp_out, SHA256_DIGEST_LENGTH);
   memzero(tmp_out, sizeof(tmp_out));
+  hash_processor_busy = false;
+}
+
+// Overrides the weak definition in sha2.c, so that sha256_Raw uses the
+// peripheral for large inputs
+int sha256_hw_Raw(const uint8_t *data, size_t len,
+                  uint8_t digest[SHA256_DIGEST_LENGTH]) {
+  if (hhash.State == HAL_HASH_STATE_RESET || hash_processor_busy) {
+    // not initialized yet or an incremental hash is in progress
+    return 0;
+  }
+  hash_processor_sha256_calc(data, len, digest);
+  return 1;
 }
 
 #endif  // KERNEL_MODE
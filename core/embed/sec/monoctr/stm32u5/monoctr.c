@@ -62,7 +62,9 @@ secbool monoctr_write(monoctr_type_t type, uint8_t value) {
     return sectrue;
   }
 
-  for (int i = 0; i < value; i++) {
+  // The first current_value quadwords are cleared already, programming them
+  // again would only wear the flash.
+  for (int i = current_value; i < value; i++) {
     uint32_t data[4] = {0};
     secret_write((uint8_t *)data, offset + i * 16, 16);
   }
@@ -268,8 +268,12 @@ static optiga_result optiga_i2c_read(uint8_t *buffer, uint16_t buffer_size) {
       .ops = ops,
   };
 
+  // A read always follows the write of the register address, which already
+  // waited for the guard time, so only the retries are delayed.
   for (int try_count = 0; try_count <= I2C_MAX_RETRY_COUNT; ++try_count) {
-    systick_delay_ms(1);
+    if (try_count != 0) {
+      systick_delay_ms(1);
+    }
 
     if (I2C_STATUS_OK == i2c_bus_submit_and_wait(i2c_bus, &pkt)) {
       OPTIGA_LOG("<<<", buffer, buffer_size)
@@ -29,11 +29,13 @@
 
 #ifdef KERNEL_MODE
 
-#define DRBG_RESEED_INTERVAL_CALLS 1000
+// chacha_drbg_generate_buffered calls chacha_drbg_generate once per
+// CHACHA_DRBG_BUFFER_LENGTH bytes, so the DRBG is reseeded about every 64000
+// bytes
+#define DRBG_RESEED_INTERVAL_CALLS (64000 / CHACHA_DRBG_BUFFER_LENGTH)
 #define DRBG_TRNG_ENTROPY_LENGTH 50
 _Static_assert(CHACHA_DRBG_OPTIMAL_RESEED_LENGTH(1) == DRBG_TRNG_ENTROPY_LENGTH,
                "");
-#define BUFFER_LENGTH 64
 
 static CHACHA_DRBG_CTX drbg_ctx;
 static secbool drbg_initialized = secfalse;
@@ -65,7 +67,7 @@ static void drbg_generate(uint8_t *buffer, size_t length) {
   if (drbg_ctx.reseed_counter > DRBG_RESEED_INTERVAL_CALLS) {
     drbg_reseed();
   }
-  chacha_drbg_generate(&drbg_ctx, buffer, length);
+  chacha_drbg_generate_buffered(&drbg_ctx, buffer, length);
 }
 
 // WARNING: Returns a constant if the function's critical section is locked
@@ -83,19 +85,8 @@ static uint32_t drbg_random8(void) {
     return 128;
   }
 
-  static size_t buffer_index = 0;
-  static uint8_t buffer[BUFFER_LENGTH] = {0};
-
-  if (buffer_index == 0) {
-    drbg_generate(buffer, sizeof(buffer));
-  }
-
-  // To be extra sure there is no buffer overflow, we use a local copy of
-  // buffer_index
-  size_t buffer_index_local = buffer_index % sizeof(buffer);
-  uint8_t value = buffer[buffer_index_local];
-  memzero(&buffer[buffer_index_local], 1);
-  buffer_index = (buffer_index_local + 1) % sizeof(buffer);
+  uint8_t value = 0;
+  drbg_generate(&value, sizeof(value));
 
   atomic_flag_clear(&locked);  // locked = false
   return value;
@@ -32,4 +32,8 @@ uint32_t rng_read(const uint32_t previous, const uint32_t compare_previous);
 
 uint32_t rng_get(void);
 
+// Fills the buffer with random bytes from the TRNG. Used instead of calling
+// `rng_get()` per word to fetch bulk randomness with a single syscall.
+void rng_fill_buffer(void *buffer, size_t buffer_size);
+
 #endif
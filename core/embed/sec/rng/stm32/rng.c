@@ -18,6 +18,7 @@
  */
 
 #include <trezor_bsp.h>
+#include <trezor_rtl.h>
 
 #include <sec/rng.h>
 
@@ -59,4 +60,15 @@ uint32_t rng_get(void) {
   return current;
 }
 
+void rng_fill_buffer(void *buffer, size_t buffer_size) {
+  uint8_t *dst = buffer;
+  while (buffer_size > 0) {
+    uint32_t r = rng_get();
+    size_t n = MIN(buffer_size, sizeof(r));
+    memcpy(dst, &r, n);
+    dst += n;
+    buffer_size -= n;
+  }
+}
+
 #endif  // KERNEL_MODE
@@ -32,3 +32,14 @@ uint32_t rng_get(void) {
          "fread failed");
   return r;
 }
+
+void rng_fill_buffer(void *buffer, size_t buffer_size) {
+  uint8_t *dst = buffer;
+  while (buffer_size > 0) {
+    uint32_t r = rng_get();
+    size_t n = MIN(buffer_size, sizeof(r));
+    memcpy(dst, &r, n);
+    dst += n;
+    buffer_size -= n;
+  }
+}
@@ -18,11 +18,55 @@
  */
 
 #include <sec/time_estimate.h>
+#include <sys/systick.h>
 
-// The number of CPU cycles required to execute one iteration of PBKDF2.
+#include "sha2.h"
+
+// The number of CPU cycles required to execute one iteration of PBKDF2, used
+// if the measurement fails.
 #define PIN_PBKDF2_CYCLES_PER_ITER 11100
 
+// The number of iterations of PBKDF2 timed by the measurement.
+#define PIN_PBKDF2_MEASURED_ITERS 32
+
+// The measured number of CPU cycles of one iteration of PBKDF2, 0 until the
+// first estimate.
+static uint32_t pbkdf2_cycles_per_iter = 0;
+
+// Measures one iteration of PBKDF2-HMAC-SHA256 as computed by
+// pbkdf2_hmac_sha256_Update(). The number of cycles does not depend on the
+// clock frequency, so the measurement stays valid after systick_update_freq().
+static uint32_t measure_pbkdf2_cycles_per_iter(void) {
+  uint32_t idig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)] = {0};
+  uint32_t odig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)] = {0};
+  uint32_t g[SHA256_BLOCK_LENGTH / sizeof(uint32_t)] = {0};
+  volatile uint32_t f = 0;
+
+  uint64_t begin = systick_cycles();
+  for (int i = 0; i < PIN_PBKDF2_MEASURED_ITERS; i++) {
+    sha256_Transform(idig, g, g);
+    sha256_Transform(odig, g, g);
+    for (size_t j = 0; j < SHA256_DIGEST_LENGTH / sizeof(uint32_t); j++) {
+      f ^= g[j];
+    }
+  }
+  uint64_t cycles = systick_cycles() - begin;
+
+  uint32_t cycles_per_iter = cycles / PIN_PBKDF2_MEASURED_ITERS;
+  // An interrupt may have made the measurement much longer, in that case or
+  // if the measurement is implausible the fixed estimate is used.
+  if (cycles_per_iter < PIN_PBKDF2_CYCLES_PER_ITER / 4 ||
+      cycles_per_iter > PIN_PBKDF2_CYCLES_PER_ITER * 4) {
+    return PIN_PBKDF2_CYCLES_PER_ITER;
+  }
+  return cycles_per_iter;
+}
+
 uint32_t time_estimate_pbkdf2_ms(uint32_t iterations) {
   extern uint32_t SystemCoreClock;
-  return PIN_PBKDF2_CYCLES_PER_ITER * iterations / (SystemCoreClock / 1000);
+  if (pbkdf2_cycles_per_iter == 0) {
+    pbkdf2_cycles_per_iter = measure_pbkdf2_cycles_per_iter();
+  }
+  return (uint64_t)pbkdf2_cycles_per_iter * iterations /
+         (SystemCoreClock / 1000);
 }
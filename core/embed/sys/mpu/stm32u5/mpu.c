@@ -262,34 +262,9 @@ mpu_mode_t mpu_get_mode(void) {
   return drv->mode;
 }
 
-void mpu_set_active_fb(void* addr, size_t size) {
-  mpu_driver_t* drv = &g_mpu_driver;
-
-  if (!drv->initialized) {
-    return;
-  }
-
-  irq_key_t lock = irq_lock();
-
-  drv->active_fb_addr = (uint32_t)addr;
-  drv->active_fb_size = size;
-
-  irq_unlock(lock);
-
-  mpu_reconfig(drv->mode);
-}
-
-mpu_mode_t mpu_reconfig(mpu_mode_t mode) {
-  mpu_driver_t* drv = &g_mpu_driver;
-
-  if (!drv->initialized) {
-    // Solves the issue when some IRQ handler tries to reconfigure
-    // MPU before it is initialized
-    return MPU_MODE_DISABLED;
-  }
-
-  irq_key_t irq_key = irq_lock();
-
+// Programs the banked regions #5 to #7 for the given mode,
+// must be called with interrupts disabled
+static void mpu_set_regions(mpu_driver_t* drv, mpu_mode_t mode) {
   HAL_MPU_Disable();
 
   // Region #5 is banked
@@ -382,9 +357,46 @@ mpu_mode_t mpu_reconfig(mpu_mode_t mode) {
   if (mode != MPU_MODE_DISABLED) {
     HAL_MPU_Enable(LL_MPU_CTRL_HARDFAULT_NMI);
   }
+}
+
+void mpu_set_active_fb(void* addr, size_t size) {
+  mpu_driver_t* drv = &g_mpu_driver;
+
+  if (!drv->initialized) {
+    return;
+  }
+
+  irq_key_t lock = irq_lock();
+
+  drv->active_fb_addr = (uint32_t)addr;
+  drv->active_fb_size = size;
+
+  // Region #5 of the current mode has to be rewritten
+  mpu_set_regions(drv, drv->mode);
+
+  irq_unlock(lock);
+}
+
+mpu_mode_t mpu_reconfig(mpu_mode_t mode) {
+  mpu_driver_t* drv = &g_mpu_driver;
+
+  if (!drv->initialized) {
+    // Solves the issue when some IRQ handler tries to reconfigure
+    // MPU before it is initialized
+    return MPU_MODE_DISABLED;
+  }
+
+  irq_key_t irq_key = irq_lock();
 
   mpu_mode_t prev_mode = drv->mode;
-  drv->mode = mode;
+
+  // The banked regions depend only on the mode and the active framebuffer,
+  // which rewrites them itself, so nested or repeated switches to the same
+  // mode (e.g. storage syscalls) leave the MPU as it is.
+  if (mode != prev_mode) {
+    mpu_set_regions(drv, mode);
+    drv->mode = mode;
+  }
 
   irq_unlock(irq_key);
 
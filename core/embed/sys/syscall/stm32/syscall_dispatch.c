@@ -658,6 +658,12 @@ __attribute((no_stack_protector)) void syscall_handler(uint32_t *args,
       args[0] = rng_get();
     } break;
 
+    case SYSCALL_RNG_FILL_BUFFER: {
+      void *buffer = (void *)args[0];
+      size_t buffer_size = args[1];
+      rng_fill_buffer__verified(buffer, buffer_size);
+    } break;
+
     case SYSCALL_FIRMWARE_GET_VENDOR: {
       char *buff = (char *)args[0];
       size_t buff_size = args[1];
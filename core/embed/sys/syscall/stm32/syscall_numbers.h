@@ -134,6 +134,7 @@ typedef enum {
   SYSCALL_TRANSLATIONS_AREA_BYTESIZE,
 
   SYSCALL_RNG_GET,
+  SYSCALL_RNG_FILL_BUFFER,
 
   SYSCALL_FIRMWARE_GET_VENDOR,
   SYSCALL_FIRMWARE_CALC_HASH,
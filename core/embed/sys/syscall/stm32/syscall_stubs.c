@@ -608,6 +608,10 @@ uint32_t translations_area_bytesize(void) {
 
 uint32_t rng_get(void) { return syscall_invoke0(SYSCALL_RNG_GET); }
 
+void rng_fill_buffer(void *buffer, size_t buffer_size) {
+  syscall_invoke2((uint32_t)buffer, buffer_size, SYSCALL_RNG_FILL_BUFFER);
+}
+
 // =============================================================================
 // fwutils.h
 // =============================================================================
@@ -682,6 +682,20 @@ access_violation:
 
 // ---------------------------------------------------------------------
 
+void rng_fill_buffer__verified(void *buffer, size_t buffer_size) {
+  if (!probe_write_access(buffer, buffer_size)) {
+    goto access_violation;
+  }
+
+  rng_fill_buffer(buffer, buffer_size);
+  return;
+
+access_violation:
+  apptask_access_violation();
+}
+
+// ---------------------------------------------------------------------
+
 secbool firmware_calc_hash__verified(const uint8_t *challenge,
                                      size_t challenge_len, uint8_t *hash,
                                      size_t hash_len,
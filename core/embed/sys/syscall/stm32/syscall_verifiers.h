@@ -175,6 +175,11 @@ const uint8_t *translations_read__verified(uint32_t *len, uint32_t offset);
 
 void entropy_get__verified(uint8_t *buf);
 
+// ---------------------------------------------------------------------
+#include <sec/rng.h>
+
+void rng_fill_buffer__verified(void *buffer, size_t buffer_size);
+
 // ---------------------------------------------------------------------
 #include <util/fwutils.h>
 
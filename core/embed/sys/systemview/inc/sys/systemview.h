@@ -25,4 +25,12 @@
 
 void enable_systemview(void);
 
+#ifdef SYSTEMVIEW_PROFILER
+// Sends the PC and LR of the code interrupted by the SysTick to the
+// "profiler" RTT channel, each sample is two little-endian 32-bit words.
+//
+// Called from the SysTick interrupt handler.
+void systemview_profiler_sample(uint32_t pc, uint32_t lr);
+#endif
+
 #endif  // CORE_SYSTEMVIEW_H
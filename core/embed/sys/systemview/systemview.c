@@ -24,12 +24,39 @@
 #include <sys/systemview.h>
 #include "mpconfigport.h"
 
+#include "SEGGER_RTT.h"
 #include "SEGGER_SYSVIEW.h"
 #include "SEGGER_SYSVIEW_Conf.h"
 
+#ifdef SYSTEMVIEW_PROFILER
+// Size of the RTT buffer holding the samples not read by the host yet
+#define PROFILER_BUFFER_SIZE 4096
+
+static uint8_t profiler_buffer[PROFILER_BUFFER_SIZE];
+
+// RTT up-buffer index of the profiler or -1 if not allocated
+static int profiler_channel = -1;
+
+void systemview_profiler_sample(uint32_t pc, uint32_t lr) {
+  if (profiler_channel < 0) {
+    return;
+  }
+
+  uint32_t sample[2] = {pc, lr};
+  // The sample is dropped if the host is not reading fast enough
+  SEGGER_RTT_Write(profiler_channel, sample, sizeof(sample));
+}
+#endif
+
 void enable_systemview() {
   SEGGER_SYSVIEW_Conf();
   SEGGER_SYSVIEW_Start();
+
+#ifdef SYSTEMVIEW_PROFILER
+  profiler_channel = SEGGER_RTT_AllocUpBuffer(
+      "profiler", profiler_buffer, sizeof(profiler_buffer),
+      SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+#endif
 }
 
 #ifdef SYSTEMVIEW_DEST_RTT
@@ -25,6 +25,10 @@
 #include <sys/systimer.h>
 #include "systick_internal.h"
 
+#ifdef SYSTEMVIEW_PROFILER
+#include <sys/systemview.h>
+#endif
+
 #ifdef KERNEL_MODE
 
 // SysTick driver state
@@ -155,11 +159,18 @@ uint64_t systick_us(void) {
   return systick_cycles() / drv->cycles_per_us;
 }
 
-void SysTick_Handler(void) {
+// `frame` points to the exception frame of the interrupted code,
+// it is NULL unless the profiler is enabled
+static void __attribute__((used)) systick_handler(const uint32_t* frame) {
   IRQ_LOG_ENTER();
 
   mpu_mode_t mpu_mode = mpu_reconfig(MPU_MODE_DEFAULT);
 
+#ifdef SYSTEMVIEW_PROFILER
+  // The stacked LR and PC are the 6th and the 7th word of the frame
+  systemview_profiler_sample(frame[6], frame[5]);
+#endif
+
   systick_driver_t* drv = &g_systick_driver;
 
   if (drv->initialized) {
@@ -184,11 +195,30 @@ void SysTick_Handler(void) {
   IRQ_LOG_EXIT();
 }
 
+#ifdef SYSTEMVIEW_PROFILER
+// Passes the exception frame from the stack that was active when the
+// interrupt was taken, LR still holds EXC_RETURN so `systick_handler()`
+// returns from the exception
+__attribute__((naked, no_stack_protector)) void SysTick_Handler(void) {
+  __asm__ volatile(
+      "TST    LR, #4           \n"  // EXC_RETURN.SPSEL
+      "ITE    EQ               \n"
+      "MRSEQ  R0, MSP          \n"
+      "MRSNE  R0, PSP          \n"
+      "B      systick_handler  \n");
+}
+#else
+void SysTick_Handler(void) { systick_handler(NULL); }
+#endif
+
 #endif  // KERNEL_MODE
 
 void systick_delay_us(uint64_t us) {
-  uint64_t delay_cycles = systick_us_to_cycles(us);
-  int64_t cycles_per_ms = systick_us_to_cycles(1000);
+  // systick_us_to_cycles() is a syscall in the unprivileged code,
+  // the clock runs at an integer number of cycles per microsecond
+  uint64_t cycles_per_us = systick_us_to_cycles(1);
+  uint64_t delay_cycles = us * cycles_per_us;
+  int64_t cycles_per_ms = 1000 * cycles_per_us;
 
   uint64_t end = systick_cycles() + delay_cycles;
   bool irq_enabled = IS_IRQ_ENABLED(query_irq());
@@ -27,6 +27,7 @@
 
 #define NORCOW_HEADER_LEN 0
 #define NORCOW_SECTOR_COUNT 2
+#define NORCOW_INDEX_SIZE 256
 
 /*
  * Current storage version.
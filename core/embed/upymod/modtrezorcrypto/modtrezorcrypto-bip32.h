@@ -358,6 +358,40 @@ STATIC mp_obj_t mod_trezorcrypto_HDNode_address(mp_obj_t self,
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_HDNode_address_obj,
                                  mod_trezorcrypto_HDNode_address);
 
+/// def addresses(self, version: int, start: int, count: int) -> list[str]:
+///     """
+///     Compute the base58-encoded address strings of the non-hardened
+///     children start, ..., start + count - 1 of the HD node.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_HDNode_addresses(size_t n_args,
+                                                  const mp_obj_t *args) {
+  mp_obj_HDNode_t *o = MP_OBJ_TO_PTR(args[0]);
+
+  uint32_t v = trezor_obj_get_uint(args[1]);
+  uint32_t start = trezor_obj_get_uint(args[2]);
+  uint32_t count = trezor_obj_get_uint(args[3]);
+  if (count > 256) {
+    mp_raise_ValueError("Cannot compute more than 256 addresses");
+  }
+
+  char addrs[16][ADDRESS_MAXLEN] = {0};
+  mp_obj_t list = mp_obj_new_list(0, NULL);
+  for (uint32_t k = 0; k < count; k += 16) {
+    uint32_t n = count - k < 16 ? count - k : 16;
+    if (hdnode_get_addresses(&o->hdnode, v, start + k, n, addrs[0],
+                             ADDRESS_MAXLEN) != 0) {
+      mp_raise_ValueError("Failed to get addresses");
+    }
+    for (uint32_t j = 0; j < n; j++) {
+      mp_obj_list_append(list, mp_obj_new_str(addrs[j], strlen(addrs[j])));
+    }
+  }
+  return list;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_HDNode_addresses_obj, 4, 4,
+    mod_trezorcrypto_HDNode_addresses);
+
 #if !BITCOIN_ONLY
 
 #if USE_NEM
@@ -488,6 +522,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_HDNode_locals_dict_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_HDNode_public_key_obj)},
     {MP_ROM_QSTR(MP_QSTR_address),
      MP_ROM_PTR(&mod_trezorcrypto_HDNode_address_obj)},
+    {MP_ROM_QSTR(MP_QSTR_addresses),
+     MP_ROM_PTR(&mod_trezorcrypto_HDNode_addresses_obj)},
 #if !BITCOIN_ONLY
 #if USE_NEM
     {MP_ROM_QSTR(MP_QSTR_nem_address),
@@ -32,6 +32,30 @@
 /// package: trezorcrypto.cardano
 /// from trezorcrypto.bip32 import HDNode
 
+// Decodes the mnemonic into the bytes used as the PBKDF2 salt by the Icarus
+// derivation and returns their number
+static int cardano_icarus_entropy(mp_obj_t mnemonic, bool trezor_derivation,
+                                  uint8_t mnemonic_bits[64]) {
+  mp_buffer_info_t mnemo = {0};
+  mp_get_buffer_raise(mnemonic, &mnemo, MP_BUFFER_READ);
+  const char *pmnemonic = mnemo.len > 0 ? mnemo.buf : "";
+
+  int mnemonic_bits_len = mnemonic_to_bits(pmnemonic, mnemonic_bits);
+  if (mnemonic_bits_len == 0 || mnemonic_bits_len % 33 != 0) {
+    mp_raise_ValueError("Invalid mnemonic");
+  }
+
+  int entropy_len = mnemonic_bits_len - mnemonic_bits_len / 33;
+  if (!trezor_derivation) {
+    // Exclude checksum (original Icarus spec)
+    return entropy_len / 8;
+  } else {
+    // Include checksum if it is a full byte (Trezor bug)
+    // see also https://github.com/trezor/trezor-firmware/issues/1387 and CIP-3
+    return mnemonic_bits_len / 8;
+  }
+}
+
 /// def derive_icarus(
 ///     mnemonic: str,
 ///     passphrase: str,
@@ -46,19 +70,15 @@
 ///     """
 STATIC mp_obj_t mod_trezorcrypto_cardano_derive_icarus(size_t n_args,
                                                        const mp_obj_t *args) {
-  mp_buffer_info_t mnemo = {0}, phrase = {0};
-  mp_get_buffer_raise(args[0], &mnemo, MP_BUFFER_READ);
+  mp_buffer_info_t phrase = {0};
   mp_get_buffer_raise(args[1], &phrase, MP_BUFFER_READ);
-  const char *pmnemonic = mnemo.len > 0 ? mnemo.buf : "";
   const char *ppassphrase = phrase.len > 0 ? phrase.buf : "";
 
   bool trezor_derivation = mp_obj_is_true(args[2]);
 
   uint8_t mnemonic_bits[64] = {0};
-  int mnemonic_bits_len = mnemonic_to_bits(pmnemonic, mnemonic_bits);
-  if (mnemonic_bits_len == 0 || mnemonic_bits_len % 33 != 0) {
-    mp_raise_ValueError("Invalid mnemonic");
-  }
+  int mnemonic_bytes_used =
+      cardano_icarus_entropy(args[0], trezor_derivation, mnemonic_bits);
 
   vstr_t vstr = {0};
   vstr_init_len(&vstr, CARDANO_SECRET_LENGTH);
@@ -70,16 +90,6 @@ STATIC mp_obj_t mod_trezorcrypto_cardano_derive_icarus(size_t n_args,
     callback = wrapped_ui_wait_callback;
   }
 
-  int entropy_len = mnemonic_bits_len - mnemonic_bits_len / 33;
-  int mnemonic_bytes_used = 0;
-  if (!trezor_derivation) {
-    // Exclude checksum (original Icarus spec)
-    mnemonic_bytes_used = entropy_len / 8;
-  } else {
-    // Include checksum if it is a full byte (Trezor bug)
-    // see also https://github.com/trezor/trezor-firmware/issues/1387 and CIP-3
-    mnemonic_bytes_used = mnemonic_bits_len / 8;
-  }
   const int res = secret_from_entropy_cardano_icarus(
       (const uint8_t *)ppassphrase, phrase.len, mnemonic_bits,
       mnemonic_bytes_used, (uint8_t *)vstr.buf, callback);
@@ -98,6 +108,110 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
     mod_trezorcrypto_cardano_derive_icarus_obj, 3, 4,
     mod_trezorcrypto_cardano_derive_icarus);
 
+/// class icarus:
+///     """
+///     Context of an incremental Icarus derivation of a Cardano master secret,
+///     which allows to show the progress or to split the derivation.
+///     """
+///     ITERATIONS: int
+typedef struct _mp_obj_CardanoIcarus_t {
+  mp_obj_base_t base;
+  CARDANO_ICARUS_CTX ctx;
+} mp_obj_CardanoIcarus_t;
+
+/// def __init__(
+///     self,
+///     mnemonic: str,
+///     passphrase: str,
+///     trezor_derivation: bool,
+/// ) -> None:
+///     """
+///     Create an Icarus derivation context, see derive_icarus.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_CardanoIcarus_make_new(
+    const mp_obj_type_t *type, size_t n_args, size_t n_kw,
+    const mp_obj_t *args) {
+  mp_arg_check_num(n_args, n_kw, 3, 3, false);
+
+  mp_buffer_info_t phrase = {0};
+  mp_get_buffer_raise(args[1], &phrase, MP_BUFFER_READ);
+  const char *ppassphrase = phrase.len > 0 ? phrase.buf : "";
+
+  uint8_t mnemonic_bits[64] = {0};
+  int mnemonic_bytes_used =
+      cardano_icarus_entropy(args[0], mp_obj_is_true(args[2]), mnemonic_bits);
+
+  mp_obj_CardanoIcarus_t *o = m_new_obj_with_finaliser(mp_obj_CardanoIcarus_t);
+  o->base.type = type;
+  cardano_icarus_Init(&(o->ctx), (const uint8_t *)ppassphrase, phrase.len,
+                      mnemonic_bits, mnemonic_bytes_used);
+  memzero(mnemonic_bits, sizeof(mnemonic_bits));
+  return MP_OBJ_FROM_PTR(o);
+}
+
+/// def update(self, iterations: int) -> int:
+///     """
+///     Run at most the given number of iterations out of ITERATIONS, return
+///     the number of remaining iterations.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_CardanoIcarus_update(mp_obj_t self,
+                                                      mp_obj_t iterations) {
+  mp_obj_CardanoIcarus_t *o = MP_OBJ_TO_PTR(self);
+  uint32_t iter = trezor_obj_get_uint(iterations);
+  return mp_obj_new_int_from_uint(cardano_icarus_Update(&(o->ctx), iter));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_CardanoIcarus_update_obj,
+                                 mod_trezorcrypto_CardanoIcarus_update);
+
+/// def secret(self) -> bytes:
+///     """
+///     Run the remaining iterations and retrieve the derived master secret.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_CardanoIcarus_secret(mp_obj_t self) {
+  mp_obj_CardanoIcarus_t *o = MP_OBJ_TO_PTR(self);
+  // the remaining iterations are done on the context itself, so that they are
+  // not repeated by a second call
+  cardano_icarus_Update(&(o->ctx), CARDANO_ICARUS_ITERATIONS);
+  CARDANO_ICARUS_CTX ctx = {0};
+  memcpy(&ctx, &(o->ctx), sizeof(CARDANO_ICARUS_CTX));
+  vstr_t out = {0};
+  vstr_init_len(&out, CARDANO_SECRET_LENGTH);
+  cardano_icarus_Final(&ctx, (uint8_t *)out.buf);
+  memzero(&ctx, sizeof(CARDANO_ICARUS_CTX));
+  return mp_obj_new_str_from_vstr(&mp_type_bytes, &out);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_CardanoIcarus_secret_obj,
+                                 mod_trezorcrypto_CardanoIcarus_secret);
+
+STATIC mp_obj_t mod_trezorcrypto_CardanoIcarus___del__(mp_obj_t self) {
+  mp_obj_CardanoIcarus_t *o = MP_OBJ_TO_PTR(self);
+  memzero(&(o->ctx), sizeof(CARDANO_ICARUS_CTX));
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_CardanoIcarus___del___obj,
+                                 mod_trezorcrypto_CardanoIcarus___del__);
+
+STATIC const mp_rom_map_elem_t
+    mod_trezorcrypto_CardanoIcarus_locals_dict_table[] = {
+        {MP_ROM_QSTR(MP_QSTR_update),
+         MP_ROM_PTR(&mod_trezorcrypto_CardanoIcarus_update_obj)},
+        {MP_ROM_QSTR(MP_QSTR_secret),
+         MP_ROM_PTR(&mod_trezorcrypto_CardanoIcarus_secret_obj)},
+        {MP_ROM_QSTR(MP_QSTR___del__),
+         MP_ROM_PTR(&mod_trezorcrypto_CardanoIcarus___del___obj)},
+        {MP_ROM_QSTR(MP_QSTR_ITERATIONS),
+         MP_ROM_INT(CARDANO_ICARUS_ITERATIONS)},
+};
+STATIC MP_DEFINE_CONST_DICT(mod_trezorcrypto_CardanoIcarus_locals_dict,
+                            mod_trezorcrypto_CardanoIcarus_locals_dict_table);
+
+STATIC const mp_obj_type_t mod_trezorcrypto_CardanoIcarus_type = {
+    {&mp_type_type},
+    .name = MP_QSTR_icarus,
+    .make_new = mod_trezorcrypto_CardanoIcarus_make_new,
+    .locals_dict = (void *)&mod_trezorcrypto_CardanoIcarus_locals_dict,
+};
+
 /// def from_secret(secret: bytes) -> HDNode:
 ///     """
 ///     Creates a Cardano HD node from a master secret.
@@ -200,6 +314,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_cardano_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_cardano)},
     {MP_ROM_QSTR(MP_QSTR_derive_icarus),
      MP_ROM_PTR(&mod_trezorcrypto_cardano_derive_icarus_obj)},
+    {MP_ROM_QSTR(MP_QSTR_icarus),
+     MP_ROM_PTR(&mod_trezorcrypto_CardanoIcarus_type)},
     {MP_ROM_QSTR(MP_QSTR_from_secret),
      MP_ROM_PTR(&mod_trezorcrypto_from_secret_obj)},
     {MP_ROM_QSTR(MP_QSTR_from_seed_slip23),
@@ -163,6 +163,63 @@ STATIC mp_obj_t mod_trezorcrypto_ed25519_verify(mp_obj_t public_key,
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorcrypto_ed25519_verify_obj,
                                  mod_trezorcrypto_ed25519_verify);
 
+// number of signatures checked by a single multi-scalar multiplication
+#define VERIFY_BATCH_SIZE 4
+
+/// def verify_batch(
+///     public_keys: list[bytes], signatures: list[bytes], messages: list[bytes]
+/// ) -> bool:
+///     """
+///     Uses public keys to verify the signatures of the messages.
+///     Returns True if all of the signatures are valid.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_ed25519_verify_batch(mp_obj_t public_keys,
+                                                      mp_obj_t signatures,
+                                                      mp_obj_t messages) {
+  size_t n = 0, siglen = 0, msglen = 0;
+  mp_obj_t *pkitems = NULL, *sigitems = NULL, *msgitems = NULL;
+  mp_obj_get_array(public_keys, &n, &pkitems);
+  mp_obj_get_array(signatures, &siglen, &sigitems);
+  mp_obj_get_array(messages, &msglen, &msgitems);
+  if (siglen != n || msglen != n) {
+    mp_raise_ValueError("Lists must have the same length");
+  }
+  if (n == 0) {
+    return mp_const_true;
+  }
+  const unsigned char **pk = m_new(const unsigned char *, n);
+  const unsigned char **sig = m_new(const unsigned char *, n);
+  const unsigned char **msg = m_new(const unsigned char *, n);
+  size_t *mlen = m_new(size_t, n);
+  mp_buffer_info_t buf = {0};
+  bool ok = true;
+  for (size_t i = 0; i < n; i++) {
+    mp_get_buffer_raise(pkitems[i], &buf, MP_BUFFER_READ);
+    ok = ok && buf.len == 32;
+    pk[i] = buf.buf;
+    mp_get_buffer_raise(sigitems[i], &buf, MP_BUFFER_READ);
+    ok = ok && buf.len == 64;
+    sig[i] = buf.buf;
+    mp_get_buffer_raise(msgitems[i], &buf, MP_BUFFER_READ);
+    ok = ok && buf.len != 0;
+    msg[i] = buf.buf;
+    mlen[i] = buf.len;
+  }
+  if (ok) {
+    uint32_t scratch[ED25519_BATCH_SCRATCH_SIZE(VERIFY_BATCH_SIZE) /
+                     sizeof(uint32_t)];
+    ok = (0 == ed25519_sign_open_batch(msg, mlen, pk, sig, n, NULL, scratch,
+                                       sizeof(scratch)));
+  }
+  m_del(const unsigned char *, pk, n);
+  m_del(const unsigned char *, sig, n);
+  m_del(const unsigned char *, msg, n);
+  m_del(size_t, mlen, n);
+  return ok ? mp_const_true : mp_const_false;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mod_trezorcrypto_ed25519_verify_batch_obj,
+                                 mod_trezorcrypto_ed25519_verify_batch);
+
 /// def cosi_combine_publickeys(public_keys: list[bytes]) -> bytes:
 ///     """
 ///     Combines a list of public keys used in COSI cosigning scheme.
@@ -315,6 +372,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_ed25519_globals_table[] = {
 #endif
     {MP_ROM_QSTR(MP_QSTR_verify),
      MP_ROM_PTR(&mod_trezorcrypto_ed25519_verify_obj)},
+    {MP_ROM_QSTR(MP_QSTR_verify_batch),
+     MP_ROM_PTR(&mod_trezorcrypto_ed25519_verify_batch_obj)},
     {MP_ROM_QSTR(MP_QSTR_cosi_combine_publickeys),
      MP_ROM_PTR(&mod_trezorcrypto_ed25519_cosi_combine_publickeys_obj)},
     {MP_ROM_QSTR(MP_QSTR_cosi_combine_signatures),
@@ -233,6 +233,11 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(
 ///         Update hasher
 ///         """
 
+///     def uvarint(self, n: int) -> None:
+///         """
+///         Update hasher with the varint serialization of n
+///         """
+
 ///     def digest(self) -> bytes:
 ///         """
 ///         Computes digest
@@ -1072,6 +1077,42 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
     mod_trezorcrypto_monero_add_keys3_into_obj, 5, 5,
     mod_trezorcrypto_monero_add_keys3_into);
 
+/// def multi_scalarmult_into(
+///     r: Point | None, scalars: list[Scalar], points: list[Point]
+/// ) -> Point:
+///     """
+///     scalars[0] * points[0] + ... + scalars[n - 1] * points[n - 1]
+///     """
+STATIC mp_obj_t mod_trezorcrypto_monero_multi_scalarmult_into(
+    const mp_obj_t dest, const mp_obj_t scalars, const mp_obj_t points) {
+  size_t n = 0, n_points = 0;
+  mp_obj_t *scalar_items = NULL, *point_items = NULL;
+  mp_obj_get_array(scalars, &n, &scalar_items);
+  mp_obj_get_array(points, &n_points, &point_items);
+  if (n != n_points) {
+    mp_raise_ValueError("Different number of scalars and points");
+  }
+  for (size_t i = 0; i < n; i++) {
+    assert_scalar(scalar_items[i]);
+    assert_ge25519(point_items[i]);
+  }
+
+  mp_obj_t res = mp_obj_new_ge25519_r(dest);
+  bignum256modm *s = m_new(bignum256modm, n);
+  ge25519 *p = m_new(ge25519, n);
+  for (size_t i = 0; i < n; i++) {
+    memcpy(s[i], MP_OBJ_C_SCALAR(scalar_items[i]), sizeof(bignum256modm));
+    ge25519_copy(&p[i], &MP_OBJ_C_GE25519(point_items[i]));
+  }
+  ge25519_multi_scalarmult_vartime(&MP_OBJ_GE25519(res), n, s, p);
+  m_del(bignum256modm, s, n);
+  m_del(ge25519, p, n);
+  return res;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(
+    mod_trezorcrypto_monero_multi_scalarmult_into_obj,
+    mod_trezorcrypto_monero_multi_scalarmult_into);
+
 /// def xmr_get_subaddress_secret_key(
 ///     r: Scalar | None, major: int, minor: int, m: Scalar
 /// ) -> Scalar:
@@ -1141,6 +1182,15 @@ STATIC mp_obj_t mod_trezorcrypto_monero_hasher_update(mp_obj_t self,
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_monero_hasher_update_obj,
                                  mod_trezorcrypto_monero_hasher_update);
 
+STATIC mp_obj_t mod_trezorcrypto_monero_hasher_uvarint(mp_obj_t self,
+                                                       const mp_obj_t arg) {
+  mp_obj_hasher_t *o = MP_OBJ_TO_PTR(self);
+  xmr_hasher_update_varint(&o->h, trezor_obj_get_uint64(arg));
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_monero_hasher_uvarint_obj,
+                                 mod_trezorcrypto_monero_hasher_uvarint);
+
 STATIC mp_obj_t mod_trezorcrypto_monero_hasher_digest(size_t n_args,
                                                       const mp_obj_t *args) {
   mp_obj_hasher_t *o = MP_OBJ_TO_PTR(args[0]);
@@ -1176,7 +1226,7 @@ STATIC mp_obj_t mod_trezorcrypto_monero_hasher_copy(mp_obj_t self) {
   mp_obj_hasher_t *cp = m_new_obj_with_finaliser(mp_obj_hasher_t);
   cp->base.type = o->base.type;
   memcpy(&(cp->h), &(o->h), sizeof(Hasher));
-  return MP_OBJ_FROM_PTR(o);
+  return MP_OBJ_FROM_PTR(cp);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_monero_hasher_copy_obj,
                                  mod_trezorcrypto_monero_hasher_copy);
@@ -1220,6 +1270,8 @@ STATIC const mp_rom_map_elem_t
     mod_trezorcrypto_monero_hasher_locals_dict_table[] = {
         {MP_ROM_QSTR(MP_QSTR_update),
          MP_ROM_PTR(&mod_trezorcrypto_monero_hasher_update_obj)},
+        {MP_ROM_QSTR(MP_QSTR_uvarint),
+         MP_ROM_PTR(&mod_trezorcrypto_monero_hasher_uvarint_obj)},
         {MP_ROM_QSTR(MP_QSTR_digest),
          MP_ROM_PTR(&mod_trezorcrypto_monero_hasher_digest_obj)},
         {MP_ROM_QSTR(MP_QSTR_copy),
@@ -1234,7 +1286,7 @@ STATIC MP_DEFINE_CONST_DICT(mod_trezorcrypto_monero_hasher_locals_dict,
 
 STATIC const mp_obj_type_t mod_trezorcrypto_monero_hasher_type = {
     {&mp_type_type},
-    .name = MP_QSTR_hasher,
+    .name = MP_QSTR_Hasher,
     .make_new = mod_trezorcrypto_monero_hasher_make_new,
     .locals_dict = (void *)&mod_trezorcrypto_monero_hasher_locals_dict,
 };
@@ -2278,6 +2330,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_monero_globals_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_monero_ge25519_type)},
     {MP_ROM_QSTR(MP_QSTR_Scalar),
      MP_ROM_PTR(&mod_trezorcrypto_monero_bignum256modm_type)},
+    {MP_ROM_QSTR(MP_QSTR_Hasher),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_hasher_type)},
     // functions
     {MP_ROM_QSTR(MP_QSTR_sc_copy),
      MP_ROM_PTR(&mod_trezorcrypto_monero_sc_copy_obj)},
@@ -2354,6 +2408,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_monero_globals_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_monero_add_keys2_into_obj)},
     {MP_ROM_QSTR(MP_QSTR_add_keys3_into),
      MP_ROM_PTR(&mod_trezorcrypto_monero_add_keys3_into_obj)},
+    {MP_ROM_QSTR(MP_QSTR_multi_scalarmult_into),
+     MP_ROM_PTR(&mod_trezorcrypto_monero_multi_scalarmult_into_obj)},
     {MP_ROM_QSTR(MP_QSTR_xmr_get_subaddress_secret_key),
      MP_ROM_PTR(&mod_trezorcrypto_monero_xmr_get_subaddress_secret_key_obj)},
     {MP_ROM_QSTR(MP_QSTR_gen_commitment_into),
@@ -261,6 +261,88 @@ STATIC mp_obj_t mod_trezorcrypto_secp256k1_multiply(mp_obj_t secret_key,
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_secp256k1_multiply_obj,
                                  mod_trezorcrypto_secp256k1_multiply);
 
+/// def multiply_multi(scalars: list[bytes], public_keys: list[bytes]) -> bytes:
+///     """
+///     Computes the sum of the points defined by public_keys multiplied by the
+///     corresponding scalars. The computation doesn't run in constant time, so
+///     the scalars must not be secret. Returns an uncompressed point.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_secp256k1_multiply_multi(
+    mp_obj_t scalars, mp_obj_t public_keys) {
+  size_t n = 0, n_keys = 0;
+  mp_obj_t *scalar_items = NULL, *key_items = NULL;
+  mp_obj_get_array(scalars, &n, &scalar_items);
+  mp_obj_get_array(public_keys, &n_keys, &key_items);
+  if (n != n_keys) {
+    mp_raise_ValueError("Different number of scalars and public keys");
+  }
+
+  bignum256 *k = m_new(bignum256, n);
+  curve_point *p = m_new(curve_point, n);
+  for (size_t i = 0; i < n; i++) {
+    mp_buffer_info_t sk = {0}, pk = {0};
+    mp_get_buffer_raise(scalar_items[i], &sk, MP_BUFFER_READ);
+    mp_get_buffer_raise(key_items[i], &pk, MP_BUFFER_READ);
+    if (sk.len != 32) {
+      mp_raise_ValueError("Invalid length of scalar");
+    }
+    if (pk.len != 33 && pk.len != 65) {
+      mp_raise_ValueError("Invalid length of public key");
+    }
+    bn_read_be((const uint8_t *)sk.buf, &k[i]);
+    if (!ecdsa_read_pubkey(&secp256k1, (const uint8_t *)pk.buf, &p[i])) {
+      mp_raise_ValueError("Invalid public key");
+    }
+  }
+
+  curve_point res = {0};
+  int ret = point_multiply_multi(&secp256k1, n, k, p, &res);
+  m_del(bignum256, k, n);
+  m_del(curve_point, p, n);
+  if (ret != 0) {
+    mp_raise_ValueError("Invalid scalar");
+  }
+  if (point_is_infinity(&res)) {
+    mp_raise_ValueError("Point at infinity");
+  }
+
+  vstr_t out = {0};
+  vstr_init_len(&out, 65);
+  out.buf[0] = 0x04;
+  bn_write_be(&res.x, (uint8_t *)out.buf + 1);
+  bn_write_be(&res.y, (uint8_t *)out.buf + 33);
+  return mp_obj_new_str_from_vstr(&mp_type_bytes, &out);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_trezorcrypto_secp256k1_multiply_multi_obj,
+                                 mod_trezorcrypto_secp256k1_multiply_multi);
+
+/// def zkp_backend() -> bool:
+///     """
+///     Returns whether libsecp256k1-zkp is used as the implementation of the
+///     secp256k1 operations, which is never the case if it is not compiled in.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_secp256k1_zkp_backend(void) {
+  return mp_obj_new_bool(ecdsa_secp256k1_get_zkp());
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(mod_trezorcrypto_secp256k1_zkp_backend_obj,
+                                 mod_trezorcrypto_secp256k1_zkp_backend);
+
+#if PYOPT == 0
+/// def set_zkp_backend(enabled: bool) -> None:
+///     """
+///     Selects libsecp256k1-zkp (True) or trezor-crypto (False) as the
+///     implementation of the secp256k1 operations, has no effect if
+///     libsecp256k1-zkp is not compiled in.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_secp256k1_set_zkp_backend(mp_obj_t enabled) {
+  ecdsa_secp256k1_set_zkp(mp_obj_is_true(enabled));
+  return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(
+    mod_trezorcrypto_secp256k1_set_zkp_backend_obj,
+    mod_trezorcrypto_secp256k1_set_zkp_backend);
+#endif
+
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_secp256k1_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_secp256k1)},
     {MP_ROM_QSTR(MP_QSTR_generate_secret),
@@ -275,6 +357,14 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_secp256k1_globals_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_secp256k1_verify_recover_obj)},
     {MP_ROM_QSTR(MP_QSTR_multiply),
      MP_ROM_PTR(&mod_trezorcrypto_secp256k1_multiply_obj)},
+    {MP_ROM_QSTR(MP_QSTR_multiply_multi),
+     MP_ROM_PTR(&mod_trezorcrypto_secp256k1_multiply_multi_obj)},
+    {MP_ROM_QSTR(MP_QSTR_zkp_backend),
+     MP_ROM_PTR(&mod_trezorcrypto_secp256k1_zkp_backend_obj)},
+#if PYOPT == 0
+    {MP_ROM_QSTR(MP_QSTR_set_zkp_backend),
+     MP_ROM_PTR(&mod_trezorcrypto_secp256k1_set_zkp_backend_obj)},
+#endif
 #if !BITCOIN_ONLY
     {MP_ROM_QSTR(MP_QSTR_CANONICAL_SIG_ETHEREUM),
      MP_ROM_INT(CANONICAL_SIG_ETHEREUM)},
@@ -88,6 +88,20 @@ STATIC mp_obj_t mod_trezorcrypto_Sha256_digest(mp_obj_t self) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Sha256_digest_obj,
                                  mod_trezorcrypto_Sha256_digest);
 
+/// def copy(self) -> sha256:
+///     """
+///     Returns the copy of the digest object with the current state
+///     """
+STATIC mp_obj_t mod_trezorcrypto_Sha256_copy(mp_obj_t self) {
+  mp_obj_Sha256_t *o = MP_OBJ_TO_PTR(self);
+  mp_obj_Sha256_t *out = m_new_obj_with_finaliser(mp_obj_Sha256_t);
+  out->base.type = o->base.type;
+  memcpy(&(out->ctx), &(o->ctx), sizeof(SHA256_CTX));
+  return MP_OBJ_FROM_PTR(out);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_Sha256_copy_obj,
+                                 mod_trezorcrypto_Sha256_copy);
+
 STATIC mp_obj_t mod_trezorcrypto_Sha256___del__(mp_obj_t self) {
   mp_obj_Sha256_t *o = MP_OBJ_TO_PTR(self);
   memzero(&(o->ctx), sizeof(SHA256_CTX));
@@ -101,6 +115,8 @@ STATIC const mp_rom_map_elem_t mod_trezorcrypto_Sha256_locals_dict_table[] = {
      MP_ROM_PTR(&mod_trezorcrypto_Sha256_update_obj)},
     {MP_ROM_QSTR(MP_QSTR_digest),
      MP_ROM_PTR(&mod_trezorcrypto_Sha256_digest_obj)},
+    {MP_ROM_QSTR(MP_QSTR_copy),
+     MP_ROM_PTR(&mod_trezorcrypto_Sha256_copy_obj)},
     {MP_ROM_QSTR(MP_QSTR___del__),
      MP_ROM_PTR(&mod_trezorcrypto_Sha256___del___obj)},
     {MP_ROM_QSTR(MP_QSTR_block_size), MP_ROM_INT(SHA256_BLOCK_LENGTH)},
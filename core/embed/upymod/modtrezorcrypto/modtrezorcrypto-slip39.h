@@ -20,6 +20,8 @@
 #include "py/obj.h"
 #include "py/runtime.h"
 
+#include "embed/upymod/trezorobj.h"
+
 #include "slip39.h"
 
 /// package: trezorcrypto.slip39
@@ -61,12 +63,44 @@ STATIC mp_obj_t mod_trezorcrypto_slip39_get_word(mp_obj_t _index) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_trezorcrypto_slip39_get_word_obj,
                                  mod_trezorcrypto_slip39_get_word);
 
+/// def rs1024_polymod(values: tuple[int, ...], chk: int = 1) -> int:
+///     """
+///     Updates the RS1024 checksum state 'chk' with the 10-bit 'values' and
+///     returns the new state.
+///     """
+STATIC mp_obj_t mod_trezorcrypto_slip39_rs1024_polymod(size_t n_args,
+                                                       const mp_obj_t *args) {
+  size_t count = 0;
+  mp_obj_t *items = NULL;
+  mp_obj_get_array(args[0], &count, &items);
+  uint32_t chk = 1;
+  if (n_args > 1) {
+    chk = trezor_obj_get_uint(args[1]);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    mp_uint_t value = trezor_obj_get_uint(items[i]);
+    if (value > 1023) {
+      mp_raise_ValueError(
+          "Invalid value (range between 0 and 1023 is allowed)");
+    }
+    chk = slip39_rs1024_polymod_update(chk, value);
+  }
+
+  return mp_obj_new_int_from_uint(chk);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(
+    mod_trezorcrypto_slip39_rs1024_polymod_obj, 1, 2,
+    mod_trezorcrypto_slip39_rs1024_polymod);
+
 STATIC const mp_rom_map_elem_t mod_trezorcrypto_slip39_globals_table[] = {
     {MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_slip39)},
     {MP_ROM_QSTR(MP_QSTR_word_index),
      MP_ROM_PTR(&mod_trezorcrypto_slip39_word_index_obj)},
     {MP_ROM_QSTR(MP_QSTR_get_word),
      MP_ROM_PTR(&mod_trezorcrypto_slip39_get_word_obj)},
+    {MP_ROM_QSTR(MP_QSTR_rs1024_polymod),
+     MP_ROM_PTR(&mod_trezorcrypto_slip39_rs1024_polymod_obj)},
 };
 STATIC MP_DEFINE_CONST_DICT(mod_trezorcrypto_slip39_globals,
                             mod_trezorcrypto_slip39_globals_table);
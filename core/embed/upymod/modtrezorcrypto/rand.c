@@ -21,3 +21,5 @@
 #include <sec/rng.h>
 
 uint32_t random32(void) { return rng_get(); }
+
+void random_buffer(uint8_t *buf, size_t len) { rng_fill_buffer(buf, len); }
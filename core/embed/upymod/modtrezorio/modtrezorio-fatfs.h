@@ -18,6 +18,7 @@
  */
 
 #include "embed/upymod/trezorobj.h"
+#include "memzero.h"
 #include "py/mperrno.h"
 #include "py/objstr.h"
 
@@ -93,22 +94,54 @@ DSTATUS disk_status(BYTE pdrv) {
   return (sectrue == sdcard_is_present()) ? 0 : (STA_NOINIT | STA_NODISK);
 }
 
+// f_read and f_write transfer whole sectors straight between the card and the
+// buffer of the caller, which does not have to be word aligned as the SD card
+// DMA requires. Such buffers go through an aligned one, a sector at a time.
+
 DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count) {
   (void)pdrv;
-  if (sectrue == sdcard_read_blocks((uint32_t *)buff, sector, count)) {
-    return RES_OK;
-  } else {
-    return RES_ERROR;
+  if (((uintptr_t)buff & 3) == 0) {
+    if (sectrue == sdcard_read_blocks((uint32_t *)buff, sector, count)) {
+      return RES_OK;
+    } else {
+      return RES_ERROR;
+    }
+  }
+
+  uint32_t block[SDCARD_BLOCK_SIZE / sizeof(uint32_t)];
+  DRESULT res = RES_OK;
+  for (UINT i = 0; i < count; i++) {
+    if (sectrue != sdcard_read_blocks(block, sector + i, 1)) {
+      res = RES_ERROR;
+      break;
+    }
+    memcpy(buff + i * SDCARD_BLOCK_SIZE, block, SDCARD_BLOCK_SIZE);
   }
+  memzero(block, sizeof(block));
+  return res;
 }
 
 DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) {
   (void)pdrv;
-  if (sectrue == sdcard_write_blocks((const uint32_t *)buff, sector, count)) {
-    return RES_OK;
-  } else {
-    return RES_ERROR;
+  if (((uintptr_t)buff & 3) == 0) {
+    if (sectrue == sdcard_write_blocks((const uint32_t *)buff, sector, count)) {
+      return RES_OK;
+    } else {
+      return RES_ERROR;
+    }
+  }
+
+  uint32_t block[SDCARD_BLOCK_SIZE / sizeof(uint32_t)];
+  DRESULT res = RES_OK;
+  for (UINT i = 0; i < count; i++) {
+    memcpy(block, buff + i * SDCARD_BLOCK_SIZE, SDCARD_BLOCK_SIZE);
+    if (sectrue != sdcard_write_blocks(block, sector + i, 1)) {
+      res = RES_ERROR;
+      break;
+    }
   }
+  memzero(block, sizeof(block));
+  return res;
 }
 
 DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff) {
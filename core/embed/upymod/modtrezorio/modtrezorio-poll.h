@@ -33,6 +33,10 @@
 
 #include "embed/upymod/trezorobj.h"
 
+#ifdef USE_SECP256K1_ZKP
+#include "zkp_context.h"
+#endif
+
 #ifdef TREZOR_EMULATOR
 #include "SDL.h"
 #endif
@@ -46,6 +50,9 @@
 #define POLL_READ (0x0000)
 #define POLL_WRITE (0x0100)
 
+// Maximal number of interfaces `poll` waits for at once
+#define POLL_MAX_IFACES (64)
+
 extern uint32_t last_touch_sample_time;
 
 /// package: trezorio.__init__
@@ -82,23 +89,34 @@ STATIC mp_obj_t mod_trezorio_poll(mp_obj_t ifaces, mp_obj_t list_ref,
   // result will come out correct.
   const mp_uint_t timeout = trezor_obj_get_int(timeout_ms);
   const mp_uint_t deadline = mp_hal_ticks_ms() + timeout;
+
+  // The interfaces are read only once, the loop below checks them again after
+  // every wake-up of the CPU
+  mp_uint_t items[POLL_MAX_IFACES];
+  size_t item_count = 0;
   mp_obj_iter_buf_t iterbuf = {0};
+  mp_obj_t iter = mp_getiter(ifaces, &iterbuf);
+  mp_obj_t item = 0;
+  while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+    if (item_count >= POLL_MAX_IFACES) {
+      mp_raise_ValueError("too many interfaces");
+    }
+    items[item_count++] = trezor_obj_get_uint(item);
+  }
 
   for (;;) {
-    mp_obj_t iter = mp_getiter(ifaces, &iterbuf);
-    mp_obj_t item = 0;
-    while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
-      const mp_uint_t i = trezor_obj_get_uint(item);
-      const mp_uint_t iface = i & 0x00FF;
-      const mp_uint_t mode = i & 0xFF00;
-
 #if defined TREZOR_EMULATOR
-      // Ensures that SDL events are processed even if the ifaces list
-      // contains only USB interfaces. This prevents the emulator from
-      // freezing when the user interacts with the window.
-      SDL_PumpEvents();
+    // Ensures that SDL events are processed even if the ifaces list
+    // contains only USB interfaces. This prevents the emulator from
+    // freezing when the user interacts with the window.
+    SDL_PumpEvents();
 #endif
 
+    for (size_t k = 0; k < item_count; k++) {
+      const mp_uint_t i = items[k];
+      const mp_uint_t iface = i & 0x00FF;
+      const mp_uint_t mode = i & 0xFF00;
+
       if (false) {
       }
 #if defined USE_TOUCH
@@ -220,6 +238,10 @@ STATIC mp_obj_t mod_trezorio_poll(mp_obj_t ifaces, mp_obj_t list_ref,
     if (mp_hal_ticks_ms() >= deadline) {
       break;
     } else {
+#ifdef USE_SECP256K1_ZKP
+      // re-randomize the context off the critical path of the next signing
+      zkp_context_refresh();
+#endif
       MICROPY_EVENT_POLL_HOOK
     }
   }
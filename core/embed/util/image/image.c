@@ -42,6 +42,20 @@ static const uint8_t * const BOOTLOADER_KEYS[] = {
 #endif
 };
 
+// number of the last combined keys kept by compute_pubkey, the boot and the
+// upload paths check the signatures of the same headers repeatedly
+#define COMBINED_KEY_CACHE_SIZE 2
+
+typedef struct {
+  uint8_t sig_m;
+  ed25519_public_key keys[MAX_VENDOR_PUBLIC_KEYS];
+  ed25519_public_key res;
+} combined_key_t;
+
+// the first combined_key_count entries, most recently used first
+static combined_key_t combined_key_cache[COMBINED_KEY_CACHE_SIZE];
+static size_t combined_key_count = 0;
+
 static secbool compute_pubkey(uint8_t sig_m, uint8_t sig_n,
                               const uint8_t *const *pub, uint8_t sigmask,
                               ed25519_public_key res) {
@@ -54,16 +68,54 @@ static secbool compute_pubkey(uint8_t sig_m, uint8_t sig_n,
   // remove if number of set bits in sigmask is not equal to sig_m
   if (__builtin_popcount(sigmask) != sig_m) return secfalse;
 
-  ed25519_public_key keys[sig_m];
+  // sigmask has 8 bits, so sig_m <= MAX_VENDOR_PUBLIC_KEYS
+  combined_key_t entry = {.sig_m = sig_m};
   int j = 0;
   for (int i = 0; i < sig_n; i++) {
     if ((1 << i) & sigmask) {
-      memcpy(keys[j], pub[i], 32);
+      memcpy(entry.keys[j], pub[i], 32);
       j++;
     }
   }
 
-  return sectrue * (0 == ed25519_cosi_combine_publickeys(res, keys, sig_m));
+  for (size_t i = 0; i < combined_key_count; i++) {
+    if (combined_key_cache[i].sig_m == sig_m &&
+        0 == memcmp(combined_key_cache[i].keys, entry.keys,
+                    sig_m * sizeof(ed25519_public_key))) {
+      entry = combined_key_cache[i];
+      memmove(&combined_key_cache[1], &combined_key_cache[0],
+              i * sizeof(combined_key_t));
+      combined_key_cache[0] = entry;
+      memcpy(res, entry.res, sizeof(ed25519_public_key));
+      return sectrue;
+    }
+  }
+
+  if (0 != ed25519_cosi_combine_publickeys(entry.res, entry.keys, sig_m)) {
+    return secfalse;
+  }
+
+  if (combined_key_count < COMBINED_KEY_CACHE_SIZE) {
+    combined_key_count++;
+  }
+  memmove(&combined_key_cache[1], &combined_key_cache[0],
+          (combined_key_count - 1) * sizeof(combined_key_t));
+  combined_key_cache[0] = entry;
+  memcpy(res, entry.res, sizeof(ed25519_public_key));
+  return sectrue;
+}
+
+static secbool verify_signature(const uint8_t *hash,
+                                const ed25519_public_key pub,
+                                const uint8_t *sig) {
+  // the combined keys of the same signers are checked repeatedly, the
+  // expansion is cached and saves their decompression
+  ed25519_public_key_expanded pub_expanded;
+  if (0 != ed25519_public_key_expand(&pub_expanded, pub)) return secfalse;
+
+  return sectrue * (0 == ed25519_sign_open_expanded(
+                             hash, IMAGE_HASH_DIGEST_LENGTH, &pub_expanded,
+                             *(const ed25519_signature *)sig));
 }
 
 const image_header *read_image_header(const uint8_t *const data,
@@ -142,9 +194,7 @@ secbool check_image_header_sig(const image_header *const hdr, uint8_t key_m,
   if (sectrue != compute_pubkey(key_m, key_n, keys, hdr->sigmask, pub))
     return secfalse;
 
-  return sectrue *
-         (0 == ed25519_sign_open(fingerprint, IMAGE_HASH_DIGEST_LENGTH, pub,
-                                 *(const ed25519_signature *)hdr->sig));
+  return verify_signature(fingerprint, pub, hdr->sig);
 }
 
 secbool __wur read_vendor_header(const uint8_t *const data,
@@ -229,9 +279,7 @@ secbool check_vendor_header_sig(const vendor_header *const vhdr, uint8_t key_m,
   if (sectrue != compute_pubkey(key_m, key_n, keys, vhdr->sigmask, pub))
     return secfalse;
 
-  return sectrue *
-         (0 == ed25519_sign_open(hash, IMAGE_HASH_DIGEST_LENGTH, pub,
-                                 *(const ed25519_signature *)vhdr->sig));
+  return verify_signature(hash, pub, vhdr->sig);
 }
 
 secbool check_vendor_header_keys(const vendor_header *const vhdr) {
@@ -39,12 +39,14 @@ void tsqueue_init(tsqueue_t *queue, tsqueue_entry_t *entries,
   irq_unlock(key);
 }
 
-static void tsqueue_entry_reset(tsqueue_entry_t *entry, uint32_t data_size) {
+// Only the first `len` bytes of the buffer are cleared, the rest of it is
+// zero since the queue was reset
+static void tsqueue_entry_reset(tsqueue_entry_t *entry) {
+  memset(entry->buffer, 0, entry->len);
   entry->len = 0;
   entry->used = 0;
   entry->aborted = false;
   entry->id = 0;
-  memset(entry->buffer, 0, data_size);
 }
 
 void tsqueue_reset(tsqueue_t *queue) {
@@ -54,7 +56,8 @@ void tsqueue_reset(tsqueue_t *queue) {
   queue->next_id = 1;
 
   for (int i = 0; i < queue->qlen; i++) {
-    tsqueue_entry_reset(&queue->entries[i], queue->size);
+    queue->entries[i].len = queue->size;
+    tsqueue_entry_reset(&queue->entries[i]);
   }
 
   irq_unlock(key);
@@ -102,7 +105,7 @@ bool tsqueue_enqueue(tsqueue_t *queue, const uint8_t *data, uint16_t len,
 
 static void tsqueue_discard_aborted(tsqueue_t *queue) {
   while (queue->entries[queue->rix].aborted) {
-    tsqueue_entry_reset(&queue->entries[queue->rix], queue->size);
+    tsqueue_entry_reset(&queue->entries[queue->rix]);
     queue->rix = (queue->rix + 1) % queue->qlen;
   }
 }
@@ -129,7 +132,7 @@ bool tsqueue_dequeue(tsqueue_t *queue, uint8_t *data, uint16_t max_len,
   memcpy(data, queue->entries[queue->rix].buffer,
          MIN(queue->entries[queue->rix].len, max_len));
 
-  tsqueue_entry_reset(queue->entries + queue->rix, queue->size);
+  tsqueue_entry_reset(queue->entries + queue->rix);
   queue->rix = (queue->rix + 1) % queue->qlen;
 
   tsqueue_discard_aborted(queue);
@@ -110,6 +110,7 @@ def _from_env(name: str) -> bool:
 @click.option("--executable", type=click.Path(exists=True, dir_okay=False), default=os.environ.get("MICROPYTHON"), help="Alternate emulator executable")
 @click.option("-g", "--profiling/--no-profiling", default=_from_env("TREZOR_PROFILING"), help="Run with profiler wrapper")
 @click.option("-G", "--alloc-profiling/--no-alloc-profiling", default=_from_env("TREZOR_MEMPERF"), help="Profile memory allocation (requires special micropython build)")
+@click.option("-T", "--time-profiling/--no-time-profiling", default=_from_env("TREZOR_TIMEPERF"), help="Profile time spent on each line")
 @click.option("-h", "--headless", is_flag=True, help="Headless mode (no display, disables animation)")
 @click.option("--heap-size", metavar="SIZE", default="20M", help="Configure heap size")
 @click.option("--main", help="Path to python main file")
@@ -137,6 +138,7 @@ def cli(
     executable: str | Path,
     profiling: bool,
     alloc_profiling: bool,
+    time_profiling: bool,
     headless: bool,
     heap_size: str,
     main: str,
@@ -183,7 +185,7 @@ def cli(
     if watch and inotify is None:
         raise click.ClickException("inotify module is missing, install with pip")
 
-    if main and (profiling or alloc_profiling):
+    if main and (profiling or alloc_profiling or time_profiling):
         raise click.ClickException("Cannot use --main and -g together")
 
     if slip0014 and mnemonics:
@@ -198,7 +200,7 @@ def cli(
     if mnemonics and production:
         raise click.ClickException("Cannot load mnemonics in production mode")
 
-    if profiling or alloc_profiling:
+    if profiling or alloc_profiling or time_profiling:
         main_args = [str(PROFILING_WRAPPER)]
     elif main:
         main_args = [main]
@@ -267,6 +269,9 @@ def cli(
     if alloc_profiling:
         os.environ["TREZOR_MEMPERF"] = "1"
 
+    if time_profiling:
+        os.environ["TREZOR_TIMEPERF"] = "1"
+
     if debugger or valgrind:
         run_debugger(emulator, script_gdb_file, valgrind, command)
         raise RuntimeError("run_debugger should not return")
@@ -358,6 +358,11 @@ class sha256:
         Returns the digest of hashed data.
         """
 
+    def copy(self) -> sha256:
+        """
+        Returns the copy of the digest object with the current state
+        """
+
 
 # upymod/modtrezorcrypto/modtrezorcrypto-sha3-256.h
 class sha3_256:
@@ -81,6 +81,12 @@ class HDNode:
         Compute a base58-encoded address string from the HD node.
         """
 
+    def addresses(self, version: int, start: int, count: int) -> list[str]:
+        """
+        Compute the base58-encoded address strings of the non-hardened
+        children start, ..., start + count - 1 of the HD node.
+        """
+
     def nem_address(self, network: int) -> str:
         """
         Compute a NEM address string from the HD node.
@@ -17,6 +17,36 @@ def derive_icarus(
     """
 
 
+# upymod/modtrezorcrypto/modtrezorcrypto-cardano.h
+class icarus:
+    """
+    Context of an incremental Icarus derivation of a Cardano master secret,
+    which allows to show the progress or to split the derivation.
+    """
+    ITERATIONS: int
+
+    def __init__(
+        self,
+        mnemonic: str,
+        passphrase: str,
+        trezor_derivation: bool,
+    ) -> None:
+        """
+        Create an Icarus derivation context, see derive_icarus.
+        """
+
+    def update(self, iterations: int) -> int:
+        """
+        Run at most the given number of iterations out of ITERATIONS, return
+        the number of remaining iterations.
+        """
+
+    def secret(self) -> bytes:
+        """
+        Run the remaining iterations and retrieve the derived master secret.
+        """
+
+
 # upymod/modtrezorcrypto/modtrezorcrypto-cardano.h
 def from_secret(secret: bytes) -> HDNode:
     """
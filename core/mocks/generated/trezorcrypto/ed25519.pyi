@@ -39,6 +39,16 @@ def verify(public_key: bytes, signature: bytes, message: bytes) -> bool:
     """
 
 
+# upymod/modtrezorcrypto/modtrezorcrypto-ed25519.h
+def verify_batch(
+    public_keys: list[bytes], signatures: list[bytes], messages: list[bytes]
+) -> bool:
+    """
+    Uses public keys to verify the signatures of the messages.
+    Returns True if all of the signatures are valid.
+    """
+
+
 # upymod/modtrezorcrypto/modtrezorcrypto-ed25519.h
 def cosi_combine_publickeys(public_keys: list[bytes]) -> bytes:
     """
@@ -36,6 +36,10 @@ class Hasher:
         """
         Update hasher
         """
+    def uvarint(self, n: int) -> None:
+        """
+        Update hasher with the varint serialization of n
+        """
     def digest(self) -> bytes:
         """
         Computes digest
@@ -353,6 +357,15 @@ def add_keys3_into(
     """
 
 
+# upymod/modtrezorcrypto/modtrezorcrypto-monero.h
+def multi_scalarmult_into(
+    r: Point | None, scalars: list[Scalar], points: list[Point]
+) -> Point:
+    """
+    scalars[0] * points[0] + ... + scalars[n - 1] * points[n - 1]
+    """
+
+
 # upymod/modtrezorcrypto/modtrezorcrypto-monero.h
 def xmr_get_subaddress_secret_key(
     r: Scalar | None, major: int, minor: int, m: Scalar
@@ -51,3 +51,29 @@ def multiply(secret_key: bytes, public_key: bytes) -> bytes:
     Multiplies point defined by public_key with scalar defined by
     secret_key. Useful for ECDH.
     """
+
+
+# upymod/modtrezorcrypto/modtrezorcrypto-secp256k1.h
+def multiply_multi(scalars: list[bytes], public_keys: list[bytes]) -> bytes:
+    """
+    Computes the sum of the points defined by public_keys multiplied by the
+    corresponding scalars. The computation doesn't run in constant time, so
+    the scalars must not be secret. Returns an uncompressed point.
+    """
+
+
+# upymod/modtrezorcrypto/modtrezorcrypto-secp256k1.h
+def zkp_backend() -> bool:
+    """
+    Returns whether libsecp256k1-zkp is used as the implementation of the
+    secp256k1 operations, which is never the case if it is not compiled in.
+    """
+
+
+# upymod/modtrezorcrypto/modtrezorcrypto-secp256k1.h
+def set_zkp_backend(enabled: bool) -> None:
+    """
+    Selects libsecp256k1-zkp (True) or trezor-crypto (False) as the
+    implementation of the secp256k1 operations, has no effect if
+    libsecp256k1-zkp is not compiled in.
+    """
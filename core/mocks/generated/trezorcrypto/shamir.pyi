@@ -13,3 +13,20 @@ def interpolate(shares: list[tuple[int, bytes]], x: int) -> bytes:
     :return: Evaluations of the polynomials in x.
     :rtype: Array of bytes.
     """
+
+
+# upymod/modtrezorcrypto/modtrezorcrypto-shamir.h
+def interpolate_multi(
+    shares: list[tuple[int, bytes]], xs: list[int]
+) -> list[bytes]:
+    """
+    Returns [f(x) for x in xs] given the Shamir shares (x_1, f(x_1)), ... ,
+    (x_k, f(x_k)). Faster than calling interpolate for each x.
+    :param shares: The Shamir shares.
+    :type shares: A list of pairs (x_i, y_i), where x_i is an integer and
+        y_i is an array of bytes representing the evaluations of the
+        polynomials in x_i.
+    :param xs: The x coordinates of the results.
+    :return: Evaluations of the polynomials in each x.
+    :rtype: List of arrays of bytes.
+    """
@@ -14,3 +14,11 @@ def get_word(index: int) -> str:
     """
     Returns word on position 'index'.
     """
+
+
+# upymod/modtrezorcrypto/modtrezorcrypto-slip39.h
+def rs1024_polymod(values: tuple[int, ...], chk: int = 1) -> int:
+    """
+    Updates the RS1024 checksum state 'chk' with the 10-bit 'values' and
+    returns the new state.
+    """
@@ -3,6 +3,7 @@ import sys
 from uio import open
 from uos import getenv
 import micropython
+import utime
 
 # We need to insert "" to sys.path so that the frozen build can import main from the
 # frozen modules, and regular build can import it from current directory.
@@ -107,6 +108,51 @@ class AllocCounter:
         self.dump_data("alloc_data.txt")
 
 
+class TimeCounter:
+    """Measures the time spent on each line, without the Python functions called
+    from it. A native function, e.g. from trezor.crypto, has no trace events, so
+    its time is counted on the line calling it.
+    """
+
+    def __init__(self):
+        self.data = {}
+        self.last_line = None
+        self.last_ticks = utime.ticks_us()
+
+    def trace_tick(self, frame, event, arg):
+        now = utime.ticks_us()
+
+        if self.last_line is not None:
+            entry = self.data.setdefault(self.last_line, [0, 0])
+            entry[0] += utime.ticks_diff(now, self.last_ticks)
+
+        if event == "return":
+            # continue on the calling line
+            frame = frame.f_back
+
+        if frame is None:
+            self.last_line = None
+        else:
+            code = frame.f_code
+            self.last_line = (code.co_filename, frame.f_lineno, code.co_name)
+            if event == "line":
+                self.data.setdefault(self.last_line, [0, 0])[1] += 1
+
+        # do not count the time spent in the trace handler
+        self.last_ticks = utime.ticks_us()
+
+    def write_data(self):
+        worker_id = getenv("PYTEST_XDIST_WORKER")
+        if worker_id:
+            file_name = f"time_data.{worker_id}.txt"
+        else:
+            file_name = "time_data.txt"
+        # append, so that the data of multiple emulator runs add up
+        with open(file_name, "a") as f:
+            for (filename, lineno, name), (us, hits) in self.data.items():
+                f.write(f"{PATH_PREFIX}{filename}:{lineno} {name} {us} {hits}\n")
+
+
 def trace_handler(frame, event, arg):
     __prof__.trace_tick(frame, event, arg)
     return trace_handler
@@ -123,6 +169,8 @@ global __prof__
 if not "__prof__" in globals():
     if getenv("TREZOR_MEMPERF") == "1":
         __prof__ = AllocCounter()
+    elif getenv("TREZOR_TIMEPERF") == "1":
+        __prof__ = TimeCounter()
     else:
         __prof__ = _Prof()
 
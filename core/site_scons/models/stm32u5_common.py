@@ -7,6 +7,7 @@ def stm32u5_common_files(env, defines, sources, paths):
         ("FLASH_BLOCK_WORDS", "4"),
         ("USE_TRUSTZONE", "1"),
         ("CONFIDENTIAL", '__attribute__((section(".confidential")))'),
+        ("USE_SHA256_HW", "1"),
     ]
 
     paths += [
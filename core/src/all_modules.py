@@ -239,6 +239,8 @@ apps.benchmark.common
 import apps.benchmark.common
 apps.benchmark.curve_benchmark
 import apps.benchmark.curve_benchmark
+apps.benchmark.derivation_benchmark
+import apps.benchmark.derivation_benchmark
 apps.benchmark.hash_benchmark
 import apps.benchmark.hash_benchmark
 apps.benchmark.list_names
@@ -21,6 +21,7 @@ from .curve_benchmark import (
     SignBenchmark,
     VerifyBenchmark,
 )
+from .derivation_benchmark import DerivePathBenchmark, SeedBenchmark
 from .hash_benchmark import HashBenchmark
 
 
@@ -92,4 +93,6 @@ benchmarks = {
     "crypto/curve/ed25519/publickey": PublickeyBenchmark(ed25519),
     "crypto/curve/curve25519/publickey": PublickeyBenchmark(curve25519),
     "crypto/curve/curve25519/multiply": MultiplyBenchmark(curve25519),
+    "crypto/bip39/seed": SeedBenchmark(),
+    "crypto/bip32/derive_path": DerivePathBenchmark(),
 }
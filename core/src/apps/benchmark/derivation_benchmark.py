@@ -0,0 +1,40 @@
+from trezor.crypto import bip32, bip39
+from trezor.messages import BenchmarkResult
+
+from .common import format_float, random_bytes
+
+# m/84'/0'/0'/0/0, a typical Bitcoin address path
+_PATH = (0x8000_0054, 0x8000_0000, 0x8000_0000, 0, 0)
+
+
+class SeedBenchmark:
+    def prepare(self) -> None:
+        self.iterations_count = 1
+        self.mnemonic = bip39.from_data(random_bytes(16))
+        self.passphrase = "passphrase"
+
+    def run(self) -> None:
+        for _ in range(self.iterations_count):
+            bip39.seed(self.mnemonic, self.passphrase)
+
+    def get_result(self, duration_us: int, repetitions: int) -> BenchmarkResult:
+        value = duration_us / (repetitions * self.iterations_count * 1000)
+
+        return BenchmarkResult(value=format_float(value), unit="ms")
+
+
+class DerivePathBenchmark:
+    def prepare(self) -> None:
+        self.iterations_count = 10
+        self.seed = random_bytes(64)
+
+    def run(self) -> None:
+        for _ in range(self.iterations_count):
+            node = bip32.from_seed(self.seed, "secp256k1")
+            node.derive_path(_PATH)
+            node.public_key()
+
+    def get_result(self, duration_us: int, repetitions: int) -> BenchmarkResult:
+        value = duration_us / (repetitions * self.iterations_count * 1000)
+
+        return BenchmarkResult(value=format_float(value), unit="ms")
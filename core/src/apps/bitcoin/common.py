@@ -11,8 +11,8 @@ if TYPE_CHECKING:
     from enum import IntEnum
 
     from trezor.crypto import bip32
+    from trezor.crypto.hashlib import sha256
     from trezor.messages import TxInput
-    from trezor.utils import HashWriter
 
     from apps.common.coininfo import CoinInfo
 else:
@@ -191,14 +191,13 @@ def input_is_external_unverified(txi: TxInput) -> bool:
     )
 
 
-def tagged_hashwriter(tag: bytes) -> HashWriter:
+def tagged_sha256(tag: bytes) -> sha256:
     from trezor.crypto.hashlib import sha256
-    from trezor.utils import HashWriter
 
     tag_digest = sha256(tag).digest()
     ctx = sha256(tag_digest)
     ctx.update(tag_digest)
-    return HashWriter(ctx)
+    return ctx
 
 
 def format_fee_rate(
@@ -38,6 +38,9 @@ if TYPE_CHECKING:
 _MAX_SERIALIZED_CHUNK_SIZE = const(2048)
 _SERIALIZED_TX_BUFFER = empty_bytearray(_MAX_SERIALIZED_CHUNK_SIZE)
 
+# the number of change addresses remembered by output_derive_script
+_CHANGE_ADDRESS_CACHE_SIZE = const(8)
+
 
 class Bitcoin:
     def init_signing(self) -> None:
@@ -164,6 +167,11 @@ class Bitcoin:
         # The index of the payment request being processed.
         self.payment_req_index: int | None = None
 
+        # Addresses of recently derived change outputs as (address_n, script_type,
+        # address). Each output script is computed in several steps of the signing
+        # and in every legacy input digest, this avoids deriving the keys again.
+        self.change_addresses: list[tuple[Sequence[int], InputScriptType, str]] = []
+
     def create_hash_writer(self) -> HashWriter:
         return HashWriter(sha256())
 
@@ -961,11 +969,28 @@ class Bitcoin:
                 ]
             except KeyError:
                 raise DataError("Invalid script type")
-            node = self.keychain.derive(txo.address_n)
-            txo.address = addresses.get_address(
-                input_script_type, self.coin, node, txo.multisig
-            )
+            txo.address = self.change_address(txo, input_script_type)
 
         assert txo.address is not None  # checked in _sanitize_tx_output
 
         return scripts.output_derive_script(txo.address, self.coin)
+
+    def change_address(self, txo: TxOutput, input_script_type: InputScriptType) -> str:
+        cache = self.change_addresses  # local_cache_attribute
+
+        # multisig change addresses also depend on the cosigners, don't cache them
+        if txo.multisig is None:
+            for address_n, script_type, address in cache:
+                if script_type == input_script_type and address_n == txo.address_n:
+                    return address
+
+        node = self.keychain.derive(txo.address_n)
+        address = addresses.get_address(
+            input_script_type, self.coin, node, txo.multisig
+        )
+
+        if txo.multisig is None:
+            if len(cache) >= _CHANGE_ADDRESS_CACHE_SIZE:
+                cache.pop(0)
+            cache.append((txo.address_n, input_script_type, address))
+        return address
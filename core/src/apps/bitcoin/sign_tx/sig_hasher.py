@@ -11,6 +11,7 @@ from ..writers import (
 if TYPE_CHECKING:
     from typing import Protocol, Sequence
 
+    from trezor.crypto.hashlib import sha256
     from trezor.messages import PrevTx, SignTx, TxInput, TxOutput
 
     from apps.common import coininfo
@@ -58,9 +59,16 @@ class BitcoinSigHasher:
         self.h_sequences = HashWriter(sha256())
         self.h_outputs = HashWriter(sha256())
 
+        # The parts of the BIP-143 and BIP-341 preimages preceding the input
+        # fields are the same for all inputs. They are hashed once and the
+        # hash state is copied for each input.
+        self.prefix143: tuple[tuple, sha256, bytes] | None = None
+        self.prefix341: tuple[tuple, sha256] | None = None
+
     def add_input(self, txi: TxInput, script_pubkey: bytes) -> None:
         from ..writers import write_bytes_prefixed
 
+        self.prefix143 = self.prefix341 = None
         write_bytes_reversed(self.h_prevouts, txi.prev_hash, TX_HASH_SIZE)
         write_uint32(self.h_prevouts, txi.prev_index)
         write_uint64(self.h_amounts, txi.amount)
@@ -70,6 +78,7 @@ class BitcoinSigHasher:
     def add_output(self, txo: TxOutput, script_pubkey: bytes) -> None:
         from ..writers import write_tx_output
 
+        self.prefix143 = self.prefix341 = None
         write_tx_output(self.h_outputs, txo, script_pubkey)
 
     def hash143(
@@ -87,18 +96,27 @@ class BitcoinSigHasher:
         from .. import scripts
         from ..writers import get_tx_hash
 
-        h_preimage = HashWriter(sha256())
+        key = (tx.version, coin.sign_hash_double)
+        if self.prefix143 is None or self.prefix143[0] != key:
+            prefix = sha256()
+            h_prefix = HashWriter(prefix)
+
+            # nVersion
+            write_uint32(h_prefix, tx.version)
+
+            # hashPrevouts
+            prevouts_hash = get_tx_hash(self.h_prevouts, double=coin.sign_hash_double)
+            write_bytes_fixed(h_prefix, prevouts_hash, TX_HASH_SIZE)
 
-        # nVersion
-        write_uint32(h_preimage, tx.version)
+            # hashSequence
+            sequence_hash = get_tx_hash(self.h_sequences, double=coin.sign_hash_double)
+            write_bytes_fixed(h_prefix, sequence_hash, TX_HASH_SIZE)
 
-        # hashPrevouts
-        prevouts_hash = get_tx_hash(self.h_prevouts, double=coin.sign_hash_double)
-        write_bytes_fixed(h_preimage, prevouts_hash, TX_HASH_SIZE)
+            outputs_hash = get_tx_hash(self.h_outputs, double=coin.sign_hash_double)
+            self.prefix143 = (key, prefix, outputs_hash)
 
-        # hashSequence
-        sequence_hash = get_tx_hash(self.h_sequences, double=coin.sign_hash_double)
-        write_bytes_fixed(h_preimage, sequence_hash, TX_HASH_SIZE)
+        _, prefix, outputs_hash = self.prefix143
+        h_preimage = HashWriter(prefix.copy())
 
         # outpoint
         write_bytes_reversed(h_preimage, txi.prev_hash, TX_HASH_SIZE)
@@ -116,7 +134,6 @@ class BitcoinSigHasher:
         write_uint32(h_preimage, txi.sequence)
 
         # hashOutputs
-        outputs_hash = get_tx_hash(self.h_outputs, double=coin.sign_hash_double)
         write_bytes_fixed(h_preimage, outputs_hash, TX_HASH_SIZE)
 
         # nLockTime
@@ -133,37 +150,46 @@ class BitcoinSigHasher:
         tx: SignTx | PrevTx,
         sighash_type: SigHashType,
     ) -> bytes:
-        from ..common import tagged_hashwriter
+        from trezor.utils import HashWriter
+
+        from ..common import tagged_sha256
         from ..writers import write_uint8
 
-        h_sigmsg = tagged_hashwriter(b"TapSighash")
+        key = (sighash_type, tx.version, tx.lock_time)
+        if self.prefix341 is None or self.prefix341[0] != key:
+            prefix = tagged_sha256(b"TapSighash")
+            h_sigmsg = HashWriter(prefix)
 
-        # sighash epoch 0
-        write_uint8(h_sigmsg, 0)
+            # sighash epoch 0
+            write_uint8(h_sigmsg, 0)
 
-        # nHashType
-        write_uint8(h_sigmsg, sighash_type & 0xFF)
+            # nHashType
+            write_uint8(h_sigmsg, sighash_type & 0xFF)
 
-        # nVersion
-        write_uint32(h_sigmsg, tx.version)
+            # nVersion
+            write_uint32(h_sigmsg, tx.version)
 
-        # nLockTime
-        write_uint32(h_sigmsg, tx.lock_time)
+            # nLockTime
+            write_uint32(h_sigmsg, tx.lock_time)
+
+            # sha_prevouts
+            write_bytes_fixed(h_sigmsg, self.h_prevouts.get_digest(), TX_HASH_SIZE)
+
+            # sha_amounts
+            write_bytes_fixed(h_sigmsg, self.h_amounts.get_digest(), TX_HASH_SIZE)
 
-        # sha_prevouts
-        write_bytes_fixed(h_sigmsg, self.h_prevouts.get_digest(), TX_HASH_SIZE)
+            # sha_scriptpubkeys
+            write_bytes_fixed(h_sigmsg, self.h_scriptpubkeys.get_digest(), TX_HASH_SIZE)
 
-        # sha_amounts
-        write_bytes_fixed(h_sigmsg, self.h_amounts.get_digest(), TX_HASH_SIZE)
+            # sha_sequences
+            write_bytes_fixed(h_sigmsg, self.h_sequences.get_digest(), TX_HASH_SIZE)
 
-        # sha_scriptpubkeys
-        write_bytes_fixed(h_sigmsg, self.h_scriptpubkeys.get_digest(), TX_HASH_SIZE)
+            # sha_outputs
+            write_bytes_fixed(h_sigmsg, self.h_outputs.get_digest(), TX_HASH_SIZE)
 
-        # sha_sequences
-        write_bytes_fixed(h_sigmsg, self.h_sequences.get_digest(), TX_HASH_SIZE)
+            self.prefix341 = (key, prefix)
 
-        # sha_outputs
-        write_bytes_fixed(h_sigmsg, self.h_outputs.get_digest(), TX_HASH_SIZE)
+        h_sigmsg = HashWriter(self.prefix341[1].copy())
 
         # spend_type 0 (no tapscript message extension, no annex)
         write_uint8(h_sigmsg, 0)
@@ -11,6 +11,7 @@ from trezor.crypto import cardano
 from trezor.wire import context
 
 from apps.common import mnemonic
+from apps.common.keychain import LRUCache
 from apps.common.seed import get_seed
 
 from .helpers.paths import BYRON_ROOT, MINTING_ROOT, MULTISIG_ROOT, SHELLEY_ROOT
@@ -49,6 +50,10 @@ class Keychain:
         self.minting_root = self._derive_path(root, MINTING_ROOT)
         root.__del__()
 
+        # account nodes, so that the hardened account derivation is done only
+        # once for all the addresses and witnesses of a transaction
+        self._cache = LRUCache(10)
+
     @staticmethod
     def _derive_path(root: bip32.HDNode, path: Bip32Path) -> bip32.HDNode:
         """Clone and derive path from the root."""
@@ -90,10 +95,21 @@ class Keychain:
             and len(MULTISIG_ROOT) == len(SHELLEY_ROOT)
             and len(MINTING_ROOT) == len(SHELLEY_ROOT)
         )
-        suffix = node_path[len(SHELLEY_ROOT) :]
-
-        # derive child node from the root
-        return self._derive_path(path_root, suffix)
+        prefix_len = len(SHELLEY_ROOT) + 1
+        if len(node_path) <= prefix_len:
+            # derive child node from the root
+            return self._derive_path(path_root, node_path[len(SHELLEY_ROOT) :])
+
+        account_path = tuple(node_path[:prefix_len])
+        account_node = self._cache.get(account_path)
+        if account_node is None:
+            account_node = self._derive_path(
+                path_root, node_path[len(SHELLEY_ROOT) : prefix_len]
+            )
+            self._cache.insert(account_path, account_node)
+
+        # derive child node from the cached account node
+        return self._derive_path(account_node, node_path[prefix_len:])
 
     # XXX the root node remains in session cache so we should not delete it
     # def __del__(self) -> None:
@@ -124,18 +140,20 @@ def derive_and_store_secrets(passphrase: str) -> None:
         # nothing to do for SLIP-39, where we can derive the root from the main seed
         return
 
-    icarus_secret = mnemonic.derive_cardano_icarus(passphrase, trezor_derivation=False)
-
     words = mnemonic.get_secret()
     assert words is not None, "Mnemonic is not set"
     # count ASCII spaces, add 1 to get number of words
     words_count = sum(c == 0x20 for c in words) + 1
 
+    # both variants are derived under a single progress bar
     if words_count == 24:
-        icarus_trezor_secret = mnemonic.derive_cardano_icarus(
-            passphrase, trezor_derivation=True
+        icarus_secret, icarus_trezor_secret = mnemonic.derive_cardano_icarus(
+            passphrase, trezor_derivations=(False, True)
         )
     else:
+        (icarus_secret,) = mnemonic.derive_cardano_icarus(
+            passphrase, trezor_derivations=(False,)
+        )
         icarus_trezor_secret = icarus_secret
 
     context.cache_set(APP_CARDANO_ICARUS_SECRET, icarus_secret)
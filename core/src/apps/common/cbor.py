@@ -51,11 +51,14 @@ _CBOR_SET_TAG = const(0x102)  # Tag 258
 
 
 def _header(typ: int, l: int) -> bytes:
+    if l < 24:
+        # most headers of a transaction (small ints, short arrays and maps) are
+        # a single byte, create them without importing and calling pack
+        return bytes((typ + l,))
+
     from ustruct import pack
 
-    if l < 24:
-        return pack(">B", typ + l)
-    elif l < 2**8:
+    if l < 2**8:
         return pack(">BB", typ + 24, l)
     elif l < 2**16:
         return pack(">BH", typ + 25, l)
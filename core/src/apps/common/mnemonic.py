@@ -1,3 +1,4 @@
+from micropython import const
 from typing import TYPE_CHECKING
 
 import storage.device as storage_device
@@ -74,11 +75,18 @@ def get_seed(
 
 if not utils.BITCOIN_ONLY:
 
+    # iterations between two progress updates of derive_cardano_icarus
+    _ICARUS_STEP = const(256)
+
     def derive_cardano_icarus(
         passphrase: str = "",
-        trezor_derivation: bool = True,
+        trezor_derivations: tuple[bool, ...] = (True,),
         progress_bar: bool = True,
-    ) -> bytes:
+    ) -> list[bytes]:
+        """
+        Derive the Icarus master secrets of all the given variants, showing a
+        single progress bar for all of them.
+        """
         if not is_bip39():
             raise ValueError  # should not be called for SLIP-39
 
@@ -93,11 +101,27 @@ if not utils.BITCOIN_ONLY:
 
         from trezor.crypto import cardano
 
-        seed = cardano.derive_icarus(
-            mnemonic_secret.decode(), passphrase, trezor_derivation, render_func
-        )
+        words = mnemonic_secret.decode()
+        contexts = [
+            cardano.icarus(words, passphrase, trezor_derivation)
+            for trezor_derivation in trezor_derivations
+        ]
+        iterations = cardano.icarus.ITERATIONS
+        total = len(contexts) * iterations
+        done = 0
+        for ctx in contexts:
+            remaining = iterations
+            while remaining > 0:
+                remaining = ctx.update(_ICARUS_STEP)
+                if render_func is not None:
+                    render_func(done + iterations - remaining, total)
+            done += iterations
+        secrets = []
+        for ctx in contexts:
+            secrets.append(ctx.secret())
+            ctx.__del__()
         _finish_progress()
-        return seed
+        return secrets
 
 
 _progress_obj: ProgressLayout | None = None
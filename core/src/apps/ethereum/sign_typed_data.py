@@ -139,6 +139,7 @@ class TypedDataEnvelope:
         self.primary_type = primary_type
         self.metamask_v4_compat = metamask_v4_compat
         self.types: dict[str, EthereumTypedDataStructAck] = {}
+        self.type_hashes: dict[str, bytes] = {}
 
     async def collect_types(self) -> None:
         """Aggregate type collection process for both domain and message data."""
@@ -189,7 +190,12 @@ class TypedDataEnvelope:
 
     def hash_type(self, w: HashWriter, primary_type: str) -> None:
         """Create a representation of a type."""
-        result = keccak256(self.encode_type(primary_type))
+        # The type hash does not depend on the values, so it is computed only
+        # once per struct type, even if the type is used by many array entries.
+        result = self.type_hashes.get(primary_type)
+        if result is None:
+            result = keccak256(self.encode_type(primary_type))
+            self.type_hashes[primary_type] = result
         w.extend(result)
 
     def encode_type(self, primary_type: str) -> bytes:
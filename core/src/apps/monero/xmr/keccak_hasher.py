@@ -7,20 +7,30 @@ if TYPE_CHECKING:
 
 
 class KeccakXmrArchive:
-    def __init__(self, ctx: HashContext | None = None) -> None:
-        self.kwriter = get_keccak_writer(ctx)
+    """
+    Keccak hasher of serialized values, the varints are serialized by the
+    hasher itself without intermediate buffers.
+    """
+
+    def __init__(self) -> None:
+        from trezor.crypto import monero as tcry
+
+        self.ctx = tcry.Hasher()
 
     def get_digest(self) -> bytes:
-        return self.kwriter.get_digest()
+        return self.ctx.digest()
 
     def buffer(self, buf: bytes) -> None:
-        return self.kwriter.write(buf)
+        self.ctx.update(buf)
 
     def uvarint(self, i: int) -> None:
-        int_serialize.dump_uvarint(self.kwriter, i)
+        self.ctx.uvarint(i)
 
     def uint(self, i: int, width: int) -> None:
-        int_serialize.dump_uint(self.kwriter, i, width)
+        int_serialize.dump_uint(self, i, width)
+
+    def write(self, buf: bytes) -> None:
+        self.ctx.update(buf)
 
 
 def get_keccak_writer(ctx: HashContext | None = None) -> HashWriter:
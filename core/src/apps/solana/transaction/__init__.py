@@ -10,7 +10,7 @@ from .instructions import get_instruction, get_instruction_id_length
 from .parse import parse_block_hash, parse_pubkey, parse_var_int
 
 if TYPE_CHECKING:
-    from ..types import Account, Address, AddressReference, RawInstruction
+    from ..types import Address, AddressReference, RawInstruction
 
 
 class Transaction:
@@ -105,10 +105,8 @@ class Transaction:
             program_index = serialized_tx_reader.get()
             program_id = base58.encode(self.addresses[program_index][0])
             num_of_accounts = parse_var_int(serialized_tx_reader)
-            accounts: list[int] = []
-            for _ in range(num_of_accounts):
-                account_index = serialized_tx_reader.get()
-                accounts.append(account_index)
+            # account indexes are single bytes, keep them in the buffer
+            accounts = serialized_tx_reader.read_memoryview(num_of_accounts)
 
             data_length = parse_var_int(serialized_tx_reader)
 
@@ -126,7 +124,7 @@ class Transaction:
             )
 
             self.raw_instructions.append(
-                (program_index, instruction_id, accounts, instruction_data)
+                (program_id, instruction_id, accounts, instruction_data)
             )
 
     def _parse_address_lookup_tables(self, serialized_tx: BufferReader) -> None:
@@ -154,18 +152,6 @@ class Transaction:
                     (account, index, AddressType.AddressReadOnly)
                 )
 
-    def _get_combined_accounts(self) -> list[Account]:
-        accounts: list[Account] = []
-        for address in self.addresses:
-            accounts.append(address)
-
-        for rw_address in self.address_lookup_tables_rw_addresses:
-            accounts.append(rw_address)
-        for ro_address in self.address_lookup_tables_ro_addresses:
-            accounts.append(ro_address)
-
-        return accounts
-
     def _create_instructions(self) -> None:
         # Instructions reference accounts by index in this combined list.
         combined_accounts = (
@@ -176,12 +162,11 @@ class Transaction:
 
         self.instructions = []
         for (
-            program_index,
+            program_id,
             instruction_id,
             accounts,
             instruction_data,
         ) in self.raw_instructions:
-            program_id = base58.encode(self.addresses[program_index][0])
             instruction_accounts = [
                 combined_accounts[account_index] for account_index in accounts
             ]
@@ -12,13 +12,11 @@ if TYPE_CHECKING:
     AddressReference = tuple[bytes, int, "AddressType"]
     Account = Address | AddressReference
 
-    ProgramIndex = int
+    ProgramId = str
     InstructionId = int | None
-    AccountIndex = int
+    AccountIndexes = memoryview
     InstructionData = memoryview
-    RawInstruction = tuple[
-        ProgramIndex, InstructionId, list[AccountIndex], InstructionData
-    ]
+    RawInstruction = tuple[ProgramId, InstructionId, AccountIndexes, InstructionData]
 
     T = TypeVar("T")
 else:
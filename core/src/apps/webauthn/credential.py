@@ -4,11 +4,12 @@ from typing import TYPE_CHECKING
 from ubinascii import hexlify
 
 import storage.device as storage_device
+from storage.cache_common import APP_WEBAUTHN_CRED_ID_KEY
 from trezor import utils
 from trezor.crypto import chacha20poly1305, der, hashlib, hmac, random
 from trezor.crypto.curve import ed25519, nist256p1
 
-from apps.common import cbor, seed
+from apps.common import cache, cbor, seed
 from apps.common.paths import HARDENED
 
 from .common import COSE_ALG_EDDSA, COSE_ALG_ES256, COSE_CURVE_ED25519, COSE_CURVE_P256
@@ -58,6 +59,16 @@ _CURVE_NAME = {
 _U2F_KEY_PATH = const(0x8055_3246)
 
 
+@cache.stored(APP_WEBAUTHN_CRED_ID_KEY)
+def _cred_id_key() -> bytes:
+    # The credential ID encryption key only depends on the seed. It is cached next to
+    # the seed because GetAssertion decrypts every credential ID of the allowList
+    # and every resident credential of the RP.
+    return seed.derive_slip21_node_without_passphrase(
+        [b"SLIP-0022", _CRED_ID_VERSION, b"Encryption key"]
+    ).key()
+
+
 class Credential:
     def __init__(self) -> None:
         self.index: int | None = None
@@ -164,9 +175,7 @@ class Fido2Credential(Credential):
             data[_CRED_ID_ALGORITHM] = self.algorithm
             data[_CRED_ID_CURVE] = self.curve
 
-        key = seed.derive_slip21_node_without_passphrase(
-            [b"SLIP-0022", _CRED_ID_VERSION, b"Encryption key"]
-        ).key()
+        key = _cred_id_key()
         iv = random.bytes(12)
         ctx = chacha20poly1305(key, iv)
         ctx.auth(self.rp_id_hash)
@@ -184,9 +193,7 @@ class Fido2Credential(Credential):
         if len(cred_id) < _CRED_ID_MIN_LENGTH or cred_id[0:4] != _CRED_ID_VERSION:
             raise ValueError  # invalid length or version
 
-        key = seed.derive_slip21_node_without_passphrase(
-            [b"SLIP-0022", cred_id[0:4], b"Encryption key"]
-        ).key()
+        key = _cred_id_key()
         iv = cred_id[4:16]
         ciphertext = cred_id[16:-16]
         tag = cred_id[-16:]
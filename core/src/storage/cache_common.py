@@ -23,6 +23,8 @@ APP_COMMON_BUSY_DEADLINE_MS = const(3 | SESSIONLESS_FLAG)
 APP_MISC_COSI_NONCE = const(4 | SESSIONLESS_FLAG)
 APP_MISC_COSI_COMMITMENT = const(5 | SESSIONLESS_FLAG)
 APP_RECOVERY_REPEATED_BACKUP_UNLOCKED = const(6 | SESSIONLESS_FLAG)
+if not utils.BITCOIN_ONLY:
+    APP_WEBAUTHN_CRED_ID_KEY = const(7 | SESSIONLESS_FLAG)
 
 
 if TYPE_CHECKING:
@@ -58,9 +60,11 @@ class DataCache:
 
     def get(self, key: int, default: T | None = None) -> bytes | T | None:  # noqa: F811
         utils.ensure(key < len(self.fields))
-        if self.data[key][0] != 1:
+        data = self.data[key]
+        if data[0] != 1:
             return default
-        return bytes(self.data[key][1:])
+        # slicing a memoryview avoids an intermediate bytearray copy
+        return bytes(memoryview(data)[1:])
 
     def get_bool(self, key: int) -> bool:  # noqa: F811
         return self.get(key) is not None
@@ -131,6 +135,8 @@ class SessionlessCache(DataCache):
             32,  # APP_MISC_COSI_COMMITMENT
             0,  # APP_RECOVERY_REPEATED_BACKUP_UNLOCKED
         )
+        if not utils.BITCOIN_ONLY:
+            self.fields += (32,)  # APP_WEBAUTHN_CRED_ID_KEY
         super().__init__()
 
     def get(self, key: int, default: T | None = None) -> bytes | T | None:  # noqa: F811
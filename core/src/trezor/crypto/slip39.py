@@ -453,39 +453,19 @@ def _rs1024_create_checksum(data: Indices, extendable: bool) -> Indices:
     values = (
         tuple(_customization_string(extendable)) + data + _CHECKSUM_LENGTH_WORDS * (0,)
     )
-    polymod = _rs1024_polymod(values) ^ 1
+    polymod = slip39.rs1024_polymod(values) ^ 1
     return tuple(
         (polymod >> 10 * i) & 1023 for i in reversed(range(_CHECKSUM_LENGTH_WORDS))
     )
 
 
-def _rs1024_polymod(values: Indices) -> int:
-    GEN = (
-        0xE0_E040,
-        0x1C1_C080,
-        0x383_8100,
-        0x707_0200,
-        0xE0E_0009,
-        0x1C0C_2412,
-        0x3808_6C24,
-        0x3090_FC48,
-        0x21B1_F890,
-        0x3F3_F120,
-    )
-    chk = 1
-    for v in values:
-        b = chk >> 20
-        chk = (chk & 0xF_FFFF) << 10 ^ v
-        for i in range(10):
-            chk ^= GEN[i] if ((b >> i) & 1) else 0
-    return chk
-
-
 def _rs1024_verify_checksum(data: Indices, extendable: bool) -> bool:
     """
     Verifies a checksum of the given mnemonic, which was already parsed into Indices.
     """
-    return _rs1024_polymod(tuple(_customization_string(extendable)) + data) == 1
+    return (
+        slip39.rs1024_polymod(tuple(_customization_string(extendable)) + data) == 1
+    )
 
 
 # === Internal functions ===
@@ -560,8 +540,9 @@ def _split_secret(
         (_SECRET_INDEX, shared_secret),
     ]
 
-    for i in range(random_share_count, share_count):
-        shares.append((i, shamir.interpolate(base_shares, i)))
+    indices = list(range(random_share_count, share_count))
+    values = shamir.interpolate_multi(base_shares, indices)
+    shares.extend(zip(indices, values))
 
     return shares
 
@@ -570,7 +551,8 @@ def _extend_shares(
     share_count: int, old_shares: list[tuple[int, bytes]]
 ) -> list[tuple[int, bytes]]:
     _check_parameters(len(old_shares), share_count)
-    return [(i, shamir.interpolate(old_shares, i)) for i in range(share_count)]
+    indices = list(range(share_count))
+    return list(zip(indices, shamir.interpolate_multi(old_shares, indices)))
 
 
 def _recover_secret(threshold: int, shares: list[tuple[int, bytes]]) -> bytes:
@@ -578,8 +560,9 @@ def _recover_secret(threshold: int, shares: list[tuple[int, bytes]]) -> bytes:
     if threshold == 1:
         return shares[0][1]
 
-    shared_secret = shamir.interpolate(shares, _SECRET_INDEX)
-    digest_share = shamir.interpolate(shares, _DIGEST_INDEX)
+    shared_secret, digest_share = shamir.interpolate_multi(
+        shares, [_SECRET_INDEX, _DIGEST_INDEX]
+    )
     digest = digest_share[:_DIGEST_LENGTH_BYTES]
     random_part = digest_share[_DIGEST_LENGTH_BYTES:]
 
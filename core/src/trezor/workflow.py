@@ -13,6 +13,8 @@ if TYPE_CHECKING:
 if __debug__:
     # Used in `on_close` below for memory statistics.
 
+    import gc
+
     import micropython
 
     from trezor import utils
@@ -44,6 +46,11 @@ default_constructor: Callable[[], loop.Task] | None = None
 # Determines whether idle timer firing closes currently running workflow. Storage is locked always.
 autolock_interrupts_workflow: bool = True
 
+if __debug__:
+    # Heap usage at the start of the running workflow tasks, used for the memory
+    # statistics with `utils.LOG_MEMORY`.
+    heap_at_start: dict[loop.spawn, int] = {}
+
 
 def _on_start(workflow: loop.spawn) -> None:
     """
@@ -52,6 +59,8 @@ def _on_start(workflow: loop.spawn) -> None:
     # Take note that this workflow task is running.
     if __debug__:
         log.debug(__name__, "start: %s", workflow.task)
+        if utils.LOG_MEMORY:
+            heap_at_start[workflow] = gc.mem_alloc()
     tasks.add(workflow)
 
 
@@ -67,8 +76,21 @@ def _on_close(workflow: loop.spawn) -> None:
         start_default()
     if __debug__:
         # In debug builds, we dump a memory info right after a workflow is
-        # finished.
+        # finished, together with the heap growth attributed to the workflow and
+        # the duration of a collection of the garbage it left behind.
         if utils.LOG_MEMORY:
+            used = gc.mem_alloc()
+            start = utime.ticks_us()
+            gc.collect()
+            pause = utime.ticks_diff(utime.ticks_us(), start)
+            log.info(
+                __name__,
+                "heap: %s B at start, %s B at close, gc freed %s B in %s us",
+                heap_at_start.pop(workflow, "?"),
+                used,
+                used - gc.mem_alloc(),
+                pause,
+            )
             micropython.mem_info()
 
 
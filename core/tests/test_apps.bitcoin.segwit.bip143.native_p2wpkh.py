@@ -131,6 +131,16 @@ class TestSegwitBip143NativeP2WPKH(unittest.TestCase):
             b"2fa3f1351618b2532228d7182d3221d95c21fd3d496e7e22e9ded873cf022a8b",
         )
 
+        # the cached prefix of the preimage gives the same hash
+        self.assertIsNotNone(sig_hasher.prefix143)
+        result = sig_hasher.hash143(
+            self.inp2, [node.public_key()], 1, self.tx, coin, SigHashType.SIGHASH_ALL
+        )
+        self.assertEqual(
+            hexlify(result),
+            b"2fa3f1351618b2532228d7182d3221d95c21fd3d496e7e22e9ded873cf022a8b",
+        )
+
 
 if __name__ == "__main__":
     unittest.main()
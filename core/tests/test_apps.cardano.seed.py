@@ -64,6 +64,29 @@ class TestCardanoKeychain(unittest.TestCase):
             self.assertEqual(hexlify(key.node.chain_code), chain_codes[index])
             self.assertEqual(key.xpub, xpub_keys[index])
 
+    def test_derive_cached_account(self):
+        mnemonic = (
+            "test walk nut penalty hip pave soap entry language right filter choice"
+        )
+        secret = cardano.derive_icarus(mnemonic, "", True)
+        keychain = Keychain(cardano.from_secret(secret))
+
+        derivation_paths = [
+            [1852 | HARDENED, 1815 | HARDENED],
+            [1852 | HARDENED, 1815 | HARDENED, HARDENED],
+            [1852 | HARDENED, 1815 | HARDENED, HARDENED, 0, 0],
+            [1852 | HARDENED, 1815 | HARDENED, 1 | HARDENED, 2, 0],
+            [1852 | HARDENED, 1815 | HARDENED, HARDENED, 2, 0],
+            [1852 | HARDENED, 1815 | HARDENED, HARDENED, 0, 0],
+        ]
+
+        for derivation_path in derivation_paths:
+            expected = cardano.from_secret(secret)
+            expected.derive_path(derivation_path)
+            node = keychain.derive(derivation_path)
+            self.assertEqual(node.public_key(), expected.public_key())
+            self.assertEqual(node.chain_code(), expected.chain_code())
+
 
 @unittest.skipUnless(not utils.BITCOIN_ONLY, "altcoin")
 class TestCardanoDerivation(unittest.TestCase):
@@ -119,6 +142,30 @@ class TestCardanoDerivation(unittest.TestCase):
         secret_icarus = cardano.derive_icarus(mnemonic, PASSPHRASE, False)
         self.assertNotEqual(secret, secret_icarus)
 
+    def test_icarus_incremental(self):
+        mnemonic = (
+            "void come effort suffer camp survey warrior heavy "
+            "shoot primary clutch crush open amazing screen patrol "
+            "group space point ten exist slush involve unfold"
+        )
+        for trezor_derivation in (False, True):
+            secret = cardano.derive_icarus(mnemonic, "foo", trezor_derivation)
+
+            ctx = cardano.icarus(mnemonic, "foo", trezor_derivation)
+            remaining = cardano.icarus.ITERATIONS
+            while remaining > 0:
+                # steps which do not divide the PBKDF2 blocks
+                result = ctx.update(1000)
+                self.assertEqual(result, max(remaining - 1000, 0))
+                remaining = result
+            self.assertEqual(ctx.secret(), secret)
+            self.assertEqual(ctx.secret(), secret)
+
+            # secret() runs the remaining iterations
+            ctx = cardano.icarus(mnemonic, "foo", trezor_derivation)
+            ctx.update(5000)
+            self.assertEqual(ctx.secret(), secret)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -468,6 +468,28 @@ class TestEthereumSignTypedData(unittest.TestCase):
             EMPTY_ENVELOPE.hash_type(w=w, primary_type=primary_type)
             self.assertEqual(w, expected)
 
+    def test_hash_type_cached(self):
+        typed_data_envelope = TypedDataEnvelope(
+            primary_type="Mail",
+            metamask_v4_compat=True,
+        )
+        typed_data_envelope.types = TYPES_BASIC
+        expected = keccak256(
+            b"Mail(Person from,Person to,string contents)Person(string name,address wallet)"
+        )
+
+        for _ in range(2):
+            w = bytearray()
+            typed_data_envelope.hash_type(w=w, primary_type="Mail")
+            self.assertEqual(w, expected)
+        self.assertEqual(list(typed_data_envelope.type_hashes), ["Mail"])
+
+        # the cached hash is used without encoding the type again
+        typed_data_envelope.types = {}
+        w = bytearray()
+        typed_data_envelope.hash_type(w=w, primary_type="Mail")
+        self.assertEqual(w, expected)
+
     def test_find_typed_dependencies(self):
         # We need to be able to recognize dependency even as array of structs
         types_dependency_only_as_array = {
@@ -85,6 +85,21 @@ class TestMoneroCrypto(unittest.TestCase):
             ),
         )
 
+    def test_hasher_uvarint(self):
+        from apps.monero.xmr.keccak_hasher import KeccakXmrArchive
+        from apps.monero.xmr.serialize import int_serialize
+
+        archive = KeccakXmrArchive()
+        expected = crypto_helpers.get_keccak()
+        for n in (0, 1, 0x7F, 0x80, 0x3FFF, 0x4000, 2**32 + 5, 2**64 - 1):
+            archive.uvarint(n)
+            expected.update(int_serialize.dump_uvarint_b(n))
+        archive.uint(0x1234, 2)
+        expected.update(b"\x34\x12")
+        archive.buffer(b"monero")
+        expected.update(b"monero")
+        self.assertEqual(archive.get_digest(), expected.digest())
+
     def test_hash_to_scalar(self):
         inp = unhexlify(
             b"259ef2aba8feb473cf39058a0fe30b9ff6d245b42b6826687ebd6b63128aff6405"
@@ -166,6 +181,23 @@ class TestMoneroCrypto(unittest.TestCase):
             b"bcf365a551e6358f3f281a6241d4a25eded60230b60a1d48c67b51a85e33d70e",
         )
 
+    def test_multi_scalarmult(self):
+        for n in (0, 1, 2, 5, 50):
+            scalars = [crypto.Scalar(0x12345 * i + 7) for i in range(n)]
+            points = [
+                crypto.scalarmult_base_into(None, crypto.Scalar(i + 2))
+                for i in range(n)
+            ]
+            exp = crypto.identity_into()
+            for s, p in zip(scalars, points):
+                crypto.point_add_into(exp, exp, crypto.scalarmult_into(None, p, s))
+
+            res = crypto.multi_scalarmult_into(None, scalars, points)
+            self.assertTrue(crypto.point_eq(exp, res))
+
+        with self.assertRaises(ValueError):
+            crypto.multi_scalarmult_into(None, [crypto.Scalar(1)], [])
+
     def test_addr_encode(self):
         addr_exp = "4LL9oSLmtpccfufTMvppY6JwXNouMBzSkbLYfpAV5Usx3skxNgYeYTRj5UzqtReoS44qo9mtmXCqY45DJ852K5Jv2bYXZKKQePHES9khPK"
         addr = tcry.xmr_base58_addr_encode_check(
@@ -727,6 +727,24 @@ class TestCryptoBip32(unittest.TestCase):
             "xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt",
         )
 
+    def test_addresses(self):
+        m = bip32.from_seed(
+            unhexlify("000102030405060708090a0b0c0d0e0f"), SECP256K1_NAME
+        )
+        m.derive_path([HARDENED | 44, HARDENED, HARDENED, 0])
+        for start, count in [(0, 0), (0, 1), (3, 20), (0x7FFFFFF0, 16)]:
+            expected = []
+            for i in range(start, start + count):
+                n = m.clone()
+                n.derive(i)
+                expected.append(n.address(0))
+            self.assertEqual(m.addresses(0, start, count), expected)
+
+        with self.assertRaises(ValueError):
+            m.addresses(0, 0x7FFFFFFF, 2)
+        with self.assertRaises(ValueError):
+            m.addresses(0, 0, 257)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -78,6 +78,19 @@ class TestCryptoEd25519(unittest.TestCase):
             sig = ed25519.sign(sk, msg)
             self.assertTrue(ed25519.verify(pk, sig, msg))
 
+    def test_verify_batch(self):
+        pks = [unhexlify(pk) for _, pk, _ in self.vectors]
+        sigs = [unhexlify(sig) for _, _, sig in self.vectors]
+        # msg = pk
+        self.assertTrue(ed25519.verify_batch(pks, sigs, pks))
+        self.assertTrue(ed25519.verify_batch([], [], []))
+
+        sigs[3] = sigs[4]
+        self.assertFalse(ed25519.verify_batch(pks, sigs, pks))
+        self.assertFalse(ed25519.verify_batch(pks[:1], [sigs[0][:63]], pks[:1]))
+        with self.assertRaises(ValueError):
+            ed25519.verify_batch(pks, sigs[1:], pks)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -273,6 +273,55 @@ class TestCryptoSecp256k1(unittest.TestCase):
         self.assertEqual(fixed_vector1, fixed_vector2)
         self.assertEqual(hexlify(fixed_vector1), fixed_vector_hex)
 
+    def test_multiply_multi(self):
+        n = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+        for _ in range(10):
+            sk1 = secp256k1.generate_secret()
+            sk2 = secp256k1.generate_secret()
+            pk2 = secp256k1.publickey(sk2)
+            self.assertEqual(
+                secp256k1.multiply_multi([sk1], [pk2]), secp256k1.multiply(sk1, pk2)
+            )
+
+            # sk1 * P + sk2 * P == (sk1 + sk2) * P
+            pk1 = secp256k1.publickey(sk1)
+            sk3 = (int.from_bytes(sk1, "big") + int.from_bytes(sk2, "big")) % n
+            self.assertEqual(
+                secp256k1.multiply_multi([sk1, sk2], [pk1, pk1]),
+                secp256k1.multiply(sk3.to_bytes(32, "big"), pk1),
+            )
+
+        with self.assertRaises(ValueError):
+            secp256k1.multiply_multi([sk1], [])
+        with self.assertRaises(ValueError):
+            secp256k1.multiply_multi([n.to_bytes(32, "big")], [pk1])
+
+    def test_zkp_backend(self):
+        zkp = secp256k1.zkp_backend()
+        try:
+            for _ in range(10):
+                sk1 = secp256k1.generate_secret()
+                sk2 = secp256k1.generate_secret()
+                dig = random.bytes(32)
+                results = []
+                for enabled in [True, False]:
+                    secp256k1.set_zkp_backend(enabled)
+                    pk1 = secp256k1.publickey(sk1)
+                    pk2 = secp256k1.publickey(sk2, False)
+                    sig = secp256k1.sign(sk1, dig)
+                    shared = secp256k1.multiply(sk1, pk2)
+                    results.append((pk1, pk2, sig, shared))
+                for (pk1, _, sig, _), enabled in zip(results, [False, True]):
+                    # verify the signature made by the other backend
+                    secp256k1.set_zkp_backend(enabled)
+                    self.assertTrue(secp256k1.verify(pk1, sig, dig))
+                    self.assertEqual(secp256k1.verify_recover(sig, dig), pk1)
+                self.assertEqual(results[0][0], results[1][0])
+                self.assertEqual(results[0][1], results[1][1])
+                self.assertEqual(results[0][3], results[1][3])
+        finally:
+            secp256k1.set_zkp_backend(zkp)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Symbolizes the PC samples of the SystemView profiler (SYSTEM_VIEW_PROFILER
+feature flag of SConscript.kernel). The samples are the raw data of the
+"profiler" RTT channel, each one is the PC and LR of the code interrupted by
+the SysTick as two little-endian 32-bit words.
+
+The output is either a flat profile or folded stacks ("caller;function count")
+for flamegraph.pl or speedscope. The caller is the function of the sampled LR,
+which is exact only for leaf functions, LR of other functions may be stale.
+"""
+
+from __future__ import annotations
+
+import bisect
+import shutil
+import struct
+import subprocess
+from collections import Counter
+from pathlib import Path
+from typing import BinaryIO
+
+import click
+
+UNKNOWN = "??"
+
+
+class Symbols:
+    def __init__(self, nm: str, elfs: tuple[Path, ...]) -> None:
+        symbols: list[tuple[int, int, str]] = []
+        for elf in elfs:
+            output = subprocess.run(
+                [nm, "--defined-only", "--print-size", "--numeric-sort", elf],
+                check=True,
+                capture_output=True,
+                text=True,
+            ).stdout
+            for line in output.splitlines():
+                parts = line.split()
+                # address size type name
+                if len(parts) != 4 or parts[2] not in "tTwW":
+                    continue
+                start = int(parts[0], 16) & ~1
+                symbols.append((start, start + int(parts[1], 16), parts[3]))
+        symbols.sort()
+        self.starts = [start for start, _, _ in symbols]
+        self.symbols = symbols
+
+    def lookup(self, address: int) -> str:
+        address &= ~1
+        i = bisect.bisect_right(self.starts, address) - 1
+        if i >= 0:
+            start, end, name = self.symbols[i]
+            if start <= address < end:
+                return name
+        return UNKNOWN
+
+
+def read_samples(samples: BinaryIO) -> list[tuple[int, int]]:
+    data = samples.read()
+    data = data[: len(data) - len(data) % 8]
+    return list(struct.iter_unpack("<II", data))
+
+
+@click.command()
+@click.argument("samples", type=click.File("rb"))
+@click.argument("elfs", nargs=-1, required=True, type=click.Path(path_type=Path))
+@click.option("-f", "--folded", is_flag=True, help="Print folded stacks.")
+@click.option("-n", "--top", default=40, help="Number of functions to print.")
+@click.option("--nm", default="arm-none-eabi-nm", help="nm of the toolchain.")
+def cli(
+    samples: BinaryIO, elfs: tuple[Path, ...], folded: bool, top: int, nm: str
+) -> None:
+    """Print the profile of SAMPLES taken from the firmware built from ELFS.
+
+    Pass the ELF files of both the kernel and the firmware to symbolize the
+    samples of both.
+    """
+    if shutil.which(nm) is None:
+        raise click.ClickException(f"{nm} not found")
+
+    symbols = Symbols(nm, elfs)
+    pcs = read_samples(samples)
+    if not pcs:
+        raise click.ClickException("no samples")
+
+    if folded:
+        stacks = Counter(
+            f"{symbols.lookup(lr)};{symbols.lookup(pc)}" for pc, lr in pcs
+        )
+        for stack, count in sorted(stacks.items()):
+            click.echo(f"{stack} {count}")
+        return
+
+    functions = Counter(symbols.lookup(pc) for pc, _ in pcs)
+    click.echo(f"{len(pcs)} samples")
+    for name, count in functions.most_common(top):
+        click.echo(f"{100 * count / len(pcs):6.2f}% {count:8} {name}")
+
+
+if __name__ == "__main__":
+    cli()
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""
+Summarizes the time profile written by the emulator run with the profiler wrapper
+and TREZOR_TIMEPERF=1, e.g. `./emu.py -T` or `TREZOR_PROFILING=1 TREZOR_TIMEPERF=1`
+for the emulators started by the device tests.
+
+Each line of the data files is "<file>:<line> <function> <microseconds> <hits>".
+The emulator appends to the file, several files (e.g. one per pytest-xdist worker)
+can be passed, so the data of many runs add up. The time of a line does not include
+the Python functions called from it, but does include the native ones.
+"""
+
+from __future__ import annotations
+
+from collections import defaultdict
+from pathlib import Path
+from typing import Iterable
+
+import click
+
+KEYS = ("line", "function", "file")
+
+
+def parse(files: Iterable[Path]) -> Iterable[tuple[str, int, str, int, int]]:
+    for file in files:
+        for line in file.read_text().splitlines():
+            location, name, us, hits = line.rsplit(" ", 3)
+            filename, lineno = location.rsplit(":", 1)
+            yield filename, int(lineno), name, int(us), int(hits)
+
+
+@click.command()
+@click.argument(
+    "files", nargs=-1, type=click.Path(exists=True, dir_okay=False, path_type=Path)
+)
+@click.option("-k", "--key", type=click.Choice(KEYS), default="function")
+@click.option("-n", "--top", default=40, help="Number of entries to print.")
+@click.option("-s", "--strip", default="", help="Prefix to strip from file names.")
+def cli(files: tuple[Path, ...], key: str, top: int, strip: str) -> None:
+    """Print the entries of FILES (default time_data*.txt) taking the most time."""
+    if not files:
+        files = tuple(sorted(Path().glob("time_data*.txt")))
+    if not files:
+        raise click.ClickException("no time data found")
+
+    totals: dict[str, list[int]] = defaultdict(lambda: [0, 0])
+    for filename, lineno, name, us, hits in parse(files):
+        if filename.startswith(strip):
+            filename = filename[len(strip) :]
+        if key == "line":
+            entry = f"{filename}:{lineno} ({name})"
+        elif key == "function":
+            entry = f"{filename}:{name}"
+        else:
+            entry = filename
+        totals[entry][0] += us
+        totals[entry][1] += hits
+
+    total_us = sum(us for us, _ in totals.values()) or 1
+    click.echo(f"{total_us / 1e6:.3f} s in total")
+    entries = sorted(totals.items(), key=lambda item: item[1][0], reverse=True)
+    for entry, (us, hits) in entries[:top]:
+        click.echo(f"{100 * us / total_us:6.2f}% {us / 1e3:12.3f} ms {hits:10} {entry}")
+
+
+if __name__ == "__main__":
+    cli()
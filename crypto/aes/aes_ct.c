@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+ * Copyright (c) 2026 SatoshiLabs
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Constant time bitsliced AES, which replaces aescrypt.c and aeskey.c when
+ * AES_BITSLICED is defined, see aesopt.h.
+ *
+ * The state of two blocks is held in eight 32-bit words, q[i] holds the bit i
+ * of all the 32 bytes, see aes_ct_ortho. The S-box is computed by the circuit
+ * of Boyar and Peralta, so that neither the data nor the key are ever used as
+ * an index or in a branch. The code is derived from the aes_ct
+ * implementation of BearSSL by Thomas Pornin.
+ *
+ * The context holds the key schedule in the compressed form of the bitsliced
+ * representation, one word per 32-bit word of the AES key schedule, so that it
+ * fits in the ks array of aes_encrypt_ctx. The round keys are expanded on the
+ * fly and the same key schedule serves both encryption and decryption.
+ */
+
+#include "aesopt.h"
+#include "memzero.h"
+
+#if defined(AES_BITSLICED)
+
+static uint32_t load32_le(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+static void store32_le(uint8_t *p, uint32_t x) {
+  p[0] = (uint8_t)x;
+  p[1] = (uint8_t)(x >> 8);
+  p[2] = (uint8_t)(x >> 16);
+  p[3] = (uint8_t)(x >> 24);
+}
+
+// transposes between the byte oriented and the bitsliced representation, it
+// is an involution
+static void aes_ct_ortho(uint32_t *q) {
+#define SWAPN(cl, ch, s, x, y)                                  \
+  do {                                                          \
+    uint32_t a = (x), b = (y);                                  \
+    (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+    (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+  } while (0)
+#define SWAP2(x, y) SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+#define SWAP4(x, y) SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+#define SWAP8(x, y) SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+  SWAP2(q[0], q[1]);
+  SWAP2(q[2], q[3]);
+  SWAP2(q[4], q[5]);
+  SWAP2(q[6], q[7]);
+
+  SWAP4(q[0], q[2]);
+  SWAP4(q[1], q[3]);
+  SWAP4(q[4], q[6]);
+  SWAP4(q[5], q[7]);
+
+  SWAP8(q[0], q[4]);
+  SWAP8(q[1], q[5]);
+  SWAP8(q[2], q[6]);
+  SWAP8(q[3], q[7]);
+
+#undef SWAP8
+#undef SWAP4
+#undef SWAP2
+#undef SWAPN
+}
+
+// the S-box circuit of Joan Boyar and Rene Peralta, "A small depth-16 circuit
+// for the AES S-box", 2011
+static void aes_ct_sbox(uint32_t *q) {
+  uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+  uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+  uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+  uint32_t y20, y21;
+  uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+  uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+  uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+  uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+  uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+  uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7];
+  x1 = q[6];
+  x2 = q[5];
+  x3 = q[4];
+  x4 = q[3];
+  x5 = q[2];
+  x6 = q[1];
+  x7 = q[0];
+
+  // top linear transformation
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9 = x0 ^ x3;
+  y8 = x0 ^ x5;
+  t0 = x1 ^ x2;
+  y1 = t0 ^ x7;
+  y4 = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2 = y1 ^ x0;
+  y5 = y1 ^ x6;
+  y3 = y5 ^ y8;
+  t1 = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6 = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7 = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  // non-linear section
+  t2 = y12 & y15;
+  t3 = y3 & y6;
+  t4 = t3 ^ t2;
+  t5 = y4 & x7;
+  t6 = t5 ^ t2;
+  t7 = y13 & y16;
+  t8 = y5 & y1;
+  t9 = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15;
+  z1 = t37 & y6;
+  z2 = t33 & x7;
+  z3 = t43 & y16;
+  z4 = t40 & y1;
+  z5 = t29 & y7;
+  z6 = t42 & y11;
+  z7 = t45 & y17;
+  z8 = t41 & y10;
+  z9 = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  // bottom linear transformation
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  s0 = t59 ^ t63;
+  s6 = t56 ^ ~t62;
+  s7 = t48 ^ ~t60;
+  t67 = t64 ^ t65;
+  s3 = t53 ^ t66;
+  s4 = t51 ^ t66;
+  s5 = t47 ^ t65;
+  s1 = t64 ^ ~s3;
+  s2 = t55 ^ ~t67;
+
+  q[7] = s0;
+  q[6] = s1;
+  q[5] = s2;
+  q[4] = s3;
+  q[3] = s4;
+  q[2] = s5;
+  q[1] = s6;
+  q[0] = s7;
+}
+
+#if defined(AES_DECRYPT)
+// applies the inverse of the affine transformation of the S-box
+static void aes_ct_inv_affine(uint32_t *q) {
+  uint32_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+  uint32_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+  q[7] = q1 ^ q4 ^ q6;
+  q[6] = q0 ^ q3 ^ q5;
+  q[5] = q7 ^ q2 ^ q4;
+  q[4] = q6 ^ q1 ^ q3;
+  q[3] = q5 ^ q0 ^ q2;
+  q[2] = q4 ^ q7 ^ q1;
+  q[1] = q3 ^ q6 ^ q0;
+  q[0] = q2 ^ q5 ^ q7;
+}
+
+// the S-box is S(x) = A(I(x)), where I is the inversion in GF(2^8) and A is
+// affine, so its inverse is A^-1(S(A^-1(x))) since I is an involution
+static void aes_ct_inv_sbox(uint32_t *q) {
+  aes_ct_inv_affine(q);
+  aes_ct_sbox(q);
+  aes_ct_inv_affine(q);
+}
+#endif
+
+static void aes_ct_add_round_key(uint32_t *q, const uint32_t *sk) {
+  for (int i = 0; i < 4; i++) {
+    uint32_t x = sk[i] & 0x55555555, y = sk[i] & 0xAAAAAAAA;
+    q[2 * i] ^= x | (x << 1);
+    q[2 * i + 1] ^= y | (y >> 1);
+  }
+}
+
+static inline uint32_t rotr16(uint32_t x) { return (x << 16) | (x >> 16); }
+
+static inline uint32_t rotr8(uint32_t x) { return (x >> 8) | (x << 24); }
+
+static void aes_ct_shift_rows(uint32_t *q) {
+  for (int i = 0; i < 8; i++) {
+    uint32_t x = q[i];
+    q[i] = (x & 0x000000FF) | ((x & 0x0000FC00) >> 2) |
+           ((x & 0x00000300) << 6) | ((x & 0x00F00000) >> 4) |
+           ((x & 0x000F0000) << 4) | ((x & 0xC0000000) >> 6) |
+           ((x & 0x3F000000) << 2);
+  }
+}
+
+static void aes_ct_mix_columns(uint32_t *q) {
+  uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+  uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+  uint32_t r0 = rotr8(q0), r1 = rotr8(q1), r2 = rotr8(q2), r3 = rotr8(q3);
+  uint32_t r4 = rotr8(q4), r5 = rotr8(q5), r6 = rotr8(q6), r7 = rotr8(q7);
+
+  q[0] = q7 ^ r7 ^ r0 ^ rotr16(q0 ^ r0);
+  q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr16(q1 ^ r1);
+  q[2] = q1 ^ r1 ^ r2 ^ rotr16(q2 ^ r2);
+  q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr16(q3 ^ r3);
+  q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr16(q4 ^ r4);
+  q[5] = q4 ^ r4 ^ r5 ^ rotr16(q5 ^ r5);
+  q[6] = q5 ^ r5 ^ r6 ^ rotr16(q6 ^ r6);
+  q[7] = q6 ^ r6 ^ r7 ^ rotr16(q7 ^ r7);
+}
+
+#if defined(AES_DECRYPT)
+static void aes_ct_inv_shift_rows(uint32_t *q) {
+  for (int i = 0; i < 8; i++) {
+    uint32_t x = q[i];
+    q[i] = (x & 0x000000FF) | ((x & 0x00003F00) << 2) |
+           ((x & 0x0000C000) >> 6) | ((x & 0x000F0000) << 4) |
+           ((x & 0x00F00000) >> 4) | ((x & 0x03000000) << 6) |
+           ((x & 0xFC000000) >> 2);
+  }
+}
+
+static void aes_ct_inv_mix_columns(uint32_t *q) {
+  uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+  uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+  uint32_t r0 = rotr8(q0), r1 = rotr8(q1), r2 = rotr8(q2), r3 = rotr8(q3);
+  uint32_t r4 = rotr8(q4), r5 = rotr8(q5), r6 = rotr8(q6), r7 = rotr8(q7);
+
+  q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ rotr16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+  q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ rotr16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+  q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ rotr16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+  q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^
+         rotr16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+  q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^
+         rotr16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+  q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^
+         rotr16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+  q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^
+         rotr16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+  q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ rotr16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+#endif
+
+// loads the first block into the even words and the second block into the odd
+// words of the state
+static void aes_ct_load(uint32_t *q, const uint8_t *in1, const uint8_t *in2) {
+  for (int i = 0; i < 4; i++) {
+    q[2 * i] = load32_le(in1 + 4 * i);
+    q[2 * i + 1] = in2 ? load32_le(in2 + 4 * i) : 0;
+  }
+  aes_ct_ortho(q);
+}
+
+static void aes_ct_store(uint32_t *q, uint8_t *out1, uint8_t *out2) {
+  aes_ct_ortho(q);
+  for (int i = 0; i < 4; i++) {
+    store32_le(out1 + 4 * i, q[2 * i]);
+    if (out2) {
+      store32_le(out2 + 4 * i, q[2 * i + 1]);
+    }
+  }
+}
+
+static int aes_ct_rounds(const aes_inf *inf) {
+  switch (inf->b[0]) {
+    case 10 * AES_BLOCK_SIZE:
+      return 10;
+    case 12 * AES_BLOCK_SIZE:
+      return 12;
+    case 14 * AES_BLOCK_SIZE:
+      return 14;
+    default:
+      return 0;
+  }
+}
+
+static uint32_t aes_ct_sub_word(uint32_t x) {
+  uint32_t q[8] = {0};
+  for (int i = 0; i < 8; i++) {
+    q[i] = x;
+  }
+  aes_ct_ortho(q);
+  aes_ct_sbox(q);
+  aes_ct_ortho(q);
+  x = q[0];
+  memzero(q, sizeof(q));
+  return x;
+}
+
+static void aes_ct_key_schedule(const unsigned char *key, int nk, uint32_t *ks,
+                                aes_inf *inf) {
+  static const uint8_t rcon[10] = {0x01, 0x02, 0x04, 0x08, 0x10,
+                                   0x20, 0x40, 0x80, 0x1b, 0x36};
+  // the key schedule words, twice each for the two blocks of the state
+  uint32_t sk[2 * KS_LENGTH] = {0};
+  int rounds = nk + 6, nkf = 4 * (rounds + 1);
+  uint32_t tmp = 0;
+
+  for (int i = 0; i < nk; i++) {
+    tmp = load32_le(key + 4 * i);
+    sk[2 * i] = sk[2 * i + 1] = tmp;
+  }
+  for (int i = nk, j = 0, k = 0; i < nkf; i++) {
+    if (j == 0) {
+      tmp = (tmp << 24) | (tmp >> 8);
+      tmp = aes_ct_sub_word(tmp) ^ rcon[k];
+    } else if (nk > 6 && j == 4) {
+      tmp = aes_ct_sub_word(tmp);
+    }
+    tmp ^= sk[2 * (i - nk)];
+    sk[2 * i] = sk[2 * i + 1] = tmp;
+    if (++j == nk) {
+      j = 0;
+      k++;
+    }
+  }
+  for (int i = 0; i < nkf; i += 4) {
+    aes_ct_ortho(sk + 2 * i);
+  }
+  // both blocks have the same round keys, keep every other bit of each
+  for (int i = 0; i < nkf; i++) {
+    ks[i] = (sk[2 * i] & 0x55555555) | (sk[2 * i + 1] & 0xAAAAAAAA);
+  }
+  memzero(sk, sizeof(sk));
+  memzero(&tmp, sizeof(tmp));
+
+  inf->l = 0;
+  inf->b[0] = (uint8_t)(rounds * AES_BLOCK_SIZE);
+}
+
+#if defined(AES_ENCRYPT)
+
+static AES_RETURN aes_ct_encrypt(const unsigned char *in1,
+                                 const unsigned char *in2, unsigned char *out1,
+                                 unsigned char *out2,
+                                 const aes_encrypt_ctx cx[1]) {
+  int rounds = aes_ct_rounds(&cx->inf);
+  uint32_t q[8] = {0};
+
+  if (rounds == 0) {
+    return EXIT_FAILURE;
+  }
+
+  aes_ct_load(q, in1, in2);
+  aes_ct_add_round_key(q, cx->ks);
+  for (int r = 1; r < rounds; r++) {
+    aes_ct_sbox(q);
+    aes_ct_shift_rows(q);
+    aes_ct_mix_columns(q);
+    aes_ct_add_round_key(q, cx->ks + 4 * r);
+  }
+  aes_ct_sbox(q);
+  aes_ct_shift_rows(q);
+  aes_ct_add_round_key(q, cx->ks + 4 * rounds);
+  aes_ct_store(q, out1, out2);
+
+  memzero(q, sizeof(q));
+  return EXIT_SUCCESS;
+}
+
+#if defined(AES_128) || defined(AES_VAR)
+AES_RETURN aes_encrypt_key128(const unsigned char *key,
+                              aes_encrypt_ctx cx[1]) {
+  aes_ct_key_schedule(key, 4, cx->ks, &cx->inf);
+  return EXIT_SUCCESS;
+}
+#endif
+
+#if defined(AES_192) || defined(AES_VAR)
+AES_RETURN aes_encrypt_key192(const unsigned char *key,
+                              aes_encrypt_ctx cx[1]) {
+  aes_ct_key_schedule(key, 6, cx->ks, &cx->inf);
+  return EXIT_SUCCESS;
+}
+#endif
+
+#if defined(AES_256) || defined(AES_VAR)
+AES_RETURN aes_encrypt_key256(const unsigned char *key,
+                              aes_encrypt_ctx cx[1]) {
+  aes_ct_key_schedule(key, 8, cx->ks, &cx->inf);
+  return EXIT_SUCCESS;
+}
+#endif
+
+AES_RETURN aes_encrypt(const unsigned char *in, unsigned char *out,
+                       const aes_encrypt_ctx cx[1]) {
+  return aes_ct_encrypt(in, NULL, out, NULL, cx);
+}
+
+AES_RETURN aes_encrypt2(const unsigned char *in, unsigned char *out,
+                        const aes_encrypt_ctx cx[1]) {
+  return aes_ct_encrypt(in, in + AES_BLOCK_SIZE, out, out + AES_BLOCK_SIZE,
+                        cx);
+}
+
+#endif
+
+#if defined(AES_DECRYPT)
+
+static AES_RETURN aes_ct_decrypt(const unsigned char *in1,
+                                 const unsigned char *in2, unsigned char *out1,
+                                 unsigned char *out2,
+                                 const aes_decrypt_ctx cx[1]) {
+  int rounds = aes_ct_rounds(&cx->inf);
+  uint32_t q[8] = {0};
+
+  if (rounds == 0) {
+    return EXIT_FAILURE;
+  }
+
+  aes_ct_load(q, in1, in2);
+  aes_ct_add_round_key(q, cx->ks + 4 * rounds);
+  for (int r = rounds - 1; r > 0; r--) {
+    aes_ct_inv_shift_rows(q);
+    aes_ct_inv_sbox(q);
+    aes_ct_add_round_key(q, cx->ks + 4 * r);
+    aes_ct_inv_mix_columns(q);
+  }
+  aes_ct_inv_shift_rows(q);
+  aes_ct_inv_sbox(q);
+  aes_ct_add_round_key(q, cx->ks);
+  aes_ct_store(q, out1, out2);
+
+  memzero(q, sizeof(q));
+  return EXIT_SUCCESS;
+}
+
+#if defined(AES_128) || defined(AES_VAR)
+AES_RETURN aes_decrypt_key128(const unsigned char *key,
+                              aes_decrypt_ctx cx[1]) {
+  aes_ct_key_schedule(key, 4, cx->ks, &cx->inf);
+  return EXIT_SUCCESS;
+}
+#endif
+
+#if defined(AES_192) || defined(AES_VAR)
+AES_RETURN aes_decrypt_key192(const unsigned char *key,
+                              aes_decrypt_ctx cx[1]) {
+  aes_ct_key_schedule(key, 6, cx->ks, &cx->inf);
+  return EXIT_SUCCESS;
+}
+#endif
+
+#if defined(AES_256) || defined(AES_VAR)
+AES_RETURN aes_decrypt_key256(const unsigned char *key,
+                              aes_decrypt_ctx cx[1]) {
+  aes_ct_key_schedule(key, 8, cx->ks, &cx->inf);
+  return EXIT_SUCCESS;
+}
+#endif
+
+AES_RETURN aes_decrypt(const unsigned char *in, unsigned char *out,
+                       const aes_decrypt_ctx cx[1]) {
+  return aes_ct_decrypt(in, NULL, out, NULL, cx);
+}
+
+AES_RETURN aes_decrypt2(const unsigned char *in, unsigned char *out,
+                        const aes_decrypt_ctx cx[1]) {
+  return aes_ct_decrypt(in, in + AES_BLOCK_SIZE, out, out + AES_BLOCK_SIZE,
+                        cx);
+}
+
+#endif
+
+#endif
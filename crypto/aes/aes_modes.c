@@ -184,6 +184,16 @@ AES_RETURN aes_ecb_encrypt(const unsigned char *ibuf, unsigned char *obuf,
 
 #endif
 
+#if defined( AES_BITSLICED )
+    for( ; nb >= 2; nb -= 2)
+    {
+        if(aes_encrypt2(ibuf, obuf, ctx) != EXIT_SUCCESS)
+            return EXIT_FAILURE;
+        ibuf += 2 * AES_BLOCK_SIZE;
+        obuf += 2 * AES_BLOCK_SIZE;
+    }
+#endif
+
 #if !defined( ASSUME_VIA_ACE_PRESENT )
     while(nb--)
     {
@@ -246,6 +256,16 @@ AES_RETURN aes_ecb_decrypt(const unsigned char *ibuf, unsigned char *obuf,
 
 #endif
 
+#if defined( AES_BITSLICED )
+    for( ; nb >= 2; nb -= 2)
+    {
+        if(aes_decrypt2(ibuf, obuf, ctx) != EXIT_SUCCESS)
+            return EXIT_FAILURE;
+        ibuf += 2 * AES_BLOCK_SIZE;
+        obuf += 2 * AES_BLOCK_SIZE;
+    }
+#endif
+
 #if !defined( ASSUME_VIA_ACE_PRESENT )
     while(nb--)
     {
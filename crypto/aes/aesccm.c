@@ -31,17 +31,7 @@
 #include "aesccm.h"
 #include "memzero.h"
 
-typedef struct {
-  const aes_encrypt_ctx *encrypt_ctx;
-  union {
-    // Ensure 32-bit alignment.
-    uint8_t state[AES_BLOCK_SIZE];
-    uint32_t state32[AES_BLOCK_SIZE / 4];
-  };
-  // Next position in the state where data will be added.
-  // Valid values are 0 to 15.
-  uint8_t pos;
-} cbc_mac_context;
+typedef aes_ccm_cbc_mac_ctx cbc_mac_context;
 
 // WARNING: Caller must ensure that encrypt_ctx remains valid for the lifetime
 // of ctx.
@@ -149,11 +139,11 @@ static AES_RETURN cbc_mac_final(cbc_mac_context *ctx, uint8_t *mac,
   return EXIT_SUCCESS;
 }
 
-static AES_RETURN aes_ccm_init(aes_encrypt_ctx *encrypt_ctx,
-                               const uint8_t *nonce, size_t nonce_len,
-                               const uint8_t *adata, size_t adata_len,
-                               size_t plaintext_len, size_t mac_len,
-                               cbc_mac_context *cbc_ctx, uint8_t *ctr_block) {
+static AES_RETURN aes_ccm_setup(aes_encrypt_ctx *encrypt_ctx,
+                                const uint8_t *nonce, size_t nonce_len,
+                                const uint8_t *adata, size_t adata_len,
+                                size_t plaintext_len, size_t mac_len,
+                                cbc_mac_context *cbc_ctx, uint8_t *ctr_block) {
   if (mac_len < 4 || mac_len > AES_BLOCK_SIZE || mac_len % 2 != 0) {
     return EXIT_FAILURE;
   }
@@ -229,43 +219,129 @@ static AES_RETURN aes_ccm_init(aes_encrypt_ctx *encrypt_ctx,
   return EXIT_SUCCESS;
 }
 
-// The length of data written to the ciphertext array is plaintext_len +
-// mac_len.
-AES_RETURN aes_ccm_encrypt(aes_encrypt_ctx *encrypt_ctx, const uint8_t *nonce,
-                           size_t nonce_len, const uint8_t *adata,
-                           size_t adata_len, const uint8_t *plaintext,
-                           size_t plaintext_len, size_t mac_len,
-                           uint8_t *ciphertext) {
-  cbc_mac_context cbc_ctx = {0};
-  uint8_t ctr_block[AES_BLOCK_SIZE] = {0};
-  if (aes_ccm_init(encrypt_ctx, nonce, nonce_len, adata, adata_len,
-                   plaintext_len, mac_len, &cbc_ctx,
-                   ctr_block) != EXIT_SUCCESS) {
+// The message is processed by calls to aes_ccm_encrypt_update or
+// aes_ccm_decrypt_update, whose lengths add up to plaintext_len, followed by a
+// call to aes_ccm_encrypt_final or aes_ccm_decrypt_final.
+// WARNING: Caller must ensure that encrypt_ctx remains valid and is not used
+// by anything else for the lifetime of ctx.
+AES_RETURN aes_ccm_init(aes_ccm_ctx *ctx, aes_encrypt_ctx *encrypt_ctx,
+                        const uint8_t *nonce, size_t nonce_len,
+                        const uint8_t *adata, size_t adata_len,
+                        size_t plaintext_len, size_t mac_len) {
+  memzero(ctx, sizeof(*ctx));
+  if (aes_ccm_setup(encrypt_ctx, nonce, nonce_len, adata, adata_len,
+                    plaintext_len, mac_len, &ctx->cbc_ctx,
+                    ctx->ctr_block) != EXIT_SUCCESS) {
+    memzero(ctx, sizeof(*ctx));
     return EXIT_FAILURE;
   }
 
-  if (cbc_mac_update(&cbc_ctx, plaintext, plaintext_len) != EXIT_SUCCESS ||
-      cbc_mac_update_zero_padding(&cbc_ctx) != EXIT_SUCCESS ||
-      cbc_mac_final(&cbc_ctx, &ciphertext[plaintext_len], mac_len) !=
+  if (aes_ecb_encrypt(ctx->ctr_block, ctx->s0, AES_BLOCK_SIZE, encrypt_ctx) !=
+      EXIT_SUCCESS) {
+    memzero(ctx, sizeof(*ctx));
+    return EXIT_FAILURE;
+  }
+
+  ctx->ctr_block[AES_BLOCK_SIZE - 1] = 1;
+  ctx->encrypt_ctx = encrypt_ctx;
+  ctx->remaining_len = plaintext_len;
+  ctx->mac_len = mac_len;
+  return EXIT_SUCCESS;
+}
+
+// The ciphertext may be the same array as the plaintext.
+AES_RETURN aes_ccm_encrypt_update(aes_ccm_ctx *ctx, const uint8_t *plaintext,
+                                  size_t plaintext_len, uint8_t *ciphertext) {
+  if (ctx->mac_len == 0 || plaintext_len > ctx->remaining_len ||
+      cbc_mac_update(&ctx->cbc_ctx, plaintext, plaintext_len) !=
+          EXIT_SUCCESS ||
+      aes_ctr_crypt(plaintext, ciphertext, plaintext_len, ctx->ctr_block,
+                    aes_ctr_cbuf_inc, ctx->encrypt_ctx) != EXIT_SUCCESS) {
+    memzero(ctx, sizeof(*ctx));
+    return EXIT_FAILURE;
+  }
+
+  ctx->remaining_len -= plaintext_len;
+  return EXIT_SUCCESS;
+}
+
+// The length of data written to the mac array is mac_len.
+AES_RETURN aes_ccm_encrypt_final(aes_ccm_ctx *ctx, uint8_t *mac) {
+  size_t mac_len = ctx->mac_len;
+  if (mac_len == 0 || ctx->remaining_len != 0 ||
+      cbc_mac_update_zero_padding(&ctx->cbc_ctx) != EXIT_SUCCESS ||
+      cbc_mac_final(&ctx->cbc_ctx, mac, mac_len) != EXIT_SUCCESS) {
+    memzero(ctx, sizeof(*ctx));
+    return EXIT_FAILURE;
+  }
+
+  for (size_t i = 0; i < mac_len; ++i) {
+    mac[i] ^= ctx->s0[i];
+  }
+  memzero(ctx, sizeof(*ctx));
+  return EXIT_SUCCESS;
+}
+
+// The plaintext may be the same array as the ciphertext.
+// WARNING: The plaintext is not authenticated until aes_ccm_decrypt_final
+// succeeds, caller must discard all of it otherwise.
+AES_RETURN aes_ccm_decrypt_update(aes_ccm_ctx *ctx, const uint8_t *ciphertext,
+                                  size_t ciphertext_len, uint8_t *plaintext) {
+  if (ctx->mac_len == 0 || ciphertext_len > ctx->remaining_len ||
+      aes_ctr_crypt(ciphertext, plaintext, ciphertext_len, ctx->ctr_block,
+                    aes_ctr_cbuf_inc, ctx->encrypt_ctx) != EXIT_SUCCESS ||
+      cbc_mac_update(&ctx->cbc_ctx, plaintext, ciphertext_len) !=
           EXIT_SUCCESS) {
+    memzero(ctx, sizeof(*ctx));
+    memzero(plaintext, ciphertext_len);
     return EXIT_FAILURE;
   }
 
-  uint8_t s0[AES_BLOCK_SIZE] = {0};
-  if (aes_ecb_encrypt(ctr_block, s0, AES_BLOCK_SIZE, encrypt_ctx) !=
-      EXIT_SUCCESS) {
-    memzero(s0, sizeof(s0));
+  ctx->remaining_len -= ciphertext_len;
+  return EXIT_SUCCESS;
+}
+
+// The length of the mac is mac_len.
+AES_RETURN aes_ccm_decrypt_final(aes_ccm_ctx *ctx, const uint8_t *mac) {
+  size_t mac_len = ctx->mac_len;
+  uint8_t cbc_mac[AES_BLOCK_SIZE] = {0};
+  if (mac_len == 0 || ctx->remaining_len != 0 ||
+      cbc_mac_update_zero_padding(&ctx->cbc_ctx) != EXIT_SUCCESS ||
+      cbc_mac_final(&ctx->cbc_ctx, cbc_mac, mac_len) != EXIT_SUCCESS) {
+    memzero(ctx, sizeof(*ctx));
     return EXIT_FAILURE;
   }
 
+  uint8_t diff = 0;
   for (size_t i = 0; i < mac_len; ++i) {
-    ciphertext[plaintext_len + i] ^= s0[i];
+    diff |= mac[i] ^ ctx->s0[i] ^ cbc_mac[i];
+  }
+  memzero(cbc_mac, sizeof(cbc_mac));
+  memzero(ctx, sizeof(*ctx));
+
+  if (diff != 0) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+// The length of data written to the ciphertext array is plaintext_len +
+// mac_len.
+AES_RETURN aes_ccm_encrypt(aes_encrypt_ctx *encrypt_ctx, const uint8_t *nonce,
+                           size_t nonce_len, const uint8_t *adata,
+                           size_t adata_len, const uint8_t *plaintext,
+                           size_t plaintext_len, size_t mac_len,
+                           uint8_t *ciphertext) {
+  aes_ccm_ctx ctx = {0};
+  if (aes_ccm_init(&ctx, encrypt_ctx, nonce, nonce_len, adata, adata_len,
+                   plaintext_len, mac_len) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
   }
-  memzero(s0, sizeof(s0));
 
-  ctr_block[AES_BLOCK_SIZE - 1] = 1;
-  if (aes_ctr_crypt(plaintext, ciphertext, plaintext_len, ctr_block,
-                    aes_ctr_cbuf_inc, encrypt_ctx) != EXIT_SUCCESS) {
+  if (aes_ccm_encrypt_update(&ctx, plaintext, plaintext_len, ciphertext) !=
+          EXIT_SUCCESS ||
+      aes_ccm_encrypt_final(&ctx, &ciphertext[plaintext_len]) !=
+          EXIT_SUCCESS) {
     memzero(ciphertext, plaintext_len + mac_len);
     return EXIT_FAILURE;
   }
@@ -280,51 +356,21 @@ AES_RETURN aes_ccm_decrypt(aes_encrypt_ctx *encrypt_ctx, const uint8_t *nonce,
                            size_t adata_len, const uint8_t *ciphertext,
                            size_t ciphertext_len, size_t mac_len,
                            uint8_t *plaintext) {
-  cbc_mac_context cbc_ctx = {0};
-  uint8_t ctr_block[AES_BLOCK_SIZE] = {0};
+  aes_ccm_ctx ctx = {0};
   size_t plaintext_len = ciphertext_len - mac_len;
   if (ciphertext_len < mac_len ||
-      aes_ccm_init(encrypt_ctx, nonce, nonce_len, adata, adata_len,
-                   plaintext_len, mac_len, &cbc_ctx,
-                   ctr_block) != EXIT_SUCCESS) {
-    return EXIT_FAILURE;
-  }
-
-  uint8_t s0[AES_BLOCK_SIZE] = {0};
-  if (aes_ecb_encrypt(ctr_block, s0, AES_BLOCK_SIZE, encrypt_ctx) !=
-      EXIT_SUCCESS) {
-    memzero(&cbc_ctx, sizeof(cbc_ctx));
+      aes_ccm_init(&ctx, encrypt_ctx, nonce, nonce_len, adata, adata_len,
+                   plaintext_len, mac_len) != EXIT_SUCCESS) {
     return EXIT_FAILURE;
   }
 
-  ctr_block[AES_BLOCK_SIZE - 1] = 1;
-  if (aes_ctr_crypt(ciphertext, plaintext, plaintext_len, ctr_block,
-                    aes_ctr_cbuf_inc, encrypt_ctx) != EXIT_SUCCESS) {
-    memzero(&cbc_ctx, sizeof(cbc_ctx));
-    memzero(s0, sizeof(s0));
-    memzero(plaintext, plaintext_len);
-    return EXIT_FAILURE;
-  }
-
-  uint8_t cbc_mac[AES_BLOCK_SIZE] = {0};
-  if (cbc_mac_update(&cbc_ctx, plaintext, plaintext_len) != EXIT_SUCCESS ||
-      cbc_mac_update_zero_padding(&cbc_ctx) != EXIT_SUCCESS ||
-      cbc_mac_final(&cbc_ctx, cbc_mac, mac_len) != EXIT_SUCCESS) {
-    memzero(s0, sizeof(s0));
+  if (aes_ccm_decrypt_update(&ctx, ciphertext, plaintext_len, plaintext) !=
+          EXIT_SUCCESS ||
+      aes_ccm_decrypt_final(&ctx, &ciphertext[plaintext_len]) !=
+          EXIT_SUCCESS) {
     memzero(plaintext, plaintext_len);
     return EXIT_FAILURE;
   }
 
-  uint8_t diff = 0;
-  for (size_t i = 0; i < mac_len; ++i) {
-    diff |= ciphertext[plaintext_len + i] ^ s0[i] ^ cbc_mac[i];
-  }
-  memzero(cbc_mac, sizeof(cbc_mac));
-  memzero(s0, sizeof(s0));
-
-  if (diff != 0) {
-    memzero(plaintext, plaintext_len);
-    return EXIT_FAILURE;
-  }
   return EXIT_SUCCESS;
 }
@@ -28,6 +28,47 @@
 
 #include "aes/aes.h"
 
+typedef struct {
+  const aes_encrypt_ctx *encrypt_ctx;
+  union {
+    // Ensure 32-bit alignment.
+    uint8_t state[AES_BLOCK_SIZE];
+    uint32_t state32[AES_BLOCK_SIZE / 4];
+  };
+  // Next position in the state where data will be added.
+  // Valid values are 0 to 15.
+  uint8_t pos;
+} aes_ccm_cbc_mac_ctx;
+
+// Context of an encryption or decryption that processes the message in chunks.
+typedef struct {
+  aes_encrypt_ctx *encrypt_ctx;
+  aes_ccm_cbc_mac_ctx cbc_ctx;
+  uint8_t ctr_block[AES_BLOCK_SIZE];
+  // Encryption of the counter block 0, which masks the MAC.
+  uint8_t s0[AES_BLOCK_SIZE];
+  // Number of message bytes that are still to be processed.
+  size_t remaining_len;
+  // Set to zero when an operation fails, all further operations on such a
+  // context fail.
+  size_t mac_len;
+} aes_ccm_ctx;
+
+AES_RETURN aes_ccm_init(aes_ccm_ctx *ctx, aes_encrypt_ctx *encrypt_ctx,
+                        const uint8_t *nonce, size_t nonce_len,
+                        const uint8_t *adata, size_t adata_len,
+                        size_t plaintext_len, size_t mac_len);
+
+AES_RETURN aes_ccm_encrypt_update(aes_ccm_ctx *ctx, const uint8_t *plaintext,
+                                  size_t plaintext_len, uint8_t *ciphertext);
+
+AES_RETURN aes_ccm_encrypt_final(aes_ccm_ctx *ctx, uint8_t *mac);
+
+AES_RETURN aes_ccm_decrypt_update(aes_ccm_ctx *ctx, const uint8_t *ciphertext,
+                                  size_t ciphertext_len, uint8_t *plaintext);
+
+AES_RETURN aes_ccm_decrypt_final(aes_ccm_ctx *ctx, const uint8_t *mac);
+
 AES_RETURN aes_ccm_encrypt(aes_encrypt_ctx *encrypt_ctx, const uint8_t *nonce,
                            size_t nonce_len, const uint8_t *adata,
                            size_t adata_len, const uint8_t *plaintext,
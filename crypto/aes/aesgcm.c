@@ -131,6 +131,13 @@ void gf_mul_hh(gf_t a, gcm_ctx ctx[1])
 #if defined( GF_REPRESENTATION ) || !defined( NO_TABLES )
     gf_t    scr = {0};
 #endif
+#if defined( GF_MUL_CLMUL ) && !defined( GF_REPRESENTATION )
+    if(gf_mul_clmul_available())
+    {
+        gf_mul_clmul(a, ctx->ghash_h);
+        return;
+    }
+#endif
 #if defined(  GF_REPRESENTATION )
     convert_representation(a, a, GF_REPRESENTATION);
 #endif
@@ -263,6 +263,27 @@ Issue Date: 20/12/2007
 #  error Assembler code is only available for x86 and AMD64 systems
 #endif
 
+/*  3a. CONSTANT TIME BITSLICED IMPLEMENTATION
+
+    If AES_BITSLICED is defined (which can be done on the command line) the
+    encryption, decryption and key scheduling routines of aescrypt.c and
+    aeskey.c are replaced by the bitsliced ones in aes_ct.c, which use no
+    tables and whose timing and memory accesses do not depend on the data or
+    on the key.  It also provides aes_encrypt2 and aes_decrypt2, which process
+    two consecutive blocks for the cost of one, and which are used by the ECB
+    mode (and therefore by the CTR mode) in aes_modes.c.
+*/
+
+#if 0 && !defined( AES_BITSLICED )
+#  define AES_BITSLICED
+#endif
+
+#if defined( AES_BITSLICED ) && ( defined( ASM_X86_V1C ) || defined( ASM_X86_V2 ) \
+    || defined( ASM_X86_V2C ) || defined( ASM_AMD64_C ) || defined( USE_VIA_ACE_IF_PRESENT ) \
+    || defined( USE_INTEL_AES_IF_PRESENT ) )
+#  error The bitsliced implementation cannot be combined with assembler or hardware support
+#endif
+
 /*  4. FAST INPUT/OUTPUT OPERATIONS.
 
     On some machines it is possible to improve speed by transferring the
@@ -504,7 +525,7 @@ Issue Date: 20/12/2007
     up here to determine which will be implemented in C
 */
 
-#if !defined( AES_ENCRYPT )
+#if !defined( AES_ENCRYPT ) || defined( AES_BITSLICED )
 #  define EFUNCS_IN_C   0
 #elif defined( ASSUME_VIA_ACE_PRESENT ) || defined( ASM_X86_V1C ) \
     || defined( ASM_X86_V2C ) || defined( ASM_AMD64_C )
@@ -515,7 +536,7 @@ Issue Date: 20/12/2007
 #  define EFUNCS_IN_C   0
 #endif
 
-#if !defined( AES_DECRYPT )
+#if !defined( AES_DECRYPT ) || defined( AES_BITSLICED )
 #  define DFUNCS_IN_C   0
 #elif defined( ASSUME_VIA_ACE_PRESENT ) || defined( ASM_X86_V1C ) \
     || defined( ASM_X86_V2C ) || defined( ASM_AMD64_C )
@@ -528,6 +549,11 @@ Issue Date: 20/12/2007
 
 #define FUNCS_IN_C  ( EFUNCS_IN_C | DFUNCS_IN_C )
 
+#if defined( AES_BITSLICED )
+AES_RETURN aes_encrypt2(const unsigned char *in, unsigned char *out, const aes_encrypt_ctx cx[1]);
+AES_RETURN aes_decrypt2(const unsigned char *in, unsigned char *out, const aes_decrypt_ctx cx[1]);
+#endif
+
 /* END OF CONFIGURATION OPTIONS */
 
 #define RC_LENGTH   (5 * (AES_BLOCK_SIZE / 4 - 2))
@@ -81,6 +81,7 @@ Issue Date: 11/01/2011
 #include <string.h>
 
 #include "brg_endian.h"
+#include "options.h"
 
 /* USER DEFINABLE OPTIONS */
 /*  UNIT_BITS sets the size of variables used to process 16 byte buffers
@@ -155,6 +156,15 @@ Issue Date: 11/01/2011
 #  define NO_TABLES
 #endif
 
+/*  A field multiplier using the carry-less multiplication instruction of
+    x86-64 processors, which is used when gf_mul_clmul_available() says
+    that the processor has it
+*/
+#if USE_GHASH_CLMUL && defined( __x86_64__ ) && defined( __GNUC__ ) \
+    && defined( GF_MODE_LB )
+#  define GF_MUL_CLMUL
+#endif
+
 #if defined(__cplusplus)
 extern "C"
 {
@@ -208,6 +218,15 @@ typedef gf_t    (*gf_t256_t);
 void init_256_table(const gf_t g, gf_t256_t t);
 void gf_mul_256(gf_t a, const gf_t256_t t, gf_t r);
 
+#if defined( GF_MUL_CLMUL )
+
+/* calls for the carry-less multiplication field multiplier    */
+
+int gf_mul_clmul_available(void);
+void gf_mul_clmul(gf_t a, const gf_t b);
+
+#endif
+
 #if defined(__cplusplus)
 }
 #endif
@@ -76,16 +76,22 @@ bool b58tobin(void *bin, size_t *binszp, const char *b58) {
   // Leading zeros, just count
   for (i = 0; i < b58sz && b58u[i] == '1'; ++i) ++zerocount;
 
-  for (; i < b58sz; ++i) {
-    if (b58u[i] & 0x80)
-      // High-bit set on invalid digit
-      return false;
-    if (b58digits_map[b58u[i]] == -1)
-      // Invalid base58 digit
-      return false;
-    c = (unsigned)b58digits_map[b58u[i]];
+  while (i < b58sz) {
+    // multiply by 58^5 at most and add the next five digits at once
+    b58_almostmaxint_t mul = 1;
+    c = 0;
+    for (size_t k = 0; k < 5 && i < b58sz; ++k, ++i) {
+      if (b58u[i] & 0x80)
+        // High-bit set on invalid digit
+        return false;
+      if (b58digits_map[b58u[i]] == -1)
+        // Invalid base58 digit
+        return false;
+      c = c * 58 + (unsigned)b58digits_map[b58u[i]];
+      mul *= 58;
+    }
     for (j = outisz; j--;) {
-      t = ((b58_maxint_t)outi[j]) * 58 + c;
+      t = ((b58_maxint_t)outi[j]) * mul + c;
       c = t >> b58_almostmaxint_bits;
       outi[j] = t & b58_almostmaxint_mask;
     }
@@ -145,42 +151,60 @@ int b58check(const void *bin, size_t binsz, HasherType hasher_type,
   return binc[0];
 }
 
+// b58enc computes the digits in limbs of four digits each, 58^4 * 256 < 2^32
+// so a byte is added to a limb by a 32-bit division by a constant
+#define B58_LIMB_DIGITS 4
+#define B58_LIMB 11316496  // 58^4
+
 bool b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz) {
   const uint8_t *bin = data;
-  int carry = 0;
+  uint32_t carry = 0;
   size_t i = 0, j = 0, high = 0, zcount = 0;
-  size_t size = 0;
+  size_t size = 0, limbs = 0, digits = 0;
 
   while (zcount < binsz && !bin[zcount]) ++zcount;
 
   size = (binsz - zcount) * 138 / 100 + 1;
-  uint8_t buf[size];
-  memzero(buf, size);
-
-  for (i = zcount, high = size - 1; i < binsz; ++i, high = j) {
-    for (carry = bin[i], j = size - 1; (j > high) || carry; --j) {
-      carry += 256 * buf[j];
-      buf[j] = carry % 58;
-      carry /= 58;
-      if (!j) {
-        // Otherwise j wraps to maxint which is > high
-        break;
-      }
+  limbs = (size + B58_LIMB_DIGITS - 1) / B58_LIMB_DIGITS;
+  uint32_t buf[limbs];
+  memzero(buf, sizeof(buf));
+
+  // buf[0], ..., buf[high - 1] are still zero, so the loop over the limbs can
+  // stop at them once there is no carry
+  for (i = zcount, high = limbs; i < binsz; ++i, high = j) {
+    for (carry = bin[i], j = limbs; j > 0 && (j > high || carry); --j) {
+      carry += buf[j - 1] * 256;
+      buf[j - 1] = carry % B58_LIMB;
+      carry /= B58_LIMB;
     }
   }
 
-  for (j = 0; j < size && !buf[j]; ++j)
+  for (j = 0; j < limbs && !buf[j]; ++j)
     ;
 
-  if (*b58sz <= zcount + size - j) {
-    *b58sz = zcount + size - j + 1;
+  if (j < limbs) {
+    // the most significant limb has fewer than four digits in general
+    digits = (limbs - j - 1) * B58_LIMB_DIGITS;
+    for (carry = buf[j]; carry; carry /= 58) ++digits;
+  }
+
+  if (*b58sz <= zcount + digits) {
+    *b58sz = zcount + digits + 1;
+    memzero(buf, sizeof(buf));
     return false;
   }
 
   if (zcount) memset(b58, '1', zcount);
-  for (i = zcount; j < size; ++i, ++j) b58[i] = b58digits_ordered[buf[j]];
-  b58[i] = '\0';
-  *b58sz = i + 1;
+  for (i = zcount + digits, carry = 0; i > zcount; --i) {
+    if ((zcount + digits - i) % B58_LIMB_DIGITS == 0) {
+      carry = buf[--limbs];
+    }
+    b58[i - 1] = b58digits_ordered[carry % 58];
+    carry /= 58;
+  }
+  b58[zcount + digits] = '\0';
+  *b58sz = zcount + digits + 1;
+  memzero(buf, sizeof(buf));
 
   return true;
 }
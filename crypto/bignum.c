@@ -33,6 +33,17 @@
 #include "memzero.h"
 #include "script.h"
 
+#if USE_BN_ASM_ARM &&                                     \
+    (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+     defined(__ARM_ARCH_8M_MAIN__))
+#define BN_ASM_ARM 1
+// lo + hi * 2**32 += a * b
+#define BN_UMLAL(lo, hi, a, b) \
+  __asm__("umlal %0, %1, %2, %3" : "+r"(lo), "+r"(hi) : "r"(a), "r"(b))
+#else
+#define BN_ASM_ARM 0
+#endif
+
 /*
  This library implements 256-bit numbers arithmetic.
 
@@ -554,6 +565,34 @@ void bn_mod(bignum256 *x, const bignum256 *prime) {
   memzero(&temp, sizeof(temp));
 }
 
+#if BN_ASM_ARM
+// Auxiliary function for bn_multiply
+// res = k * x
+// Assumes k and x are normalized
+// Guarantees res is normalized 18 digit little endian number in base 2**29
+void bn_multiply_long(const bignum256 *k, const bignum256 *x, bignum512 *res) {
+  // The same long multiplication as the portable version below with the
+  // accumulator kept in the register pair lo:hi, so every partial product is
+  // a single UMLAL instruction and the accumulator is shifted as two 32-bit
+  // halves
+  uint32_t lo = 0, hi = 0;
+
+  for (int i = 0; i < 2 * BN_LIMBS - 1; i++) {
+    int j_min = i < BN_LIMBS ? 0 : i - BN_LIMBS + 1;
+    int j_max = i < BN_LIMBS ? i : BN_LIMBS - 1;
+    for (int j = j_min; j <= j_max; j++) {
+      BN_UMLAL(lo, hi, k->val[j], x->val[i - j]);
+      // lo + hi * 2**32 doesn't overflow 64 bits, see the portable version
+    }
+
+    res->val[i] = lo & BN_LIMB_MASK;
+    lo = (lo >> BN_BITS_PER_LIMB) | (hi << (32 - BN_BITS_PER_LIMB));
+    hi >>= BN_BITS_PER_LIMB;
+  }
+
+  res->val[2 * BN_LIMBS - 1] = lo;
+}
+#else
 // Auxiliary function for bn_multiply
 // res = k * x
 // Assumes k and x are normalized
@@ -602,6 +641,7 @@ void bn_multiply_long(const bignum256 *k, const bignum256 *x, bignum512 *res) {
 
   res->val[2 * BN_LIMBS - 1] = acc;
 }
+#endif
 
 // Auxiliary function for bn_multiply
 // Assumes 0 <= d <= 8 == LIMBS - 1
@@ -643,6 +683,26 @@ void bn_multiply_reduce_step(bignum512 *res, const bignum256 *prime,
   //     == 2**31
 
   const int shift = 31;
+#if BN_ASM_ARM
+  // ((BASE - 1) << shift) - prime[i] * coef
+  //   == (BASE - 1) * (2**shift - coef) + (BASE - 1 - prime[i]) * coef
+  // Both products are nonnegative since coef < 2**shift and prime is
+  // normalized, so the loop below computes the same acc as the portable
+  // version using only additions and UMLAL
+  const uint64_t addend = (BN_BASE - 1) * ((1ull << shift) - coef);
+  uint32_t lo = 1u << shift, hi = 0;
+
+  for (int i = 0; i < BN_LIMBS; i++) {
+    uint64_t acc = (((uint64_t)hi << 32) | lo) + addend + res->val[d + i];
+    lo = (uint32_t)acc;
+    hi = (uint32_t)(acc >> 32);
+    BN_UMLAL(lo, hi, BN_BASE - 1 - prime->val[i], coef);
+
+    res->val[d + i] = lo & BN_LIMB_MASK;
+    lo = (lo >> BN_BITS_PER_LIMB) | (hi << (32 - BN_BITS_PER_LIMB));
+    hi >>= BN_BITS_PER_LIMB;
+  }
+#else
   uint64_t acc = 1ull << shift;
 
   for (int i = 0; i < BN_LIMBS; i++) {
@@ -673,6 +733,7 @@ void bn_multiply_reduce_step(bignum512 *res, const bignum256 *prime,
     // acc == (1 << BITS_PER_LIMB * (i + 1) + shift) + res[d : d + i + 1]
     //   - coef * prime[:i + 1] >> BITS_PER_LIMB * (i + 1)
   }
+#endif
 
   // acc += (((uint64_t)(BASE - 1)) << shift) + res[d + LIMBS];
   // acc >>= BITS_PER_LIMB;
@@ -996,7 +1057,169 @@ void bn_divide_base(bignum256 *x, const bignum256 *prime) {
   // clang-format on
 }
 
-#if !USE_INVERSE_FAST
+// Auxiliary function for bn_mont_sqr
+// res = x * x
+// Assumes x is normalized
+// Guarantees res is normalized 18 digit little endian number in base 2**29
+void bn_square_long(const bignum256 *x, bignum512 *res) {
+  // Uses long multiplication in base 2**29 where every product
+  // x[j] * x[i - j] with j != i - j is computed only once and doubled
+
+  uint64_t acc = 0;
+
+  for (int i = 0; i < 2 * BN_LIMBS - 1; i++) {
+    uint64_t cross = 0;
+    int j = i < BN_LIMBS ? 0 : i - BN_LIMBS + 1;
+    for (; 2 * j < i; j++) {
+      cross += x->val[j] * (uint64_t)x->val[i - j];
+      // cross doesn't overflow 64 bits
+      // Proof:
+      //   cross <= (LIMBS + 1) / 2 * (2**BITS_PER_LIMB - 1)**2
+      //     <= 5 * 2**58 < 2**61
+    }
+
+    acc += cross << 1;
+    if (2 * j == i) {
+      acc += x->val[j] * (uint64_t)x->val[j];
+    }
+    // acc doesn't overflow 64 bits
+    // Proof:
+    //   acc <= (2**(64 - BITS_PER_LIMB) - 1) +
+    //     LIMBS * (2**BITS_PER_LIMB - 1) * (2**BITS_PER_LIMB - 1)
+    //     <= 2**35 + 9 * 2**58 < 2**64
+
+    res->val[i] = acc & BN_LIMB_MASK;
+    acc >>= BN_BITS_PER_LIMB;
+    // acc <= 2**35 - 1 == 2**(64 - BITS_PER_LIMB) - 1
+  }
+
+  res->val[2 * BN_LIMBS - 1] = acc;
+}
+
+// x = x / 2**261 % prime
+// Explicitly x = (x + m * prime) / 2**(BITS_PER_LIMB * LIMBS) where
+//   m = (-x / prime) % 2**(BITS_PER_LIMB * LIMBS)
+// Assumes x is normalized, x < 2**261 * prime
+// Guarantees x is normalized and partly reduced modulo prime
+// Assumes prime is an odd number and normalized
+void bn_mont_reduce(bignum512 *x, const bignum256 *prime) {
+  // Uses the word-by-word Montgomery reduction, see
+  // https://en.wikipedia.org/wiki/Montgomery_modular_multiplication#The_REDC_algorithm
+
+  // (x + m * prime) / 2**261 < 2 * prime
+  // Proof:
+  //   (x + m * prime) / 2**261
+  //     < (2**261 * prime + 2**261 * prime) / 2**261
+  //     == 2 * prime
+
+  // prime_inverse = (-1 / prime) % 2**BITS_PER_LIMB
+  uint32_t prime_inverse =
+      (BN_BASE - inverse_mod_power_two(prime->val[0], BN_BITS_PER_LIMB)) &
+      BN_LIMB_MASK;
+
+  for (int i = 0; i < BN_LIMBS; i++) {
+    // m = (-x[i] / prime) % 2**BITS_PER_LIMB
+    uint32_t m = (x->val[i] * prime_inverse) & BN_LIMB_MASK;
+
+    uint64_t acc = x->val[i] + (uint64_t)m * prime->val[0];
+    // acc % 2**BITS_PER_LIMB == 0
+    acc >>= BN_BITS_PER_LIMB;
+
+    for (int j = 1; j < BN_LIMBS; j++) {
+      acc += x->val[i + j] + (uint64_t)m * prime->val[j];
+      // acc doesn't overflow 64 bits
+      // Proof:
+      //   acc + x[i + j] + m * prime[j]
+      //     <= (2**(64 - BITS_PER_LIMB) - 1) + (2**32 - 1) +
+      //       (2**BITS_PER_LIMB - 1) * (2**BITS_PER_LIMB - 1)
+      //     <= 2**35 + 2**32 + 2**58 < 2**64
+
+      x->val[i + j] = acc & BN_LIMB_MASK;
+      acc >>= BN_BITS_PER_LIMB;
+      // acc <= 2**30 - 1
+    }
+
+    x->val[i + BN_LIMBS] += acc;
+    // x[i + LIMBS] doesn't overflow 32 bits
+    // Proof:
+    //   x[i + LIMBS] + acc <= (2**BITS_PER_LIMB - 1) + (2**30 - 1) < 2**32
+    // x[i + LIMBS] is normalized in the next iteration unless i == LIMBS - 1
+
+    x->val[i] = 0;
+
+    // x == old(x) + m[:i + 1] * prime, x[:i + 1] == 0
+  }
+
+  // x[LIMBS:] == (old(x) + m * prime) / 2**261 < 2 * prime
+  // x[2 * LIMBS - 1] is normalized because x[LIMBS:] < 2**257
+  for (int i = 0; i < BN_LIMBS; i++) {
+    x->val[i] = x->val[i + BN_LIMBS];
+    x->val[i + BN_LIMBS] = 0;
+  }
+}
+
+// x = k * x / 2**261 % prime
+// Assumes k, x are normalized, k * x < 2**261 * prime
+// Guarantees x is normalized and partly reduced modulo prime
+// Assumes prime is an odd number and normalized
+// If k and x are in Montgomery form (a * 2**261 % prime), so is the result
+void bn_mont_mul(const bignum256 *k, bignum256 *x, const bignum256 *prime) {
+  bignum512 res = {0};
+
+  bn_multiply_long(k, x, &res);
+  bn_mont_reduce(&res, prime);
+  bn_copy_lower(&res, x);
+
+  memzero(&res, sizeof(res));
+}
+
+// x = x * x / 2**261 % prime
+// Assumes x is normalized, x * x < 2**261 * prime
+// Guarantees x is normalized and partly reduced modulo prime
+// Assumes prime is an odd number and normalized
+void bn_mont_sqr(bignum256 *x, const bignum256 *prime) {
+  bignum512 res = {0};
+
+  bn_square_long(x, &res);
+  bn_mont_reduce(&res, prime);
+  bn_copy_lower(&res, x);
+
+  memzero(&res, sizeof(res));
+}
+
+// x = x * 2**261 % prime
+// Assumes x is normalized
+// Assumes r2 == 2**522 % prime (see ecdsa_curve.mont_r2)
+// Guarantees x is normalized and partly reduced modulo prime
+// Assumes prime is an odd number and normalized, prime < 2**256
+void bn_to_mont(bignum256 *x, const bignum256 *r2, const bignum256 *prime) {
+  // x * r2 < 2**261 * prime
+  // Proof:
+  //   x * r2 < 2**(BITS_PER_LIMB * LIMBS) * prime == 2**261 * prime
+  bn_mont_mul(r2, x, prime);
+}
+
+// x = x / 2**261 % prime
+// Assumes x is normalized
+// Guarantees x is normalized and fully reduced modulo prime
+// Assumes prime is an odd number and normalized, prime < 2**256
+void bn_from_mont(bignum256 *x, const bignum256 *prime) {
+  bignum512 res = {0};
+
+  for (int i = 0; i < BN_LIMBS; i++) {
+    res.val[i] = x->val[i];
+  }
+
+  // res == x < 2**261 * prime
+  // (x + m * prime) / 2**261 < 1 + prime, hence the result is at most prime
+  bn_mont_reduce(&res, prime);
+  bn_copy_lower(&res, x);
+  bn_mod(x, prime);
+
+  memzero(&res, sizeof(res));
+}
+
+#if !USE_INVERSE_FAST && !USE_INVERSE_SAFEGCD
 // x = 1/x % prime if x != 0 else 0
 // Assumes x is normalized
 // Assumes prime is a prime number
@@ -1116,7 +1339,7 @@ static void bn_inverse_fast(bignum256 *x, const bignum256 *prime) {
 }
 #endif
 
-#if USE_INVERSE_FAST
+#if USE_INVERSE_FAST && !USE_INVERSE_SAFEGCD
 // x = 1/x % prime if x != 0 else 0
 // Assumes x is is_normalized
 // Assumes GCD(x, prime) = 1
@@ -1725,6 +1948,42 @@ void bn_divmod1000(bignum256 *x, uint32_t *r) {
 // Guarantees x is normalized
 void bn_divmod10(bignum256 *x, uint32_t *r) { bn_long_division(x, 10, x, r); }
 
+// Decimal digits of a number for bn_format, from the least significant one.
+// The number is divided by 10**BN_DIGITS_CHUNK at once and the digits of the
+// remainder are taken one by one, which needs a quarter of the long divisions
+// of dividing by 10 for every digit.
+#define BN_DIGITS_CHUNK 4
+#define BN_DIGITS_CHUNK_DIVISOR 10000
+
+typedef struct {
+  bignum256 x;     // the digits not yet moved to chunk
+  uint32_t chunk;  // the next digits, x * 10**digits + chunk is the rest
+  int digits;      // the number of digits in chunk
+} bn_digits;
+
+static void bn_digits_init(bn_digits *d, const bignum256 *x) {
+  bn_copy(x, &d->x);
+  d->chunk = 0;
+  d->digits = 0;
+}
+
+// Returns the next digit of d
+static uint32_t bn_digits_next(bn_digits *d) {
+  if (d->digits == 0) {
+    bn_long_division(&d->x, BN_DIGITS_CHUNK_DIVISOR, &d->x, &d->chunk);
+    d->digits = BN_DIGITS_CHUNK;
+  }
+  uint32_t digit = d->chunk % 10;
+  d->chunk /= 10;
+  --d->digits;
+  return digit;
+}
+
+// Returns whether the remaining digits of d are all zero
+static bool bn_digits_is_zero(const bn_digits *d) {
+  return d->chunk == 0 && bn_is_zero(&d->x);
+}
+
 // Formats amount
 // Assumes amount is normalized
 // Assumes prefix and suffix are null-terminated strings
@@ -1771,8 +2030,8 @@ size_t bn_format(const bignum256 *amount, const char *prefix, const char *suffix
     }                                                              \
   }
 
-  bignum256 temp = {0};
-  bn_copy(amount, &temp);
+  bn_digits temp = {0};
+  bn_digits_init(&temp, amount);
   uint32_t digit = 0;
 
   char *position = output + output_length;
@@ -1788,11 +2047,11 @@ size_t bn_format(const bignum256 *amount, const char *prefix, const char *suffix
   // amount //= 10**exponent
   for (; exponent < 0; ++exponent) {
     // if temp == 0, there is no need to divide it by 10 anymore
-    if (bn_is_zero(&temp)) {
+    if (bn_digits_is_zero(&temp)) {
       exponent = 0;
       break;
     }
-    bn_divmod10(&temp, &digit);
+    bn_digits_next(&temp);
   }
 
   // exponent >= 0 && decimals >= 0
@@ -1817,13 +2076,13 @@ size_t bn_format(const bignum256 *amount, const char *prefix, const char *suffix
 
     // Add significant digits and leading zeroes
     for (; decimals > 0; --decimals) {
-      bn_divmod10(&temp, &digit);
+      digit = bn_digits_next(&temp);
 
       if (fractional_part || digit || trailing) {
         fractional_part = true;
         BN_FORMAT_ADD_OUTPUT_CHAR('0' + digit)
       }
-      else if (bn_is_zero(&temp)) {
+      else if (bn_digits_is_zero(&temp)) {
         // We break since the remaining digits are zeroes and fractional_part == trailing == false
         decimals = 0;
         break;
@@ -1839,7 +2098,7 @@ size_t bn_format(const bignum256 *amount, const char *prefix, const char *suffix
   {  // Add integer-part digits of amount
     // Add trailing zeroes
     int digits = 0;
-    if (!bn_is_zero(&temp)) {
+    if (!bn_digits_is_zero(&temp)) {
       for (; exponent > 0; --exponent) {
         ++digits;
         BN_FORMAT_ADD_OUTPUT_CHAR('0')
@@ -1854,8 +2113,8 @@ size_t bn_format(const bignum256 *amount, const char *prefix, const char *suffix
     bool is_zero = false;
     do {
       ++digits;
-      bn_divmod10(&temp, &digit);
-      is_zero = bn_is_zero(&temp);
+      digit = bn_digits_next(&temp);
+      is_zero = bn_digits_is_zero(&temp);
       BN_FORMAT_ADD_OUTPUT_CHAR('0' + digit)
       if (thousands != 0 && !is_zero && digits % 3 == 0) {
         BN_FORMAT_ADD_OUTPUT_CHAR(thousands)
@@ -1898,7 +2157,290 @@ void bn_print_raw(const bignum256 *x) {
 }
 #endif
 
-#if USE_INVERSE_FAST
+#if USE_INVERSE_SAFEGCD
+// The safegcd inversion works with signed numbers
+//   v[0] + v[1] * 2**30 + ... + v[8] * 2**240
+// where v[0], ..., v[7] are usually in [0, 2**30) and v[8] is signed
+#define SIGNED30_LIMBS 9
+#define SIGNED30_MASK ((int32_t)0x3FFFFFFF)
+
+typedef struct {
+  int32_t v[SIGNED30_LIMBS];
+} bn_signed30;
+
+// transition matrix of 30 divsteps, scaled by 2**30
+typedef struct {
+  int32_t u, v, q, r;
+} bn_trans2x2;
+
+// Assumes x is normalized
+// Guarantees r represents x with all limbs in [0, 2**30)
+static void bn_to_signed30(const bignum256 *x, bn_signed30 *r) {
+  uint64_t acc = 0;
+  int bits = 0, j = 0;
+
+  for (int i = 0; i < BN_LIMBS; i++) {
+    acc |= (uint64_t)x->val[i] << bits;
+    bits += BN_BITS_PER_LIMB;
+    if (bits >= 30) {
+      r->v[j++] = (int32_t)(acc & SIGNED30_MASK);
+      acc >>= 30;
+      bits -= 30;
+    }
+  }
+  r->v[j] = (int32_t)acc;
+  // j == SIGNED30_LIMBS - 1
+}
+
+// Assumes all limbs of x are in [0, 2**30) and x < 2**261
+// Guarantees r is normalized
+static void bn_from_signed30(const bn_signed30 *x, bignum256 *r) {
+  uint64_t acc = 0;
+  int bits = 0, j = 0;
+
+  for (int i = 0; i < SIGNED30_LIMBS; i++) {
+    acc |= (uint64_t)x->v[i] << bits;
+    bits += 30;
+    while (bits >= BN_BITS_PER_LIMB && j < BN_LIMBS) {
+      // the condition depends only on the iteration number
+      r->val[j++] = acc & BN_LIMB_MASK;
+      acc >>= BN_BITS_PER_LIMB;
+      bits -= BN_BITS_PER_LIMB;
+    }
+  }
+}
+
+// Computes 30 divsteps of the safegcd algorithm on the lowest bits f and g of
+//   the current values, zeta = -(delta + 1/2)
+// Guarantees t is the transition matrix of the divsteps scaled by 2**30
+// Returns the new zeta
+// The function has constant control flow and constant memory access flow
+static int32_t bn_divsteps_30(int32_t zeta, uint32_t f, uint32_t g,
+                              bn_trans2x2 *t) {
+  // Uses the constant time variant from "Fast constant-time gcd computation
+  // and modular inversion" by Daniel J. Bernstein and Bo-Yin Yang, see
+  // https://gcd.cr.yp.to/safegcd-20190413.pdf
+  // as implemented by secp256k1_modinv32_divsteps_30 in libsecp256k1
+
+  uint32_t u = 1, v = 0, q = 0, r = 1;
+  uint32_t c1 = 0, c2 = 0, x = 0, y = 0, z = 0;
+
+  for (int i = 0; i < 30; i++) {
+    // invariants: f is odd, (u * f0 + v * g0) == f * 2**i and
+    //   (q * f0 + r * g0) == g * 2**i modulo 2**32
+
+    // c1 = 0xFFFFFFFF if zeta < 0 else 0
+    c1 = (uint32_t)(zeta >> 31);
+    // c2 = 0xFFFFFFFF if g is odd else 0
+    c2 = -(g & 1);
+    // (x, y, z) = (zeta < 0) ? (-f, -u, -v) : (f, u, v)
+    x = (f ^ c1) - c1;
+    y = (u ^ c1) - c1;
+    z = (v ^ c1) - c1;
+    // if g is odd, add (x, y, z) to (g, q, r), which makes g even
+    g += x & c2;
+    q += y & c2;
+    r += z & c2;
+    // if zeta < 0 and g was odd, swap the roles of f and g: negate zeta and
+    // let (f, u, v) += (g, q, r), which results in the old (g, q, r)
+    c1 &= c2;
+    zeta = (zeta ^ (int32_t)c1) - 1;
+    f += g & c1;
+    u += q & c1;
+    v += r & c1;
+    // g is even now
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+
+  t->u = (int32_t)u;
+  t->v = (int32_t)v;
+  t->q = (int32_t)q;
+  t->r = (int32_t)r;
+
+  return zeta;
+}
+
+// [d, e] = (t * [d, e] + modulus * [md, me]) / 2**30 with md and me chosen
+//   so that the division is exact
+// Assumes d and e are in (-2 * modulus, modulus)
+// Guarantees d and e are in (-2 * modulus, modulus)
+// modulus_inv30 is 1/modulus mod 2**30
+static void bn_update_de_30(bn_signed30 *d, bn_signed30 *e,
+                            const bn_trans2x2 *t, const bn_signed30 *modulus,
+                            uint32_t modulus_inv30) {
+  const int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+  int32_t di = 0, ei = 0, md = 0, me = 0, sd = 0, se = 0;
+  int64_t cd = 0, ce = 0;
+
+  // md and me start as [u, q] if d is negative plus [v, r] if e is negative,
+  //   which keeps the result in range
+  sd = d->v[SIGNED30_LIMBS - 1] >> 31;
+  se = e->v[SIGNED30_LIMBS - 1] >> 31;
+  md = (u & sd) + (v & se);
+  me = (q & sd) + (r & se);
+
+  di = d->v[0];
+  ei = e->v[0];
+  cd = (int64_t)u * di + (int64_t)v * ei;
+  ce = (int64_t)q * di + (int64_t)r * ei;
+
+  // correct md and me so that the lowest 30 bits of the sums are zero
+  md -= (modulus_inv30 * (uint32_t)cd + md) & SIGNED30_MASK;
+  me -= (modulus_inv30 * (uint32_t)ce + me) & SIGNED30_MASK;
+
+  cd += (int64_t)modulus->v[0] * md;
+  ce += (int64_t)modulus->v[0] * me;
+  assert(((int32_t)cd & SIGNED30_MASK) == 0);
+  assert(((int32_t)ce & SIGNED30_MASK) == 0);
+  cd >>= 30;
+  ce >>= 30;
+
+  for (int i = 1; i < SIGNED30_LIMBS; i++) {
+    di = d->v[i];
+    ei = e->v[i];
+    cd += (int64_t)u * di + (int64_t)v * ei;
+    ce += (int64_t)q * di + (int64_t)r * ei;
+    cd += (int64_t)modulus->v[i] * md;
+    ce += (int64_t)modulus->v[i] * me;
+    d->v[i - 1] = (int32_t)cd & SIGNED30_MASK;
+    e->v[i - 1] = (int32_t)ce & SIGNED30_MASK;
+    cd >>= 30;
+    ce >>= 30;
+  }
+  d->v[SIGNED30_LIMBS - 1] = (int32_t)cd;
+  e->v[SIGNED30_LIMBS - 1] = (int32_t)ce;
+}
+
+// [f, g] = t * [f, g] / 2**30
+// The lowest 30 bits of t * [f, g] are zero by the construction of t
+static void bn_update_fg_30(bn_signed30 *f, bn_signed30 *g,
+                            const bn_trans2x2 *t) {
+  const int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+  int32_t fi = 0, gi = 0;
+  int64_t cf = 0, cg = 0;
+
+  fi = f->v[0];
+  gi = g->v[0];
+  cf = (int64_t)u * fi + (int64_t)v * gi;
+  cg = (int64_t)q * fi + (int64_t)r * gi;
+  assert(((int32_t)cf & SIGNED30_MASK) == 0);
+  assert(((int32_t)cg & SIGNED30_MASK) == 0);
+  cf >>= 30;
+  cg >>= 30;
+
+  for (int i = 1; i < SIGNED30_LIMBS; i++) {
+    fi = f->v[i];
+    gi = g->v[i];
+    cf += (int64_t)u * fi + (int64_t)v * gi;
+    cg += (int64_t)q * fi + (int64_t)r * gi;
+    f->v[i - 1] = (int32_t)cf & SIGNED30_MASK;
+    g->v[i - 1] = (int32_t)cg & SIGNED30_MASK;
+    cf >>= 30;
+    cg >>= 30;
+  }
+  f->v[SIGNED30_LIMBS - 1] = (int32_t)cf;
+  g->v[SIGNED30_LIMBS - 1] = (int32_t)cg;
+}
+
+// x = x + modulus if x < 0
+// Assumes the limbs of x are in (-2**31, 2**31)
+// Guarantees x[0], ..., x[7] are in [0, 2**30)
+static void bn_signed30_add_if_negative(bn_signed30 *x,
+                                        const bn_signed30 *modulus) {
+  int32_t cond_add = x->v[SIGNED30_LIMBS - 1] >> 31;
+
+  for (int i = 0; i < SIGNED30_LIMBS; i++) {
+    x->v[i] += modulus->v[i] & cond_add;
+  }
+  for (int i = 0; i < SIGNED30_LIMBS - 1; i++) {
+    x->v[i + 1] += x->v[i] >> 30;
+    x->v[i] &= SIGNED30_MASK;
+  }
+}
+
+// x = 1/x % prime if x != 0 else 0
+// Assumes x is normalized
+// Assumes GCD(x, prime) = 1
+// Guarantees x is normalized and fully reduced modulo prime
+// Assumes prime is odd, normalized, 2**256 - 2**224 <= prime <= 2**256
+// The function has constant control flow and constant memory access flow
+static void bn_inverse_safegcd(bignum256 *x, const bignum256 *prime) {
+  // Uses the safegcd algorithm from "Fast constant-time gcd computation and
+  // modular inversion" by Daniel J. Bernstein and Bo-Yin Yang in batches of
+  // 30 divsteps, following secp256k1_modinv32 from libsecp256k1, see
+  // https://github.com/bitcoin-core/secp256k1/blob/master/doc/safegcd_implementation.md
+
+  /*
+    f, g = prime, x
+    d, e = 0, 1
+    delta = 1/2
+    repeat 590 times:
+      if delta > 0 and g is odd:
+        delta, f, g, d, e = 1 - delta, g, (g - f) / 2, e, (e - d) / 2
+      elif g is odd:
+        delta, g, e = 1 + delta, (g + f) / 2, (e + d) / 2
+      else:
+        delta, g, e = 1 + delta, g / 2, e / 2
+    # f == 1 or f == -1 and d == f / x
+    return f * d % prime
+  */
+
+  bn_signed30 modulus = {0}, f = {0}, g = {0}, d = {0}, e = {0};
+  bn_trans2x2 t = {0};
+  int32_t zeta = -1;  // zeta = -(delta + 1/2), delta is initially 1/2
+
+  bn_fast_mod(x, prime);
+  bn_mod(x, prime);
+
+  bn_to_signed30(prime, &modulus);
+  uint32_t modulus_inv30 =
+      inverse_mod_power_two((uint32_t)modulus.v[0], 30) & SIGNED30_MASK;
+
+  f = modulus;
+  bn_to_signed30(x, &g);
+  e.v[0] = 1;
+
+  // 20 * 30 = 600 divsteps, 590 are enough for 256-bit numbers, see
+  // "Bounds on divsteps iterations" in
+  // https://github.com/sipa/safegcd-bounds
+  for (int i = 0; i < 20; i++) {
+    zeta = bn_divsteps_30(zeta, (uint32_t)f.v[0], (uint32_t)g.v[0], &t);
+    bn_update_de_30(&d, &e, &t, &modulus, modulus_inv30);
+    bn_update_fg_30(&f, &g, &t);
+  }
+  // g == 0 and f == 1 or f == -1, d is in (-2 * prime, prime)
+
+  // d = f * d % prime
+  // the first addition brings d to (-prime, prime), the negation keeps it
+  // there and the second addition brings it to [0, prime)
+  bn_signed30_add_if_negative(&d, &modulus);
+  int32_t cond_negate = f.v[SIGNED30_LIMBS - 1] >> 31;
+  for (int i = 0; i < SIGNED30_LIMBS; i++) {
+    d.v[i] = (d.v[i] ^ cond_negate) - cond_negate;
+  }
+  for (int i = 0; i < SIGNED30_LIMBS - 1; i++) {
+    d.v[i + 1] += d.v[i] >> 30;
+    d.v[i] &= SIGNED30_MASK;
+  }
+  bn_signed30_add_if_negative(&d, &modulus);
+
+  bn_from_signed30(&d, x);
+
+  memzero(&f, sizeof(f));
+  memzero(&g, sizeof(g));
+  memzero(&d, sizeof(d));
+  memzero(&e, sizeof(e));
+  memzero(&t, sizeof(t));
+}
+#endif
+
+#if USE_INVERSE_SAFEGCD
+void bn_inverse(bignum256 *x, const bignum256 *prime) {
+  bn_inverse_safegcd(x, prime);
+}
+#elif USE_INVERSE_FAST
 void bn_inverse(bignum256 *x, const bignum256 *prime) {
   bn_inverse_fast(x, prime);
 }
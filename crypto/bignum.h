@@ -101,6 +101,7 @@ void bn_mult_half(bignum256 *x, const bignum256 *prime);
 void bn_mult_k(bignum256 *x, uint8_t k, const bignum256 *prime);
 void bn_mod(bignum256 *x, const bignum256 *prime);
 void bn_multiply(const bignum256 *k, bignum256 *x, const bignum256 *prime);
+void bn_multiply_long(const bignum256 *k, const bignum256 *x, bignum512 *res);
 void bn_reduce(bignum512 *x, const bignum256 *prime);
 void bn_fast_mod(bignum256 *x, const bignum256 *prime);
 void bn_power_mod(const bignum256 *x, const bignum256 *e,
@@ -108,6 +109,11 @@ void bn_power_mod(const bignum256 *x, const bignum256 *e,
 void bn_sqrt(bignum256 *x, const bignum256 *prime);
 uint32_t inverse_mod_power_two(uint32_t a, uint32_t n);
 void bn_divide_base(bignum256 *x, const bignum256 *prime);
+void bn_mont_reduce(bignum512 *x, const bignum256 *prime);
+void bn_mont_mul(const bignum256 *k, bignum256 *x, const bignum256 *prime);
+void bn_mont_sqr(bignum256 *x, const bignum256 *prime);
+void bn_to_mont(bignum256 *x, const bignum256 *r2, const bignum256 *prime);
+void bn_from_mont(bignum256 *x, const bignum256 *prime);
 void bn_normalize(bignum256 *x);
 void bn_add(bignum256 *x, const bignum256 *y);
 void bn_addmod(bignum256 *x, const bignum256 *y, const bignum256 *prime);
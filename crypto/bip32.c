@@ -328,82 +328,191 @@ int hdnode_public_ckd(HDNode *inout, uint32_t i) {
   return result == ECDSA_TWEAK_PUBKEY_SUCCESS;
 }
 
+// number of children of hdnode_public_ckd_range sharing a field inversion
+#define PUBLIC_CKD_BATCH_SIZE 8
+
+// out[k] = child start + k of parent for 0 <= k < count
+// The public key of parent is decompressed only once and the conversions of
+// the children to affine coordinates share a single field inversion, which
+// makes scanning consecutive addresses of an account considerably faster
+// than calling hdnode_public_ckd for each of them.
+int hdnode_public_ckd_range(const HDNode *parent, uint32_t start, size_t count,
+                            HDNode *out) {
+  const ecdsa_curve *curve = parent->curve->params;
+  if (!curve) {
+    // see hdnode_public_ckd
+    return 0;
+  }
+
+  if (count == 0) {
+    return 1;
+  }
+
+  if ((start & 0x80000000) || count > 0x80000000 - start) {
+    // private derivation
+    return 0;
+  }
+
+  curve_point public_key = {0};
+  if (!ecdsa_read_pubkey(curve, parent->public_key, &public_key)) {
+    return 0;
+  }
+
+  uint8_t data[33 + 4] = {0};
+  uint8_t digest[32 + 32] = {0};
+  bignum256 tweak = {0};
+  jacobian_curve_point jp[PUBLIC_CKD_BATCH_SIZE] = {0};
+  curve_point p[PUBLIC_CKD_BATCH_SIZE] = {0};
+  bool valid[PUBLIC_CKD_BATCH_SIZE] = {0};
+  int result = 1;
+
+  memcpy(data, parent->public_key, 33);
+
+  for (size_t k = 0; k < count; k += PUBLIC_CKD_BATCH_SIZE) {
+    size_t n = count - k;
+    if (n > PUBLIC_CKD_BATCH_SIZE) {
+      n = PUBLIC_CKD_BATCH_SIZE;
+    }
+
+    for (size_t j = 0; j < n; j++) {
+      HDNode *child = &out[k + j];
+      memcpy(child, parent, sizeof(HDNode));
+      child->depth++;
+      child->child_num = start + k + j;
+      memzero(child->private_key, 32);
+
+      write_be(data + 33, child->child_num);
+      hmac_sha512(parent->chain_code, 32, data, sizeof(data), digest);
+      memcpy(child->chain_code, digest + 32, 32);
+
+      bn_read_be(digest, &tweak);
+      valid[j] = bn_is_less(&tweak, &curve->order);
+      if (valid[j]) {
+        (void)scalar_multiply_jacobian(curve, &tweak, &jp[j]);
+        point_jacobian_add(&public_key, &jp[j], curve);
+      } else {
+        point_jacobian_set_infinity(&jp[j]);
+      }
+    }
+
+    jacobian_to_curve_batch(jp, p, n, &curve->prime);
+
+    for (size_t j = 0; j < n; j++) {
+      HDNode *child = &out[k + j];
+      if (!valid[j] || point_is_infinity(&p[j])) {
+        // The tweak is not less than the order of the curve or the child public
+        // key is the point at infinity, which happens with a negligible
+        // probability, hdnode_public_ckd handles the retry
+        memcpy(child, parent, sizeof(HDNode));
+        if (!hdnode_public_ckd(child, start + k + j)) {
+          result = 0;
+        }
+        continue;
+      }
+      compress_coords(&p[j], child->public_key);
+    }
+  }
+
+  memzero(digest, sizeof(digest));
+  memzero(&tweak, sizeof(tweak));
+
+  return result;
+}
+
 #if USE_BIP32_CACHE
-static bool private_ckd_cache_root_set = false;
-static CONFIDENTIAL HDNode private_ckd_cache_root;
-static int private_ckd_cache_index = 0;
+// The cache holds nodes of any depth from 1 to BIP32_CACHE_MAXDEPTH derived
+// from any root, the root of an entry is identified by the SHA-256 of the root
+// HDNode. The least recently used entry is replaced.
+static uint32_t private_ckd_cache_counter = 0;
 
 static CONFIDENTIAL struct {
   bool set;
+  uint32_t last_used;
+  uint8_t root_hash[SHA256_DIGEST_LENGTH];
   size_t depth;
   uint32_t i[BIP32_CACHE_MAXDEPTH];
   HDNode node;
 } private_ckd_cache[BIP32_CACHE_SIZE];
 
 void bip32_cache_clear(void) {
-  private_ckd_cache_root_set = false;
-  private_ckd_cache_index = 0;
-  memzero(&private_ckd_cache_root, sizeof(private_ckd_cache_root));
+  private_ckd_cache_counter = 0;
   memzero(private_ckd_cache, sizeof(private_ckd_cache));
 }
 
+static void private_ckd_cache_store(const uint8_t *root_hash,
+                                    const uint32_t *i, size_t depth,
+                                    const HDNode *node) {
+  int k = 0;
+  for (int j = 0; j < BIP32_CACHE_SIZE; j++) {
+    if (!private_ckd_cache[j].set) {
+      k = j;
+      break;
+    }
+    if (private_ckd_cache[j].last_used < private_ckd_cache[k].last_used) {
+      k = j;
+    }
+  }
+
+  memzero(&(private_ckd_cache[k]), sizeof(private_ckd_cache[k]));
+  private_ckd_cache[k].set = true;
+  private_ckd_cache[k].last_used = ++private_ckd_cache_counter;
+  memcpy(private_ckd_cache[k].root_hash, root_hash, SHA256_DIGEST_LENGTH);
+  private_ckd_cache[k].depth = depth;
+  memcpy(private_ckd_cache[k].i, i, depth * sizeof(uint32_t));
+  memcpy(&(private_ckd_cache[k].node), node, sizeof(HDNode));
+}
+
 int hdnode_private_ckd_cached(HDNode *inout, const uint32_t *i, size_t i_count,
                               uint32_t *fingerprint) {
   if (i_count == 0) {
     // no way how to compute parent fingerprint
     return 1;
   }
-  if (i_count == 1) {
+  if (i_count == 1 || i_count - 1 > BIP32_CACHE_MAXDEPTH) {
+    // nothing to cache or the parent path doesn't fit into the cache
+    size_t k = 0;
+    for (k = 0; k < i_count - 1; k++) {
+      if (hdnode_private_ckd(inout, i[k]) == 0) return 0;
+    }
     if (fingerprint) {
       *fingerprint = hdnode_fingerprint(inout);
     }
-    if (hdnode_private_ckd(inout, i[0]) == 0) return 0;
+    if (hdnode_private_ckd(inout, i[i_count - 1]) == 0) return 0;
     return 1;
   }
 
-  bool found = false;
-  // if root is not set or not the same
-  if (!private_ckd_cache_root_set ||
-      memcmp(&private_ckd_cache_root, inout, sizeof(HDNode)) != 0) {
-    // clear the cache
-    private_ckd_cache_index = 0;
-    memzero(private_ckd_cache, sizeof(private_ckd_cache));
-    // setup new root
-    memcpy(&private_ckd_cache_root, inout, sizeof(HDNode));
-    private_ckd_cache_root_set = true;
-  } else {
-    // try to find parent
-    int j = 0;
-    for (j = 0; j < BIP32_CACHE_SIZE; j++) {
-      if (private_ckd_cache[j].set &&
-          private_ckd_cache[j].depth == i_count - 1 &&
-          memcmp(private_ckd_cache[j].i, i, (i_count - 1) * sizeof(uint32_t)) ==
-              0 &&
-          private_ckd_cache[j].node.curve == inout->curve) {
-        memcpy(inout, &(private_ckd_cache[j].node), sizeof(HDNode));
-        found = true;
-        break;
-      }
+  uint8_t root_hash[SHA256_DIGEST_LENGTH] = {0};
+  sha256_Raw((const uint8_t *)inout, sizeof(HDNode), root_hash);
+
+  // find the longest cached prefix of the parent path
+  int found = -1;
+  size_t depth = 0;
+  for (int j = 0; j < BIP32_CACHE_SIZE; j++) {
+    if (private_ckd_cache[j].set && private_ckd_cache[j].depth > depth &&
+        private_ckd_cache[j].depth <= i_count - 1 &&
+        private_ckd_cache[j].node.curve == inout->curve &&
+        memcmp(private_ckd_cache[j].root_hash, root_hash,
+               SHA256_DIGEST_LENGTH) == 0 &&
+        memcmp(private_ckd_cache[j].i, i,
+               private_ckd_cache[j].depth * sizeof(uint32_t)) == 0) {
+      found = j;
+      depth = private_ckd_cache[j].depth;
     }
   }
+  if (found >= 0) {
+    memcpy(inout, &(private_ckd_cache[found].node), sizeof(HDNode));
+    private_ckd_cache[found].last_used = ++private_ckd_cache_counter;
+  }
 
-  // else derive parent
-  if (!found) {
-    size_t k = 0;
-    for (k = 0; k < i_count - 1; k++) {
-      if (hdnode_private_ckd(inout, i[k]) == 0) return 0;
+  // derive the rest of the parent path and save every intermediate node
+  for (; depth < i_count - 1; depth++) {
+    if (hdnode_private_ckd(inout, i[depth]) == 0) {
+      memzero(root_hash, sizeof(root_hash));
+      return 0;
     }
-    // and save it
-    memzero(&(private_ckd_cache[private_ckd_cache_index]),
-            sizeof(private_ckd_cache[private_ckd_cache_index]));
-    private_ckd_cache[private_ckd_cache_index].set = true;
-    private_ckd_cache[private_ckd_cache_index].depth = i_count - 1;
-    memcpy(private_ckd_cache[private_ckd_cache_index].i, i,
-           (i_count - 1) * sizeof(uint32_t));
-    memcpy(&(private_ckd_cache[private_ckd_cache_index].node), inout,
-           sizeof(HDNode));
-    private_ckd_cache_index = (private_ckd_cache_index + 1) % BIP32_CACHE_SIZE;
+    private_ckd_cache_store(root_hash, i, depth + 1, inout);
   }
+  memzero(root_hash, sizeof(root_hash));
 
   if (fingerprint) {
     *fingerprint = hdnode_fingerprint(inout);
@@ -433,6 +542,38 @@ int hdnode_get_address(HDNode *node, uint32_t version, char *addr,
   return 0;
 }
 
+// Computes the base58 addresses of the children start, ..., start + count - 1
+// of parent, the address of child start + k is stored at addrs + k * addrsize
+int hdnode_get_addresses(HDNode *parent, uint32_t version, uint32_t start,
+                         size_t count, char *addrs, int addrsize) {
+  HDNode children[PUBLIC_CKD_BATCH_SIZE] = {0};
+  int result = 0;
+
+  if (hdnode_fill_public_key(parent) != 0) {
+    return 1;
+  }
+
+  for (size_t k = 0; k < count; k += PUBLIC_CKD_BATCH_SIZE) {
+    size_t n = count - k;
+    if (n > PUBLIC_CKD_BATCH_SIZE) {
+      n = PUBLIC_CKD_BATCH_SIZE;
+    }
+    if (!hdnode_public_ckd_range(parent, start + k, n, children)) {
+      result = 1;
+      break;
+    }
+    for (size_t j = 0; j < n; j++) {
+      ecdsa_get_address(children[j].public_key, version,
+                        parent->curve->hasher_pubkey,
+                        parent->curve->hasher_base58,
+                        addrs + (k + j) * addrsize, addrsize);
+    }
+  }
+
+  memzero(children, sizeof(children));
+  return result;
+}
+
 int hdnode_fill_public_key(HDNode *node) {
   if (node->is_public_key_set) {
     return 0;
@@ -76,6 +76,8 @@ int hdnode_from_seed(const uint8_t *seed, int seed_len, const char *curve,
 
 int hdnode_private_ckd(HDNode *inout, uint32_t i);
 int hdnode_public_ckd(HDNode *inout, uint32_t i);
+int hdnode_public_ckd_range(const HDNode *parent, uint32_t start, size_t count,
+                            HDNode *out);
 
 #if USE_BIP32_CACHE
 void bip32_cache_clear(void);
@@ -132,6 +134,8 @@ int hdnode_deserialize_private(const char *str, uint32_t version,
 int hdnode_get_address_raw(HDNode *node, uint32_t version, uint8_t *addr_raw);
 int hdnode_get_address(HDNode *node, uint32_t version, char *addr,
                        int addrsize);
+int hdnode_get_addresses(HDNode *parent, uint32_t version, uint32_t start,
+                         size_t count, char *addrs, int addrsize);
 
 const curve_info *get_curve_by_name(const char *curve_name);
 
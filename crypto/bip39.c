@@ -34,18 +34,40 @@
 
 #if USE_BIP39_CACHE
 
-static int bip39_cache_index = 0;
+// The entries are identified by an HMAC-SHA256 of the mnemonic and the
+// passphrase under a random key, so the cache doesn't keep them in plaintext.
+// The least recently used entry is replaced.
+static bool bip39_cache_key_set = false;
+static uint32_t bip39_cache_counter = 0;
+static CONFIDENTIAL uint8_t bip39_cache_key[32];
 
 static CONFIDENTIAL struct {
   bool set;
-  char mnemonic[256];
-  char passphrase[64];
+  uint32_t last_used;
+  uint8_t id[SHA256_DIGEST_LENGTH];
   uint8_t seed[512 / 8];
 } bip39_cache[BIP39_CACHE_SIZE];
 
 void bip39_cache_clear(void) {
   memzero(bip39_cache, sizeof(bip39_cache));
-  bip39_cache_index = 0;
+  memzero(bip39_cache_key, sizeof(bip39_cache_key));
+  bip39_cache_key_set = false;
+  bip39_cache_counter = 0;
+}
+
+static void bip39_cache_id(const char *mnemonic, int mnemoniclen,
+                           const char *passphrase, int passphraselen,
+                           uint8_t id[SHA256_DIGEST_LENGTH]) {
+  static CONFIDENTIAL HMAC_SHA256_CTX hctx;
+  if (!bip39_cache_key_set) {
+    random_buffer(bip39_cache_key, sizeof(bip39_cache_key));
+    bip39_cache_key_set = true;
+  }
+  hmac_sha256_Init(&hctx, bip39_cache_key, sizeof(bip39_cache_key));
+  // the mnemonic doesn't contain a NUL character, the encoding is unambiguous
+  hmac_sha256_Update(&hctx, (const uint8_t *)mnemonic, mnemoniclen + 1);
+  hmac_sha256_Update(&hctx, (const uint8_t *)passphrase, passphraselen);
+  hmac_sha256_Final(&hctx, id);
 }
 
 #endif
@@ -192,15 +214,16 @@ void mnemonic_to_seed(const char *mnemonic, const char *passphrase,
   int passphraselen = strnlen(passphrase, 256);
 #if USE_BIP39_CACHE
   // check cache
-  if (mnemoniclen < 256 && passphraselen < 64) {
-    for (int i = 0; i < BIP39_CACHE_SIZE; i++) {
-      if (!bip39_cache[i].set) continue;
-      if (strcmp(bip39_cache[i].mnemonic, mnemonic) != 0) continue;
-      if (strcmp(bip39_cache[i].passphrase, passphrase) != 0) continue;
-      // found the correct entry
-      memcpy(seed, bip39_cache[i].seed, 512 / 8);
-      return;
-    }
+  uint8_t id[SHA256_DIGEST_LENGTH] = {0};
+  bip39_cache_id(mnemonic, mnemoniclen, passphrase, passphraselen, id);
+  for (int i = 0; i < BIP39_CACHE_SIZE; i++) {
+    if (!bip39_cache[i].set) continue;
+    if (memcmp(bip39_cache[i].id, id, sizeof(id)) != 0) continue;
+    // found the correct entry
+    bip39_cache[i].last_used = ++bip39_cache_counter;
+    memcpy(seed, bip39_cache[i].seed, 512 / 8);
+    memzero(id, sizeof(id));
+    return;
   }
 #endif
   uint8_t salt[8 + 256] = {0};
@@ -223,13 +246,21 @@ void mnemonic_to_seed(const char *mnemonic, const char *passphrase,
   memzero(salt, sizeof(salt));
 #if USE_BIP39_CACHE
   // store to cache
-  if (mnemoniclen < 256 && passphraselen < 64) {
-    bip39_cache[bip39_cache_index].set = true;
-    strcpy(bip39_cache[bip39_cache_index].mnemonic, mnemonic);
-    strcpy(bip39_cache[bip39_cache_index].passphrase, passphrase);
-    memcpy(bip39_cache[bip39_cache_index].seed, seed, 512 / 8);
-    bip39_cache_index = (bip39_cache_index + 1) % BIP39_CACHE_SIZE;
+  int k = 0;
+  for (int i = 0; i < BIP39_CACHE_SIZE; i++) {
+    if (!bip39_cache[i].set) {
+      k = i;
+      break;
+    }
+    if (bip39_cache[i].last_used < bip39_cache[k].last_used) {
+      k = i;
+    }
   }
+  bip39_cache[k].set = true;
+  bip39_cache[k].last_used = ++bip39_cache_counter;
+  memcpy(bip39_cache[k].id, id, sizeof(id));
+  memcpy(bip39_cache[k].seed, seed, 512 / 8);
+  memzero(id, sizeof(id));
 #endif
 }
 
@@ -251,14 +282,29 @@ int mnemonic_find_word(const char *word) {
   return -1;
 }
 
-const char *mnemonic_complete_word(const char *prefix, int len) {
-  // we need to perform linear search,
-  // because we want to return the first match
-  for (int i = 0; i < BIP39_WORD_COUNT; i++) {
-    if (strncmp(BIP39_WORDLIST_ENGLISH[i], prefix, len) == 0) {
-      return BIP39_WORDLIST_ENGLISH[i];
+// returns the index of the first word of the wordlist which is not less than
+// the first len characters of prefix, the wordlist is sorted so all the words
+// starting with prefix follow it
+static int mnemonic_prefix_lower_bound(const char *prefix, int len) {
+  int lo = 0, hi = BIP39_WORD_COUNT;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (strncmp(BIP39_WORDLIST_ENGLISH[mid], prefix, len) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+  return lo;
+}
+
+const char *mnemonic_complete_word(const char *prefix, int len) {
+  // the first match is the lower bound of prefix if there is any
+  int i = mnemonic_prefix_lower_bound(prefix, len);
+  if (i < BIP39_WORD_COUNT &&
+      strncmp(BIP39_WORDLIST_ENGLISH[i], prefix, len) == 0) {
+    return BIP39_WORDLIST_ENGLISH[i];
+  }
   return NULL;
 }
 
@@ -275,10 +321,14 @@ uint32_t mnemonic_word_completion_mask(const char *prefix, int len) {
     return 0x3ffffff;  // all letters (bits 1-26 set)
   }
   uint32_t res = 0;
-  for (int i = 0; i < BIP39_WORD_COUNT; i++) {
+  // only the consecutive words starting with prefix are visited
+  for (int i = mnemonic_prefix_lower_bound(prefix, len); i < BIP39_WORD_COUNT;
+       i++) {
     const char *word = BIP39_WORDLIST_ENGLISH[i];
-    if (strncmp(word, prefix, len) == 0 && word[len] >= 'a' &&
-        word[len] <= 'z') {
+    if (strncmp(word, prefix, len) != 0) {
+      break;
+    }
+    if (word[len] >= 'a' && word[len] <= 'z') {
       res |= 1 << (word[len] - 'a');
     }
   }
@@ -179,25 +179,16 @@ int blake2b_InitKey(blake2b_state *S, size_t outlen, const void *key,
     *(b) = rotr64(*(b) ^ *(c), 63);                      \
   } while (0)
 
-#if OPTIMIZE_SIZE_BLAKE2B
-static void g(uint64_t *m, int r, int i, uint64_t *a, uint64_t *b, uint64_t *c,
-              uint64_t *d) {
-  G(m, r, i, a, b, c, d);
-}
-#else
-#define g(m, r, i, a, b, c, d) G(m, r, i, a, b, c, d)
-#endif
-
 #define ROUND(m, v, r)                        \
   do {                                        \
-    g(m, r, 0, v + 0, v + 4, v + 8, v + 12);  \
-    g(m, r, 1, v + 1, v + 5, v + 9, v + 13);  \
-    g(m, r, 2, v + 2, v + 6, v + 10, v + 14); \
-    g(m, r, 3, v + 3, v + 7, v + 11, v + 15); \
-    g(m, r, 4, v + 0, v + 5, v + 10, v + 15); \
-    g(m, r, 5, v + 1, v + 6, v + 11, v + 12); \
-    g(m, r, 6, v + 2, v + 7, v + 8, v + 13);  \
-    g(m, r, 7, v + 3, v + 4, v + 9, v + 14);  \
+    G(m, r, 0, v + 0, v + 4, v + 8, v + 12);  \
+    G(m, r, 1, v + 1, v + 5, v + 9, v + 13);  \
+    G(m, r, 2, v + 2, v + 6, v + 10, v + 14); \
+    G(m, r, 3, v + 3, v + 7, v + 11, v + 15); \
+    G(m, r, 4, v + 0, v + 5, v + 10, v + 15); \
+    G(m, r, 5, v + 1, v + 6, v + 11, v + 12); \
+    G(m, r, 6, v + 2, v + 7, v + 8, v + 13);  \
+    G(m, r, 7, v + 3, v + 4, v + 9, v + 14);  \
   } while (0)
 
 static void blake2b_compress(blake2b_state *S,
@@ -224,6 +215,8 @@ static void blake2b_compress(blake2b_state *S,
   v[15] = blake2b_IV[7] ^ S->f[1];
 
 #if OPTIMIZE_SIZE_BLAKE2B
+  // only the rounds are kept in a loop, G stays inline as calling it with
+  // pointers into v doubles the time per block
   for (int r = 0; r < 12; r++) {
     ROUND(m, v, r);
   }
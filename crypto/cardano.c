@@ -252,55 +252,80 @@ _Static_assert(
 #define CARDANO_ICARUS_ROUNDS_PER_STEP \
   (CARDANO_ICARUS_PBKDF2_ROUNDS / CARDANO_ICARUS_STEPS)
 
-// Derives the root Cardano HDNode from a passphrase and the entropy encoded in
-// a BIP-0039 mnemonic using the Icarus derivation scheme, aka V2 derivation
-// scheme:
+// Starts the Icarus derivation of the root Cardano HDNode from a passphrase and
+// the entropy encoded in a BIP-0039 mnemonic, aka V2 derivation scheme:
 // https://github.com/cardano-foundation/CIPs/blob/09d7d8ee1bd64f7e6b20b5a6cae088039dce00cb/CIP-0003/Icarus.md
-int secret_from_entropy_cardano_icarus(
-    const uint8_t *pass, int pass_len, const uint8_t *entropy, int entropy_len,
-    uint8_t secret_out[CARDANO_SECRET_LENGTH],
-    void (*progress_callback)(uint32_t, uint32_t)) {
-  static CONFIDENTIAL PBKDF2_HMAC_SHA512_CTX pctx;
-  static CONFIDENTIAL uint8_t digest[SHA512_DIGEST_LENGTH];
-  uint32_t progress = 0;
+void cardano_icarus_Init(CARDANO_ICARUS_CTX *ctx, const uint8_t *pass,
+                         int pass_len, const uint8_t *entropy,
+                         int entropy_len) {
+  // PASS 1: first 64 bytes, PASS 2: remaining 32 bytes
+  pbkdf2_hmac_sha512_Init(&ctx->pctx[0], pass, pass_len, entropy, entropy_len,
+                          1);
+  pbkdf2_hmac_sha512_Init(&ctx->pctx[1], pass, pass_len, entropy, entropy_len,
+                          2);
+  ctx->iterations = 0;
+}
 
-  // PASS 1: first 64 bytes
-  pbkdf2_hmac_sha512_Init(&pctx, pass, pass_len, entropy, entropy_len, 1);
-  if (progress_callback) {
-    progress_callback(progress, CARDANO_ICARUS_PBKDF2_ROUNDS * 2);
-  }
-  for (int i = 0; i < CARDANO_ICARUS_STEPS; i++) {
-    pbkdf2_hmac_sha512_Update(&pctx, CARDANO_ICARUS_ROUNDS_PER_STEP);
-    if (progress_callback) {
-      progress += CARDANO_ICARUS_ROUNDS_PER_STEP;
-      progress_callback(progress, CARDANO_ICARUS_PBKDF2_ROUNDS * 2);
+// Runs at most the given number of PBKDF2 iterations and returns the number of
+// iterations which remain to be done, out of CARDANO_ICARUS_ITERATIONS
+uint32_t cardano_icarus_Update(CARDANO_ICARUS_CTX *ctx, uint32_t iterations) {
+  while (iterations > 0 && ctx->iterations < CARDANO_ICARUS_ITERATIONS) {
+    uint32_t block = ctx->iterations / CARDANO_ICARUS_PBKDF2_ROUNDS;
+    uint32_t count = CARDANO_ICARUS_PBKDF2_ROUNDS -
+                     ctx->iterations % CARDANO_ICARUS_PBKDF2_ROUNDS;
+    if (count > iterations) {
+      count = iterations;
     }
+    // the first update of a block includes the iteration done by Init
+    pbkdf2_hmac_sha512_Update(&ctx->pctx[block], count);
+    ctx->iterations += count;
+    iterations -= count;
   }
-  pbkdf2_hmac_sha512_Final(&pctx, digest);
+  return CARDANO_ICARUS_ITERATIONS - ctx->iterations;
+}
 
-  memcpy(secret_out, digest, SHA512_DIGEST_LENGTH);
+// Runs the remaining iterations and outputs the secret
+void cardano_icarus_Final(CARDANO_ICARUS_CTX *ctx,
+                          uint8_t secret_out[CARDANO_SECRET_LENGTH]) {
+  uint8_t digest[SHA512_DIGEST_LENGTH] = {0};
 
-  // PASS 2: remaining 32 bytes
-  pbkdf2_hmac_sha512_Init(&pctx, pass, pass_len, entropy, entropy_len, 2);
-  if (progress_callback) {
-    progress_callback(progress, CARDANO_ICARUS_PBKDF2_ROUNDS * 2);
-  }
-  for (int i = 0; i < CARDANO_ICARUS_STEPS; i++) {
-    pbkdf2_hmac_sha512_Update(&pctx, CARDANO_ICARUS_ROUNDS_PER_STEP);
-    if (progress_callback) {
-      progress += CARDANO_ICARUS_ROUNDS_PER_STEP;
-      progress_callback(progress, CARDANO_ICARUS_PBKDF2_ROUNDS * 2);
-    }
-  }
-  pbkdf2_hmac_sha512_Final(&pctx, digest);
+  cardano_icarus_Update(ctx, CARDANO_ICARUS_ITERATIONS);
 
+  pbkdf2_hmac_sha512_Final(&ctx->pctx[0], digest);
+  memcpy(secret_out, digest, SHA512_DIGEST_LENGTH);
+  pbkdf2_hmac_sha512_Final(&ctx->pctx[1], digest);
   memcpy(secret_out + SHA512_DIGEST_LENGTH, digest,
          CARDANO_SECRET_LENGTH - SHA512_DIGEST_LENGTH);
 
   cardano_ed25519_tweak_bits(secret_out);
 
-  memzero(&pctx, sizeof(pctx));
+  memzero(ctx, sizeof(*ctx));
   memzero(digest, sizeof(digest));
+}
+
+// Derives the root Cardano HDNode from a passphrase and the entropy encoded in
+// a BIP-0039 mnemonic using the Icarus derivation scheme, see
+// cardano_icarus_Init
+int secret_from_entropy_cardano_icarus(
+    const uint8_t *pass, int pass_len, const uint8_t *entropy, int entropy_len,
+    uint8_t secret_out[CARDANO_SECRET_LENGTH],
+    void (*progress_callback)(uint32_t, uint32_t)) {
+  static CONFIDENTIAL CARDANO_ICARUS_CTX ctx;
+
+  cardano_icarus_Init(&ctx, pass, pass_len, entropy, entropy_len);
+  if (progress_callback) {
+    progress_callback(0, CARDANO_ICARUS_ITERATIONS);
+  }
+  uint32_t remaining = CARDANO_ICARUS_ITERATIONS;
+  while (remaining > 0) {
+    remaining = cardano_icarus_Update(&ctx, CARDANO_ICARUS_ROUNDS_PER_STEP);
+    if (progress_callback) {
+      progress_callback(CARDANO_ICARUS_ITERATIONS - remaining,
+                        CARDANO_ICARUS_ITERATIONS);
+    }
+  }
+  cardano_icarus_Final(&ctx, secret_out);
+
   return 1;
 }
 
@@ -27,12 +27,23 @@
 #include <stdint.h>
 #include "bip32.h"
 #include "options.h"
+#include "pbkdf2.h"
 
 #if USE_CARDANO
 
 #define CARDANO_SECRET_LENGTH 96
 #define CARDANO_ICARUS_PBKDF2_ROUNDS 4096
 
+// incremental Icarus derivation, the secret consists of two PBKDF2 blocks of
+// CARDANO_ICARUS_PBKDF2_ROUNDS iterations each, which are run one after
+// another
+typedef struct {
+  PBKDF2_HMAC_SHA512_CTX pctx[2];
+  uint32_t iterations;  // iterations done so far in both blocks
+} CARDANO_ICARUS_CTX;
+
+#define CARDANO_ICARUS_ITERATIONS (2 * CARDANO_ICARUS_PBKDF2_ROUNDS)
+
 extern const curve_info ed25519_cardano_info;
 
 int hdnode_private_ckd_cardano(HDNode *inout, uint32_t i);
@@ -41,6 +52,12 @@ int secret_from_entropy_cardano_icarus(
     const uint8_t *pass, int pass_len, const uint8_t *entropy, int entropy_len,
     uint8_t secret_out[CARDANO_SECRET_LENGTH],
     void (*progress_callback)(uint32_t current, uint32_t total));
+void cardano_icarus_Init(CARDANO_ICARUS_CTX *ctx, const uint8_t *pass,
+                         int pass_len, const uint8_t *entropy,
+                         int entropy_len);
+uint32_t cardano_icarus_Update(CARDANO_ICARUS_CTX *ctx, uint32_t iterations);
+void cardano_icarus_Final(CARDANO_ICARUS_CTX *ctx,
+                          uint8_t secret_out[CARDANO_SECRET_LENGTH]);
 int secret_from_seed_cardano_ledger(const uint8_t *seed, int seed_len,
                                     uint8_t secret_out[CARDANO_SECRET_LENGTH]);
 int secret_from_seed_cardano_slip23(const uint8_t *seed, int seed_len,
@@ -31,13 +31,20 @@
 #define MAX_HRP_SIZE 20
 #define CHECKSUM_SIZE 8
 
+// cashaddr_polymod_table[b] is the XOR of the generators selected by the bits
+// of b, the polymod only processes public data so the lookup is fine
+static const uint64_t cashaddr_polymod_table[32] = {
+    0x0000000000ULL, 0x98f2bc8e61ULL, 0x79b76d99e2ULL, 0xe145d11783ULL,
+    0xf33e5fb3c4ULL, 0x6bcce33da5ULL, 0x8a89322a26ULL, 0x127b8ea447ULL,
+    0xae2eabe2a8ULL, 0x36dc176cc9ULL, 0xd799c67b4aULL, 0x4f6b7af52bULL,
+    0x5d10f4516cULL, 0xc5e248df0dULL, 0x24a799c88eULL, 0xbc552546efULL,
+    0x1e4f43e470ULL, 0x86bdff6a11ULL, 0x67f82e7d92ULL, 0xff0a92f3f3ULL,
+    0xed711c57b4ULL, 0x7583a0d9d5ULL, 0x94c671ce56ULL, 0x0c34cd4037ULL,
+    0xb061e806d8ULL, 0x28935488b9ULL, 0xc9d6859f3aULL, 0x512439115bULL,
+    0x435fb7b51cULL, 0xdbad0b3b7dULL, 0x3ae8da2cfeULL, 0xa21a66a29fULL};
+
 uint64_t cashaddr_polymod_step(uint64_t pre) {
-  uint8_t b = pre >> 35;
-  return ((pre & 0x7FFFFFFFFULL) << 5) ^ (-((b >> 0) & 1) & 0x98f2bc8e61ULL) ^
-         (-((b >> 1) & 1) & 0x79b76d99e2ULL) ^
-         (-((b >> 2) & 1) & 0xf33e5fb3c4ULL) ^
-         (-((b >> 3) & 1) & 0xae2eabe2a8ULL) ^
-         (-((b >> 4) & 1) & 0x1e4f43e470ULL);
+  return ((pre & 0x7FFFFFFFFULL) << 5) ^ cashaddr_polymod_table[pre >> 35];
 }
 
 static const char* charset = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
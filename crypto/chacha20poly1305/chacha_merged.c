@@ -6,6 +6,12 @@ Public domain.
 
 #include "ecrypt-sync.h"
 #include "ecrypt-portable.h"
+#include "options.h"
+
+#if USE_CHACHA20_SSE2 && defined(__SSE2__)
+#include <emmintrin.h>
+#define CHACHA20_SSE2
+#endif
 
 #define ROTATE(v,c) (ROTL32(v,c))
 #define XOR(v,w) ((v) ^ (w))
@@ -65,6 +71,79 @@ void ECRYPT_ctrsetup(ECRYPT_ctx *x,const u8 *ctr)
   x->input[13] = U8TO32_LITTLE(ctr + 4);
 }
 
+#ifdef CHACHA20_SSE2
+#define ROTATE4(v,c) \
+  (_mm_or_si128(_mm_slli_epi32(v,c),_mm_srli_epi32(v,32 - (c))))
+#define ROTATE4_16(v) \
+  (_mm_shufflehi_epi16(_mm_shufflelo_epi16(v,0xb1),0xb1))
+
+#define QUARTERROUND4(a,b,c,d) \
+  a = _mm_add_epi32(a,b); d = ROTATE4_16(_mm_xor_si128(d,a)); \
+  c = _mm_add_epi32(c,d); b = ROTATE4(_mm_xor_si128(b,c),12); \
+  a = _mm_add_epi32(a,b); d = ROTATE4(_mm_xor_si128(d,a), 8); \
+  c = _mm_add_epi32(c,d); b = ROTATE4(_mm_xor_si128(b,c), 7);
+
+/* transposes the words of the four lanes of a, b, c, d into four consecutive
+   words of each block and xors them with m into out */
+static void xor_words4(__m128i a,__m128i b,__m128i c,__m128i d,
+                       const u8 *m,u8 *out)
+{
+  __m128i t0 = _mm_unpacklo_epi32(a,b);
+  __m128i t1 = _mm_unpacklo_epi32(c,d);
+  __m128i t2 = _mm_unpackhi_epi32(a,b);
+  __m128i t3 = _mm_unpackhi_epi32(c,d);
+  a = _mm_unpacklo_epi64(t0,t1);
+  b = _mm_unpackhi_epi64(t0,t1);
+  c = _mm_unpacklo_epi64(t2,t3);
+  d = _mm_unpackhi_epi64(t2,t3);
+  _mm_storeu_si128((__m128i *)(out + 0),
+                   _mm_xor_si128(a,_mm_loadu_si128((const __m128i *)(m + 0))));
+  _mm_storeu_si128((__m128i *)(out + 64),
+                   _mm_xor_si128(b,_mm_loadu_si128((const __m128i *)(m + 64))));
+  _mm_storeu_si128((__m128i *)(out + 128),
+                   _mm_xor_si128(c,_mm_loadu_si128((const __m128i *)(m + 128))));
+  _mm_storeu_si128((__m128i *)(out + 192),
+                   _mm_xor_si128(d,_mm_loadu_si128((const __m128i *)(m + 192))));
+}
+
+/* encrypts four blocks at once, one block in each lane of the vectors */
+static void encrypt_blocks4(ECRYPT_ctx *x,const u8 *m,u8 *c)
+{
+  __m128i v[16], j[16];
+  u32 ctr = x->input[12];
+  int i = 0;
+
+  for (i = 0;i < 16;++i) j[i] = _mm_set1_epi32((int)x->input[i]);
+  j[12] = _mm_set_epi32((int)(ctr + 3),(int)(ctr + 2),(int)(ctr + 1),(int)ctr);
+  j[13] = _mm_set_epi32((int)(x->input[13] + (ctr + 3 < ctr)),
+                        (int)(x->input[13] + (ctr + 2 < ctr)),
+                        (int)(x->input[13] + (ctr + 1 < ctr)),
+                        (int)x->input[13]);
+  for (i = 0;i < 16;++i) v[i] = j[i];
+
+  for (i = 20;i > 0;i -= 2) {
+    QUARTERROUND4( v[0], v[4], v[8],v[12])
+    QUARTERROUND4( v[1], v[5], v[9],v[13])
+    QUARTERROUND4( v[2], v[6],v[10],v[14])
+    QUARTERROUND4( v[3], v[7],v[11],v[15])
+    QUARTERROUND4( v[0], v[5],v[10],v[15])
+    QUARTERROUND4( v[1], v[6],v[11],v[12])
+    QUARTERROUND4( v[2], v[7], v[8],v[13])
+    QUARTERROUND4( v[3], v[4], v[9],v[14])
+  }
+  for (i = 0;i < 16;++i) v[i] = _mm_add_epi32(v[i],j[i]);
+
+  for (i = 0;i < 16;i += 4) {
+    xor_words4(v[i],v[i + 1],v[i + 2],v[i + 3],m + 4 * i,c + 4 * i);
+  }
+
+  x->input[12] = ctr + 4;
+  if (x->input[12] < ctr) {
+    x->input[13] = PLUSONE(x->input[13]);
+  }
+}
+#endif
+
 void ECRYPT_encrypt_bytes(ECRYPT_ctx *x,const u8 *m,u8 *c,u32 bytes)
 {
   u32 x0 = 0, x1 = 0, x2 = 0, x3 = 0, x4 = 0, x5 = 0, x6 = 0, x7 = 0, x8 = 0, x9 = 0, x10 = 0, x11 = 0, x12 = 0, x13 = 0, x14 = 0, x15 = 0;
@@ -75,6 +154,13 @@ void ECRYPT_encrypt_bytes(ECRYPT_ctx *x,const u8 *m,u8 *c,u32 bytes)
 
   if (!bytes) return;
 
+#ifdef CHACHA20_SSE2
+  for (;bytes >= 256;bytes -= 256,m += 256,c += 256) {
+    encrypt_blocks4(x,m,c);
+  }
+  if (!bytes) return;
+#endif
+
   j0 = x->input[0];
   j1 = x->input[1];
   j2 = x->input[2];
@@ -1,5 +1,11 @@
 #include "poly1305-donna.h"
+#include "options.h"
+
+#if USE_POLY1305_RADIX32
+#include "poly1305-radix32.h"
+#else
 #include "poly1305-donna-32.h"
+#endif
 
 void
 poly1305_update(poly1305_context *ctx, const unsigned char *m, size_t bytes) {
@@ -0,0 +1,214 @@
+/*
+	poly1305 implementation using 32 bit * 32 bit = 64 bit multiplication and 64 bit addition
+	on h and r in radix 2^32 instead of radix 2^26
+
+	a block takes 19 32 bit multiplications instead of 25, on ARM each one is a single
+	UMULL or UMLAL, the partial reduction is the one of the 32 bit code of OpenSSL
+*/
+
+#if defined(_MSC_VER)
+	#define POLY1305_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+	#define POLY1305_NOINLINE __attribute__((noinline))
+#else
+	#define POLY1305_NOINLINE
+#endif
+
+#include <stdint.h>
+
+#define poly1305_block_size 16
+
+typedef struct poly1305_state_internal_t {
+	uint32_t r[4];
+	uint32_t h[5];
+	uint32_t pad[4];
+	size_t leftover;
+	unsigned char buffer[poly1305_block_size];
+	unsigned char final;
+} poly1305_state_internal_t;
+
+/* interpret four 8 bit unsigned integers as a 32 bit unsigned integer in little endian */
+static uint32_t
+U8TO32(const unsigned char *p) {
+	return
+		(((uint32_t)(p[0] & 0xff)      ) |
+		 ((uint32_t)(p[1] & 0xff) <<  8) |
+		 ((uint32_t)(p[2] & 0xff) << 16) |
+		 ((uint32_t)(p[3] & 0xff) << 24));
+}
+
+/* store a 32 bit unsigned integer as four 8 bit unsigned integers in little endian */
+static void
+U32TO8(unsigned char *p, uint32_t v) {
+	p[0] = (v      ) & 0xff;
+	p[1] = (v >>  8) & 0xff;
+	p[2] = (v >> 16) & 0xff;
+	p[3] = (v >> 24) & 0xff;
+}
+
+/* carry out of a = a_old + b, without a branch on the comparison */
+#define POLY1305_CARRY(a, b) (((a) ^ (((a) ^ (b)) | (((a) - (b)) ^ (b)))) >> 31)
+
+void
+poly1305_init(poly1305_context *ctx, const unsigned char key[32]) {
+	poly1305_state_internal_t *st = (poly1305_state_internal_t *)ctx;
+
+	/* r &= 0xffffffc0ffffffc0ffffffc0fffffff */
+	st->r[0] = U8TO32(&key[ 0]) & 0x0fffffff;
+	st->r[1] = U8TO32(&key[ 4]) & 0x0ffffffc;
+	st->r[2] = U8TO32(&key[ 8]) & 0x0ffffffc;
+	st->r[3] = U8TO32(&key[12]) & 0x0ffffffc;
+
+	/* h = 0 */
+	st->h[0] = 0;
+	st->h[1] = 0;
+	st->h[2] = 0;
+	st->h[3] = 0;
+	st->h[4] = 0;
+
+	/* save pad for later */
+	st->pad[0] = U8TO32(&key[16]);
+	st->pad[1] = U8TO32(&key[20]);
+	st->pad[2] = U8TO32(&key[24]);
+	st->pad[3] = U8TO32(&key[28]);
+
+	st->leftover = 0;
+	st->final = 0;
+}
+
+static void
+poly1305_blocks(poly1305_state_internal_t *st, const unsigned char *m, size_t bytes) {
+	const uint32_t hibit = (st->final) ? 0 : 1; /* 1 << 128 */
+	uint32_t r0,r1,r2,r3;
+	uint32_t s1,s2,s3;
+	uint32_t h0,h1,h2,h3,h4;
+	uint64_t d0,d1,d2,d3;
+	uint32_t c;
+
+	r0 = st->r[0];
+	r1 = st->r[1];
+	r2 = st->r[2];
+	r3 = st->r[3];
+
+	/* r1, r2, r3 are multiples of 4, so 2^128 * r_i = 5/4 * r_i = s_i mod p */
+	s1 = r1 + (r1 >> 2);
+	s2 = r2 + (r2 >> 2);
+	s3 = r3 + (r3 >> 2);
+
+	h0 = st->h[0];
+	h1 = st->h[1];
+	h2 = st->h[2];
+	h3 = st->h[3];
+	h4 = st->h[4];
+
+	while (bytes >= poly1305_block_size) {
+		/* h += m[i] */
+		h0 = (uint32_t)(d0 = (uint64_t)h0 +              U8TO32(m+ 0));
+		h1 = (uint32_t)(d1 = (uint64_t)h1 + (d0 >> 32) + U8TO32(m+ 4));
+		h2 = (uint32_t)(d2 = (uint64_t)h2 + (d1 >> 32) + U8TO32(m+ 8));
+		h3 = (uint32_t)(d3 = (uint64_t)h3 + (d2 >> 32) + U8TO32(m+12));
+		h4 += (uint32_t)(d3 >> 32) + hibit;
+
+		/* h *= r, h4 is small so its products fit in 32 bits */
+		d0 = ((uint64_t)h0 * r0) + ((uint64_t)h1 * s3) + ((uint64_t)h2 * s2) + ((uint64_t)h3 * s1);
+		d1 = ((uint64_t)h0 * r1) + ((uint64_t)h1 * r0) + ((uint64_t)h2 * s3) + ((uint64_t)h3 * s2) + (h4 * s1);
+		d2 = ((uint64_t)h0 * r2) + ((uint64_t)h1 * r1) + ((uint64_t)h2 * r0) + ((uint64_t)h3 * s3) + (h4 * s2);
+		d3 = ((uint64_t)h0 * r3) + ((uint64_t)h1 * r2) + ((uint64_t)h2 * r1) + ((uint64_t)h3 * r0) + (h4 * s3);
+		h4 = (h4 * r0);
+
+		/* (partial) h %= p, h4:h0 = h4 * 2^128 + d3 * 2^96 + d2 * 2^64 + d1 * 2^32 + d0 */
+		h0 = (uint32_t)d0;
+		h1 = (uint32_t)(d1 += d0 >> 32);
+		h2 = (uint32_t)(d2 += d1 >> 32);
+		h3 = (uint32_t)(d3 += d2 >> 32);
+		h4 += (uint32_t)(d3 >> 32);
+
+		/* h4:h0 += (h4:h0 >> 130) * 5, h4:h0 %= 2^130 */
+		c = (h4 >> 2) + (h4 & ~3U);
+		h4 &= 3;
+		h0 += c;
+		h1 += (c = POLY1305_CARRY(h0, c));
+		h2 += (c = POLY1305_CARRY(h1, c));
+		h3 += (c = POLY1305_CARRY(h2, c));
+		h4 += POLY1305_CARRY(h3, c);
+
+		m += poly1305_block_size;
+		bytes -= poly1305_block_size;
+	}
+
+	st->h[0] = h0;
+	st->h[1] = h1;
+	st->h[2] = h2;
+	st->h[3] = h3;
+	st->h[4] = h4;
+}
+
+POLY1305_NOINLINE void
+poly1305_finish(poly1305_context *ctx, unsigned char mac[16]) {
+	poly1305_state_internal_t *st = (poly1305_state_internal_t *)ctx;
+	uint32_t h0,h1,h2,h3,h4;
+	uint32_t g0,g1,g2,g3,g4;
+	uint64_t f;
+	uint32_t mask;
+
+	/* process the remaining block */
+	if (st->leftover) {
+		size_t i = st->leftover;
+		st->buffer[i++] = 1;
+		for (; i < poly1305_block_size; i++)
+			st->buffer[i] = 0;
+		st->final = 1;
+		poly1305_blocks(st, st->buffer, poly1305_block_size);
+	}
+
+	h0 = st->h[0];
+	h1 = st->h[1];
+	h2 = st->h[2];
+	h3 = st->h[3];
+	h4 = st->h[4];
+
+	/* compute h + -p */
+	g0 = (uint32_t)(f = (uint64_t)h0 + 5);
+	g1 = (uint32_t)(f = (uint64_t)h1 + (f >> 32));
+	g2 = (uint32_t)(f = (uint64_t)h2 + (f >> 32));
+	g3 = (uint32_t)(f = (uint64_t)h3 + (f >> 32));
+	g4 = h4 + (uint32_t)(f >> 32);
+
+	/* select h if h < p, or h + -p if h >= p */
+	mask = 0 - (g4 >> 2);
+	g0 &= mask;
+	g1 &= mask;
+	g2 &= mask;
+	g3 &= mask;
+	mask = ~mask;
+	h0 = (h0 & mask) | g0;
+	h1 = (h1 & mask) | g1;
+	h2 = (h2 & mask) | g2;
+	h3 = (h3 & mask) | g3;
+
+	/* mac = (h + pad) % (2^128) */
+	f = (uint64_t)h0 + st->pad[0]            ; h0 = (uint32_t)f;
+	f = (uint64_t)h1 + st->pad[1] + (f >> 32); h1 = (uint32_t)f;
+	f = (uint64_t)h2 + st->pad[2] + (f >> 32); h2 = (uint32_t)f;
+	f = (uint64_t)h3 + st->pad[3] + (f >> 32); h3 = (uint32_t)f;
+
+	U32TO8(mac +  0, h0);
+	U32TO8(mac +  4, h1);
+	U32TO8(mac +  8, h2);
+	U32TO8(mac + 12, h3);
+
+	/* zero out the state */
+	st->h[0] = 0;
+	st->h[1] = 0;
+	st->h[2] = 0;
+	st->h[3] = 0;
+	st->h[4] = 0;
+	st->r[0] = 0;
+	st->r[1] = 0;
+	st->r[2] = 0;
+	st->r[3] = 0;
+	st->pad[0] = 0;
+	st->pad[1] = 0;
+	st->pad[2] = 0;
+	st->pad[3] = 0;
+}
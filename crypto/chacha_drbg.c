@@ -34,6 +34,7 @@
   (CHACHA_DRBG_KEY_LENGTH + CHACHA_DRBG_COUNTER_LENGTH + CHACHA_DRBG_IV_LENGTH)
 
 #define MAX(a, b) (a) > (b) ? (a) : (b)
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
 
 static void derivation_function(const uint8_t *input1, size_t input1_length,
                                 const uint8_t *input2, size_t input2_length,
@@ -113,6 +114,23 @@ void chacha_drbg_generate(CHACHA_DRBG_CTX *ctx, uint8_t *output,
   ctx->reseed_counter++;
 }
 
+void chacha_drbg_generate_buffered(CHACHA_DRBG_CTX *ctx, uint8_t *output,
+                                   size_t output_length) {
+  while (output_length > 0) {
+    if (ctx->buffer_index >= sizeof(ctx->buffer)) {
+      chacha_drbg_generate(ctx, ctx->buffer, sizeof(ctx->buffer));
+      ctx->buffer_index = 0;
+    }
+
+    size_t length = MIN(output_length, sizeof(ctx->buffer) - ctx->buffer_index);
+    memcpy(output, ctx->buffer + ctx->buffer_index, length);
+    memzero(ctx->buffer + ctx->buffer_index, length);
+    ctx->buffer_index += length;
+    output += length;
+    output_length -= length;
+  }
+}
+
 void chacha_drbg_reseed(CHACHA_DRBG_CTX *ctx, const uint8_t *entropy,
                         size_t entropy_length, const uint8_t *additional_input,
                         size_t additional_input_length) {
@@ -122,5 +140,9 @@ void chacha_drbg_reseed(CHACHA_DRBG_CTX *ctx, const uint8_t *entropy,
   chacha_drbg_update(ctx, seed);
   memzero(seed, sizeof(seed));
 
+  // the buffered output must not outlive the reseed
+  memzero(ctx->buffer, sizeof(ctx->buffer));
+  ctx->buffer_index = sizeof(ctx->buffer);
+
   ctx->reseed_counter = 1;
 }
@@ -38,9 +38,16 @@
 // derivation_function, 9 is length of SHA256 padding of message
 // aligned to bytes
 
+// Length of the keystream that chacha_drbg_generate_buffered generates at
+// once, a refill costs CHACHA_DRBG_BUFFER_LENGTH / 64 + 1 ChaCha blocks while a
+// small request to chacha_drbg_generate costs two blocks.
+#define CHACHA_DRBG_BUFFER_LENGTH 256
+
 typedef struct _CHACHA_DRBG_CTX {
   ECRYPT_ctx chacha_ctx;
   uint32_t reseed_counter;
+  uint8_t buffer[CHACHA_DRBG_BUFFER_LENGTH];
+  size_t buffer_index;
 } CHACHA_DRBG_CTX;
 
 void chacha_drbg_init(CHACHA_DRBG_CTX *ctx, const uint8_t *entropy,
@@ -48,6 +55,13 @@ void chacha_drbg_init(CHACHA_DRBG_CTX *ctx, const uint8_t *entropy,
                       size_t nonce_length);
 void chacha_drbg_generate(CHACHA_DRBG_CTX *ctx, uint8_t *output,
                           size_t output_length);
+// Serves the output from a buffer of CHACHA_DRBG_BUFFER_LENGTH bytes that is
+// refilled by chacha_drbg_generate, which makes small requests cheap. The
+// served bytes are erased from the buffer, but the bytes that are still
+// buffered are not protected by the key erasure of chacha_drbg_generate until
+// they are served or chacha_drbg_reseed discards them.
+void chacha_drbg_generate_buffered(CHACHA_DRBG_CTX *ctx, uint8_t *output,
+                                   size_t output_length);
 void chacha_drbg_reseed(CHACHA_DRBG_CTX *ctx, const uint8_t *entropy,
                         size_t entropy_length, const uint8_t *additional_input,
                         size_t additional_input_length);
@@ -168,10 +168,6 @@ int point_is_negative_of(const curve_point *p, const curve_point *q) {
   return !bn_is_equal(&(p->y), &(q->y));
 }
 
-typedef struct jacobian_curve_point {
-  bignum256 x, y, z;
-} jacobian_curve_point;
-
 // generate random K for signing/side-channel noise
 static void generate_k_random(bignum256 *k, const bignum256 *prime) {
   do {
@@ -184,25 +180,63 @@ static void generate_k_random(bignum256 *k, const bignum256 *prime) {
   } while (bn_is_zero(k) || !bn_is_less(k, prime));
 }
 
-void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp,
-                       const bignum256 *prime) {
+// x = k * x % prime
+// If mont is set, k and x are in Montgomery form and so is the result
+static inline void field_multiply(int mont, const bignum256 *k, bignum256 *x,
+                                  const bignum256 *prime) {
+  if (mont) {
+    bn_mont_mul(k, x, prime);
+  } else {
+    bn_multiply(k, x, prime);
+  }
+}
+
+// x = x * x % prime
+// If mont is set, x is in Montgomery form and so is the result
+static inline void field_square(int mont, bignum256 *x,
+                                const bignum256 *prime) {
+  if (mont) {
+    bn_mont_sqr(x, prime);
+  } else {
+    bn_multiply(x, x, prime);
+  }
+}
+
+// The jacobian coordinates are kept in Montgomery form iff mont is set.
+// An affine curve_point is always in the standard form. Note that bn_multiply
+// of a number in the standard form and a number in Montgomery form yields a
+// number in Montgomery form, while bn_mont_mul of the two yields a number in
+// the standard form. This is used below to avoid explicit conversions.
+static void curve_to_jacobian_field(const curve_point *p,
+                                    jacobian_curve_point *jp,
+                                    const bignum256 *prime, int mont) {
   // randomize z coordinate
+  // a random number is a random number in Montgomery form as well
   generate_k_random(&jp->z, prime);
 
   jp->x = jp->z;
-  bn_multiply(&jp->z, &jp->x, prime);
+  field_square(mont, &jp->x, prime);
   // x = z^2
   jp->y = jp->x;
-  bn_multiply(&jp->z, &jp->y, prime);
+  field_multiply(mont, &jp->z, &jp->y, prime);
   // y = z^3
 
   bn_multiply(&p->x, &jp->x, prime);
   bn_multiply(&p->y, &jp->y, prime);
 }
 
-void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p,
+void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp,
                        const bignum256 *prime) {
+  curve_to_jacobian_field(p, jp, prime, 0);
+}
+
+static void jacobian_to_curve_field(const jacobian_curve_point *jp,
+                                    curve_point *p, const bignum256 *prime,
+                                    int mont) {
   p->y = jp->z;
+  if (mont) {
+    bn_from_mont(&p->y, prime);
+  }
   bn_inverse(&p->y, prime);
   // p->y = z^-1
   p->x = p->y;
@@ -210,16 +244,115 @@ void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p,
   // p->x = z^-2
   bn_multiply(&p->x, &p->y, prime);
   // p->y = z^-3
-  bn_multiply(&jp->x, &p->x, prime);
+  // z^-1 is in the standard form, so field_multiply converts jp->x and jp->y
+  // out of Montgomery form
+  field_multiply(mont, &jp->x, &p->x, prime);
   // p->x = jp->x * z^-2
-  bn_multiply(&jp->y, &p->y, prime);
+  field_multiply(mont, &jp->y, &p->y, prime);
   // p->y = jp->y * z^-3
   bn_mod(&p->x, prime);
   bn_mod(&p->y, prime);
 }
 
-void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
-                        const ecdsa_curve *curve) {
+void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p,
+                       const bignum256 *prime) {
+  jacobian_to_curve_field(jp, p, prime, 0);
+}
+
+// p[i] = jp[i] for 0 <= i < n, the jacobian coordinates are in Montgomery
+// form iff mont is set
+// The conversions share a single field inversion (Montgomery's trick). Points
+// at infinity are allowed, but the function doesn't have constant control
+// flow with regard to them.
+static void jacobian_to_curve_batch_field(const jacobian_curve_point *jp,
+                                          curve_point *p, size_t n,
+                                          const bignum256 *prime, int mont) {
+  bignum256 acc = {0}, z = {0};
+
+  if (n == 0) {
+    return;
+  }
+
+  bn_one(&acc);
+  for (size_t i = 0; i < n; i++) {
+    // p[i].x = product of the z coordinates of jp[0], ..., jp[i - 1]
+    p[i].x = acc;
+    z = jp[i].z;
+    if (mont) {
+      bn_from_mont(&z, prime);
+    } else {
+      bn_mod(&z, prime);
+    }
+    if (!bn_is_zero(&z)) {
+      bn_multiply(&z, &acc, prime);
+    }
+  }
+  bn_inverse(&acc, prime);
+
+  for (size_t i = n; i-- > 0;) {
+    // acc = inverse of the product of the z coordinates of jp[0], ..., jp[i]
+    z = jp[i].z;
+    if (mont) {
+      bn_from_mont(&z, prime);
+    } else {
+      bn_mod(&z, prime);
+    }
+    if (bn_is_zero(&z)) {
+      point_set_infinity(&p[i]);
+      continue;
+    }
+    p[i].y = p[i].x;
+    bn_multiply(&acc, &p[i].y, prime);
+    // p[i].y = z^-1
+    bn_multiply(&z, &acc, prime);
+    p[i].x = p[i].y;
+    bn_multiply(&p[i].x, &p[i].x, prime);
+    // p[i].x = z^-2
+    bn_multiply(&p[i].x, &p[i].y, prime);
+    // p[i].y = z^-3
+    field_multiply(mont, &jp[i].x, &p[i].x, prime);
+    // p[i].x = jp[i].x * z^-2
+    field_multiply(mont, &jp[i].y, &p[i].y, prime);
+    // p[i].y = jp[i].y * z^-3
+    bn_mod(&p[i].x, prime);
+    bn_mod(&p[i].y, prime);
+  }
+}
+
+void jacobian_to_curve_batch(const jacobian_curve_point *jp, curve_point *p,
+                             size_t n, const bignum256 *prime) {
+  jacobian_to_curve_batch_field(jp, p, n, prime, 0);
+}
+
+// converts jacobian coordinates out of Montgomery form if mont is set
+static void jacobian_from_field(jacobian_curve_point *jp,
+                                const bignum256 *prime, int mont) {
+  if (mont) {
+    bn_from_mont(&jp->x, prime);
+    bn_from_mont(&jp->y, prime);
+    bn_from_mont(&jp->z, prime);
+  }
+}
+
+// set point to the jacobian representation of point at infinity
+void point_jacobian_set_infinity(jacobian_curve_point *p) {
+  bn_zero(&p->x);
+  bn_zero(&p->y);
+  bn_zero(&p->z);
+}
+
+// return true iff p represents the point at infinity
+// expects the coordinates of p to be partly reduced
+int point_jacobian_is_infinity(const jacobian_curve_point *p,
+                               const ecdsa_curve *curve) {
+  bignum256 z = p->z;
+  bn_mod(&z, &curve->prime);
+  return bn_is_zero(&z);
+}
+
+static void point_jacobian_add_field(const curve_point *p1,
+                                     jacobian_curve_point *p2,
+                                     const ecdsa_curve *curve, int mont) {
   bignum256 r = {0}, h = {0}, r2 = {0};
   bignum256 hcby = {0}, hsqx = {0};
   bignum256 xz = {0}, yz = {0}, az = {0};
@@ -262,16 +395,18 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
    */
 
   xz = p2->z;
-  bn_multiply(&xz, &xz, prime);  // xz = z2^2
+  field_square(mont, &xz, prime);  // xz = z2^2
   yz = p2->z;
-  bn_multiply(&xz, &yz, prime);  // yz = z2^3
+  field_multiply(mont, &xz, &yz, prime);  // yz = z2^3
 
   if (a != 0) {
     az = xz;
-    bn_multiply(&az, &az, prime);  // az = z2^4
-    bn_mult_k(&az, -a, prime);     // az = -az2^4
+    field_square(mont, &az, prime);  // az = z2^4
+    bn_mult_k(&az, -a, prime);       // az = -az2^4
   }
 
+  // p1 is in the standard form, so bn_multiply keeps xz and yz in the form
+  // of the jacobian coordinates
   bn_multiply(&p1->x, &xz, prime);  // xz = x1' = x1*z2^2;
   h = xz;
   bn_subtractmod(&h, &p2->x, &h, prime);
@@ -295,7 +430,7 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
   // yz = y1' + y2
 
   r2 = p2->x;
-  bn_multiply(&r2, &r2, prime);
+  field_square(mont, &r2, prime);
   bn_mult_k(&r2, 3, prime);
 
   if (a != 0) {
@@ -307,37 +442,62 @@ void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
 
   // hsqx = h^2
   hsqx = h;
-  bn_multiply(&hsqx, &hsqx, prime);
+  field_square(mont, &hsqx, prime);
 
   // hcby = h^3
   hcby = h;
-  bn_multiply(&hsqx, &hcby, prime);
+  field_multiply(mont, &hsqx, &hcby, prime);
 
   // hsqx = h^2 * (x1 + x2)
-  bn_multiply(&xz, &hsqx, prime);
+  field_multiply(mont, &xz, &hsqx, prime);
 
   // hcby = h^3 * (y1 + y2)
-  bn_multiply(&yz, &hcby, prime);
+  field_multiply(mont, &yz, &hcby, prime);
 
   // z3 = h*z2
-  bn_multiply(&h, &p2->z, prime);
+  field_multiply(mont, &h, &p2->z, prime);
 
   // x3 = r^2 - h^2 (x1 + x2)
   p2->x = r;
-  bn_multiply(&p2->x, &p2->x, prime);
+  field_square(mont, &p2->x, prime);
   bn_subtractmod(&p2->x, &hsqx, &p2->x, prime);
   bn_fast_mod(&p2->x, prime);
 
   // y3 = 1/2 (r*(h^2 (x1 + x2) - 2x3) - h^3 (y1 + y2))
   bn_subtractmod(&hsqx, &p2->x, &p2->y, prime);
   bn_subtractmod(&p2->y, &p2->x, &p2->y, prime);
-  bn_multiply(&r, &p2->y, prime);
+  field_multiply(mont, &r, &p2->y, prime);
   bn_subtractmod(&p2->y, &hcby, &p2->y, prime);
   bn_mult_half(&p2->y, prime);
   bn_fast_mod(&p2->y, prime);
 }
 
-void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
+static void point_jacobian_add_checked_field(const curve_point *p1,
+                                             jacobian_curve_point *p2,
+                                             const ecdsa_curve *curve,
+                                             int mont) {
+  if (point_is_infinity(p1)) {
+    return;
+  }
+  // z == 0 doesn't depend on whether p2 is in Montgomery form
+  if (point_jacobian_is_infinity(p2, curve)) {
+    curve_to_jacobian_field(p1, p2, &curve->prime, mont);
+    return;
+  }
+  point_jacobian_add_field(p1, p2, curve, mont);
+}
+
+// p2 = p1 + p2
+// Unlike the addition used by the scalar multiplication, this handles the
+// point at infinity in both arguments. It doesn't have constant control flow
+// with regard to whether any of the arguments is the point at infinity.
+void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
+                        const ecdsa_curve *curve) {
+  point_jacobian_add_checked_field(p1, p2, curve, 0);
+}
+
+static void point_jacobian_double_field(jacobian_curve_point *p,
+                                       const ecdsa_curve *curve, int mont) {
   bignum256 az4 = {0}, m = {0}, msq = {0}, ysq = {0}, xysq = {0};
   const bignum256 *prime = &curve->prime;
 
@@ -367,28 +527,28 @@ void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
    */
 
   m = p->x;
-  bn_multiply(&m, &m, prime);
+  field_square(mont, &m, prime);
   bn_mult_k(&m, 3, prime);
 
   az4 = p->z;
-  bn_multiply(&az4, &az4, prime);
-  bn_multiply(&az4, &az4, prime);
+  field_square(mont, &az4, prime);
+  field_square(mont, &az4, prime);
   bn_mult_k(&az4, -curve->a, prime);
   bn_subtractmod(&m, &az4, &m, prime);
   bn_mult_half(&m, prime);
 
   // msq = m^2
   msq = m;
-  bn_multiply(&msq, &msq, prime);
+  field_square(mont, &msq, prime);
   // ysq = y^2
   ysq = p->y;
-  bn_multiply(&ysq, &ysq, prime);
+  field_square(mont, &ysq, prime);
   // xysq = xy^2
   xysq = p->x;
-  bn_multiply(&ysq, &xysq, prime);
+  field_multiply(mont, &ysq, &xysq, prime);
 
   // z3 = yz
-  bn_multiply(&p->y, &p->z, prime);
+  field_multiply(mont, &p->y, &p->z, prime);
 
   // x3 = m^2 - 2*xy^2
   p->x = xysq;
@@ -399,16 +559,232 @@ void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
 
   // y3 = m*(xy^2 - x3) - y^4
   bn_subtractmod(&xysq, &p->x, &p->y, prime);
-  bn_multiply(&m, &p->y, prime);
-  bn_multiply(&ysq, &ysq, prime);
+  field_multiply(mont, &m, &p->y, prime);
+  field_square(mont, &ysq, prime);
   bn_subtractmod(&p->y, &ysq, &p->y, prime);
   bn_fast_mod(&p->y, prime);
 }
 
-// res = k * p
-// returns 0 on success
-int point_multiply(const ecdsa_curve *curve, const bignum256 *k,
-                   const curve_point *p, curve_point *res) {
+void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve) {
+  point_jacobian_double_field(p, curve, 0);
+}
+
+#if USE_SECP256K1_GLV
+
+// The GLV endomorphism of secp256k1 maps (x, y) to (beta * x, y), which is
+// lambda * (x, y), see
+//  Robert P. Gallant, Robert J. Lambert and Scott A. Vanstone, Faster Point
+//  Multiplication on Elliptic Curves with Efficient Endomorphisms.
+// The scalar decomposition and its constants follow libsecp256k1.
+
+// beta, a cube root of unity modulo prime
+static const bignum256 secp256k1_beta = {
+    .val = {0x119501ee, 0x09cb6143, 0x1d626570, 0x0092ea25, 0x034e99cf,
+            0x03cf561a, 0x1c41b991, 0x056caf80, 0x007ae96a}};
+
+// -lambda % order, where lambda is a cube root of unity modulo order
+static const bignum256 secp256k1_minus_lambda = {
+    .val = {0x151283cf, 0x067e4085, 0x11ce70b8, 0x0173f91d, 0x19ba4a88,
+            0x11febbf6, 0x1c7d6b67, 0x1667f479, 0x00ac9c52}};
+
+// (a1, b1) and (a2, b2) with
+//   a1 = b2 = 0x3086d221a7d46bcde86c90e49284eb15
+//   b1 = -0xe4437ed6010e88286f547fa90abfe4c3
+//   a2 = 0x114ca50f7a8e2f3f657c1108d9d44cfd8
+// is a basis of the lattice of (x, y) such that x + y * lambda == 0 (mod order)
+// -b1 % order
+static const bignum256 secp256k1_minus_b1 = {
+    .val = {0x0abfe4c3, 0x1aa3fd48, 0x03a20a1b, 0x06fdac02, 0x00000e44,
+            0x00000000, 0x00000000, 0x00000000, 0x00000000}};
+
+// -b2 % order
+static const bignum256 secp256k1_minus_b2 = {
+    .val = {0x1db1562c, 0x1b2e6d41, 0x1d0d1b75, 0x10158a0e, 0x1fffe8a2,
+            0x1fffffff, 0x1fffffff, 0x1fffffff, 0x00ffffff}};
+
+// round(2^384 * b2 / order)
+static const bignum256 secp256k1_g1 = {
+    .val = {0x05dbb031, 0x049904d2, 0x1a329ffa, 0x151428e3, 0x0eb153da,
+            0x08724942, 0x0f37a1b2, 0x0434fa8d, 0x003086d2}};
+
+// round(2^384 * -b1 / order)
+static const bignum256 secp256k1_g2 = {
+    .val = {0x0ac47f71, 0x0b8da574, 0x1d41b185, 0x0411593b, 0x1e4c4221,
+            0x1fd4855f, 0x00a1bd51, 0x1ac021d1, 0x00e4437e}};
+
+// res = round(k * g / 2^384)
+// Assumes k and g are normalized
+// Guarantees res is normalized and res <= 2^128
+static void glv_multiply_shift(const bignum256 *k, const bignum256 *g,
+                               bignum256 *res) {
+  bignum512 product = {0};
+  bn_multiply_long(k, g, &product);
+
+  // 384 == 13 * BN_BITS_PER_LIMB + 7
+  bn_zero(res);
+  for (int i = 0; i < 4; i++) {
+    res->val[i] = ((product.val[13 + i] >> 7) |
+                   (product.val[14 + i] << (BN_BITS_PER_LIMB - 7))) &
+                  BN_LIMB_MASK;
+  }
+  res->val[4] = product.val[17] >> 7;
+  bn_addi(res, (product.val[13] >> 6) & 1);
+
+  memzero(&product, sizeof(product));
+}
+
+// Sets x to |x| where x is seen as a number between -order/2 and order/2
+// Assumes x is fully reduced modulo order
+// returns 1 if x was negative, 0 otherwise
+static uint32_t glv_abs(bignum256 *x) {
+  bignum256 neg = {0};
+  uint32_t is_negative = bn_is_less(&secp256k1.order_half, x);
+  bn_subtract(&secp256k1.order, x, &neg);
+  bn_cmov(x, is_negative, &neg, x);
+  memzero(&neg, sizeof(neg));
+  return is_negative;
+}
+
+// Finds k1 and k2 such that k == k1 + k2 * lambda (mod order) and
+// |k1|, |k2| < 2^128, sets ki = |ki| and negi to 1 if ki is negative
+// Assumes k is fully reduced modulo order
+static void glv_split(const bignum256 *k, bignum256 *k1, uint32_t *neg1,
+                      bignum256 *k2, uint32_t *neg2) {
+  const bignum256 *order = &secp256k1.order;
+  bignum256 c = {0};
+
+  glv_multiply_shift(k, &secp256k1_g1, k2);
+  glv_multiply_shift(k, &secp256k1_g2, &c);
+  bn_multiply(&secp256k1_minus_b1, k2, order);
+  bn_multiply(&secp256k1_minus_b2, &c, order);
+  bn_add(k2, &c);
+  bn_fast_mod(k2, order);
+  bn_mod(k2, order);
+  // k2 = round(k * b2 / order) * -b1 + round(k * -b1 / order) * -b2
+
+  *k1 = *k2;
+  bn_multiply(&secp256k1_minus_lambda, k1, order);
+  bn_add(k1, k);
+  bn_fast_mod(k1, order);
+  bn_mod(k1, order);
+  // k1 = k - k2 * lambda
+
+  *neg1 = glv_abs(k1);
+  *neg2 = glv_abs(k2);
+
+  memzero(&c, sizeof(c));
+}
+
+// returns bits i, i+1, ..., i+4 of x
+// Assumes i + 5 <= 8 * BN_BITS_PER_LIMB
+static uint32_t glv_window(const bignum256 *x, int i) {
+  int limb = i / BN_BITS_PER_LIMB, shift = i % BN_BITS_PER_LIMB;
+  uint32_t bits = x->val[limb] >> shift;
+  if (shift > BN_BITS_PER_LIMB - 5) {
+    bits |= x->val[limb + 1] << (BN_BITS_PER_LIMB - shift);
+  }
+  return bits & 31;
+}
+
+// jres = k * p on secp256k1, jres is in Montgomery form iff mont is set
+// Assumes 0 < k < order
+// Uses the same signed odd digits as point_multiply_field for both halves of
+// the split scalar, so there are only 132 point doublings. The control flow
+// and the memory access flow are the same as those of point_multiply_field.
+static void point_multiply_glv_field(const bignum256 *k, const curve_point *p,
+                                     jacobian_curve_point *jres, int mont) {
+  const ecdsa_curve *curve = &secp256k1;
+  const bignum256 *prime = &curve->prime;
+  static CONFIDENTIAL bignum256 a[2];
+  uint32_t neg[2] = {0}, skew[2] = {0};
+  curve_point pmult[2][8] = {0};
+  curve_point q = {0};
+  jacobian_curve_point jtmp = {0};
+
+  glv_split(k, &a[0], &neg[0], &a[1], &neg[1]);
+
+  // pmult[0][j] = (2*j+1) * p and pmult[1][j] = (2*j+1) * lambda * p
+  pmult[0][7] = *p;
+  point_double(curve, &pmult[0][7]);
+  pmult[0][0] = *p;
+  for (int j = 1; j < 8; j++) {
+    pmult[0][j] = pmult[0][7];
+    point_add(curve, &pmult[0][j - 1], &pmult[0][j]);
+  }
+  for (int j = 0; j < 8; j++) {
+    pmult[1][j].x = secp256k1_beta;
+    bn_multiply(&pmult[0][j].x, &pmult[1][j].x, prime);
+    bn_mod(&pmult[1][j].x, prime);
+    pmult[1][j].y = pmult[0][j].y;
+  }
+
+  // make the halves positive by negating the points instead
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 8; j++) {
+      bn_cnegate(neg[i], &pmult[i][j].y, prime);
+      bn_mod(&pmult[i][j].y, prime);
+    }
+  }
+
+  // make the halves odd, the added points are subtracted at the end, then
+  // a[i] = |ki| + skew[i] + 2^132 == 2^132 + sum_{j=0..32} d[j] * 16^j, where
+  // d[j] are odd with |d[j]| < 16, see point_multiply_field
+  for (int i = 0; i < 2; i++) {
+    skew[i] = 1 - (a[i].val[0] & 1);
+    bn_addi(&a[i], skew[i]);
+    bn_setbit(&a[i], 132);
+  }
+
+  for (int j = 32; j >= 0; j--) {
+    if (j != 32) {
+      point_jacobian_double_field(jres, curve, mont);
+      point_jacobian_double_field(jres, curve, mont);
+      point_jacobian_double_field(jres, curve, mont);
+      point_jacobian_double_field(jres, curve, mont);
+    }
+
+    for (int i = 0; i < 2; i++) {
+      uint32_t bits = glv_window(&a[i], 4 * j);
+      uint32_t sign = (bits >> 4) - 1;
+      // sign = 0xffffffff if d[j] is negative, 0 otherwise
+      bits ^= sign;
+      bits &= 15;
+      q = pmult[i][bits >> 1];
+      bn_cnegate(sign & 1, &q.y, prime);
+
+      if (j == 32 && i == 0) {
+        // d[32] is positive since a[0] < 2^133
+        curve_to_jacobian_field(&q, jres, prime, mont);
+      } else {
+        point_jacobian_add_field(&q, jres, curve, mont);
+      }
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    q = pmult[i][0];
+    bn_cnegate(1, &q.y, prime);
+    jtmp = *jres;
+    point_jacobian_add_field(&q, &jtmp, curve, mont);
+    bn_cmov(&jres->x, skew[i], &jtmp.x, &jres->x);
+    bn_cmov(&jres->y, skew[i], &jtmp.y, &jres->y);
+    bn_cmov(&jres->z, skew[i], &jtmp.z, &jres->z);
+  }
+
+  memzero(a, sizeof(a));
+  memzero(pmult, sizeof(pmult));
+  memzero(&q, sizeof(q));
+  memzero(&jtmp, sizeof(jtmp));
+}
+
+#endif
+
+// jres = k * p, jres is in Montgomery form iff mont is set
+// returns 0 on success, 1 if k is out of range and 2 if k is zero, in which
+// case jres is set to the point at infinity
+static int point_multiply_field(const ecdsa_curve *curve, const bignum256 *k,
+                                const curve_point *p,
+                                jacobian_curve_point *jres, int mont) {
   // this algorithm is loosely based on
   //  Katsuyuki Okeya and Tsuyoshi Takagi, The Width-w NAF Method Provides
   //  Small Memory and Fast Elliptic Scalar Multiplications Secure against
@@ -417,6 +793,17 @@ int point_multiply(const ecdsa_curve *curve, const bignum256 *k,
     return 1;
   }
 
+#if USE_SECP256K1_GLV
+  if (curve == &secp256k1) {
+    if (bn_is_zero(k)) {
+      point_jacobian_set_infinity(jres);
+      return 2;
+    }
+    point_multiply_glv_field(k, p, jres, mont);
+    return 0;
+  }
+#endif
+
   int i = 0, j = 0;
   static CONFIDENTIAL bignum256 a;
   uint32_t *aptr = NULL;
@@ -424,7 +811,6 @@ int point_multiply(const ecdsa_curve *curve, const bignum256 *k,
   int ashift = 0;
   uint32_t is_even = (k->val[0] & 1) - 1;
   uint32_t bits = {0}, sign = {0}, nsign = {0};
-  static CONFIDENTIAL jacobian_curve_point jres;
   curve_point pmult[8] = {0};
   const bignum256 *prime = &curve->prime;
 
@@ -446,8 +832,8 @@ int point_multiply(const ecdsa_curve *curve, const bignum256 *k,
 
   // special case 0*p:  just return zero. We don't care about constant time.
   if (!is_non_zero) {
-    point_set_infinity(res);
-    return 1;
+    point_jacobian_set_infinity(jres);
+    return 2;
   }
 
   // Now a = k + 2^256 (mod curve->order) and a is odd.
@@ -488,16 +874,16 @@ int point_multiply(const ecdsa_curve *curve, const bignum256 *k,
   sign = (bits >> 4) - 1;
   bits ^= sign;
   bits &= 15;
-  curve_to_jacobian(&pmult[bits >> 1], &jres, prime);
+  curve_to_jacobian_field(&pmult[bits >> 1], jres, prime, mont);
   for (i = 62; i >= 0; i--) {
     // sign = sign(a[i+1])  (0xffffffff for negative, 0 for positive)
     // invariant jres = (-1)^sign sum_{j=i+1..63} (a[j] * 16^{j-i-1} * p)
     // abits >> (ashift - 4) = lowbits(a >> (i*4))
 
-    point_jacobian_double(&jres, curve);
-    point_jacobian_double(&jres, curve);
-    point_jacobian_double(&jres, curve);
-    point_jacobian_double(&jres, curve);
+    point_jacobian_double_field(jres, curve, mont);
+    point_jacobian_double_field(jres, curve, mont);
+    point_jacobian_double_field(jres, curve, mont);
+    point_jacobian_double_field(jres, curve, mont);
 
     // get lowest 5 bits of a >> (i*4).
     ashift -= 4;
@@ -518,41 +904,82 @@ int point_multiply(const ecdsa_curve *curve, const bignum256 *k,
 
     // negate last result to make signs of this round and the
     // last round equal.
-    bn_cnegate((sign ^ nsign) & 1, &jres.z, prime);
+    bn_cnegate((sign ^ nsign) & 1, &jres->z, prime);
 
     // add odd factor
-    point_jacobian_add(&pmult[bits >> 1], &jres, curve);
+    point_jacobian_add_field(&pmult[bits >> 1], jres, curve, mont);
     sign = nsign;
   }
-  bn_cnegate(sign & 1, &jres.z, prime);
-  jacobian_to_curve(&jres, res, prime);
+  bn_cnegate(sign & 1, &jres->z, prime);
   memzero(&a, sizeof(a));
-  memzero(&jres, sizeof(jres));
 
   return 0;
 }
 
+// res = k * p
+// returns 0 on success
+int point_multiply(const ecdsa_curve *curve, const bignum256 *k,
+                   const curve_point *p, curve_point *res) {
+  static CONFIDENTIAL jacobian_curve_point jres;
+
+  int result = point_multiply_field(curve, k, p, &jres, curve->montgomery);
+  if (result == 0) {
+    jacobian_to_curve_field(&jres, res, &curve->prime, curve->montgomery);
+  } else if (result == 2) {
+    point_set_infinity(res);
+  }
+  memzero(&jres, sizeof(jres));
+
+  return result != 0;
+}
+
+// res = k * p in jacobian coordinates
+// returns 0 on success
+int point_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k,
+                            const curve_point *p, jacobian_curve_point *res) {
+  int result = point_multiply_field(curve, k, p, res, curve->montgomery);
+  if (result == 0) {
+    jacobian_from_field(res, &curve->prime, curve->montgomery);
+  }
+
+  return result != 0;
+}
+
+
 #if USE_PRECOMPUTED_CP
 
-// res = k * G
+// p = curve->cp[i][j] = (2*j+1) * 2^(PRECOMPUTED_CP_WINDOW*i) * G
+void precomputed_cp(const ecdsa_curve *curve, int i, int j, curve_point *p) {
+#if USE_PRECOMPUTED_CP_PACKED
+  bn_read_be(curve->cp[i][j].x, &p->x);
+  bn_read_be(curve->cp[i][j].y, &p->y);
+#else
+  *p = curve->cp[i][j];
+#endif
+}
+
+// jres = k * G, jres is in Montgomery form iff mont is set
 // k must be a normalized number with 0 <= k < curve->order
-// returns 0 on success
-int scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
-                    curve_point *res) {
+// returns 0 on success, 1 if k is out of range and 2 if k is zero, in which
+// case jres is set to the point at infinity
+static int scalar_multiply_field(const ecdsa_curve *curve, const bignum256 *k,
+                                 jacobian_curve_point *jres, int mont) {
   if (!bn_is_less(k, &curve->order)) {
     return 1;
   }
 
+  // W = PRECOMPUTED_CP_WINDOW, ROWS = PRECOMPUTED_CP_ROWS
+  enum { W = PRECOMPUTED_CP_WINDOW, ROWS = PRECOMPUTED_CP_ROWS };
   int i = {0}, j = {0};
   static CONFIDENTIAL bignum256 a;
+  static CONFIDENTIAL curve_point cp;
   uint32_t is_even = (k->val[0] & 1) - 1;
   uint32_t lowbits = 0;
-  static CONFIDENTIAL jacobian_curve_point jres;
   const bignum256 *prime = &curve->prime;
 
   // is_even = 0xffffffff if k is even, 0 otherwise.
 
-  // add 2^256.
+  // add 2^(W*ROWS), note that 256 <= W*ROWS <= 260.
   // make number odd: subtract curve->order if even
   uint32_t tmp = 1;
   uint32_t is_non_zero = 0;
@@ -563,69 +990,102 @@ int scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
     tmp >>= BN_BITS_PER_LIMB;
   }
   is_non_zero |= k->val[j];
-  a.val[j] = tmp + 0xffffff + k->val[j] - (curve->order.val[j] & is_even);
+  a.val[j] = tmp + ((1 << (W * ROWS - BN_BITS_PER_LIMB * 8)) - 1) + k->val[j] -
+             (curve->order.val[j] & is_even);
   assert((a.val[0] & 1) != 0);
 
   // special case 0*G:  just return zero. We don't care about constant time.
   if (!is_non_zero) {
-    point_set_infinity(res);
-    return 0;
+    point_jacobian_set_infinity(jres);
+    return 2;
   }
 
-  // Now a = k + 2^256 (mod curve->order) and a is odd.
+  // Now a = k + 2^(W*ROWS) (mod curve->order) and a is odd.
   //
   // The idea is to bring the new a into the form.
-  // sum_{i=0..64} a[i] 16^i,  where |a[i]| < 16 and a[i] is odd.
+  // sum_{i=0..ROWS} a[i] 2^(W*i),  where |a[i]| < 2^W and a[i] is odd.
   // a[0] is odd, since a is odd.  If a[i] would be even, we can
-  // add 1 to it and subtract 16 from a[i-1].  Afterwards,
-  // a[64] = 1, which is the 2^256 that we added before.
+  // add 1 to it and subtract 2^W from a[i-1].  Afterwards,
+  // a[ROWS] = 1, which is the 2^(W*ROWS) that we added before.
   //
-  // Since k = a - 2^256 (mod curve->order), we can compute
-  //   k*G = sum_{i=0..63} a[i] 16^i * G
+  // Since k = a - 2^(W*ROWS) (mod curve->order), we can compute
+  //   k*G = sum_{i=0..ROWS-1} a[i] 2^(W*i) * G
   //
   // We have a big table curve->cp that stores all possible
-  // values of |a[i]| 16^i * G.
-  // curve->cp[i][j] = (2*j+1) * 16^i * G
+  // values of |a[i]| 2^(W*i) * G.
+  // curve->cp[i][j] = (2*j+1) * 2^(W*i) * G
 
-  // now compute  res = sum_{i=0..63} a[i] * 16^i * G step by step.
-  // initial res = |a[0]| * G.  Note that a[0] = a & 0xf if (a&0x10) != 0
-  // and - (16 - (a & 0xf)) otherwise.   We can compute this as
-  //   ((a ^ (((a >> 4) & 1) - 1)) & 0xf) >> 1
+  // now compute  res = sum_{i=0..ROWS-1} a[i] * 2^(W*i) * G step by step.
+  // initial res = |a[0]| * G.  Note that a[0] = a & (2^W-1) if (a&2^W) != 0
+  // and - (2^W - (a & (2^W-1))) otherwise.   We can compute this as
+  //   ((a ^ (((a >> W) & 1) - 1)) & (2^W-1)) >> 1
   // since a is odd.
-  lowbits = a.val[0] & ((1 << 5) - 1);
-  lowbits ^= (lowbits >> 4) - 1;
-  lowbits &= 15;
-  curve_to_jacobian(&curve->cp[0][lowbits >> 1], &jres, prime);
-  for (i = 1; i < 64; i++) {
-    // invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 16^j * G)
-
-    // shift a by 4 places.
+  lowbits = a.val[0] & ((1 << (W + 1)) - 1);
+  lowbits ^= (lowbits >> W) - 1;
+  lowbits &= (1 << W) - 1;
+  precomputed_cp(curve, 0, lowbits >> 1, &cp);
+  curve_to_jacobian_field(&cp, jres, prime, mont);
+  for (i = 1; i < ROWS; i++) {
+    // invariant res = sign(a[i-1]) sum_{j=0..i-1} (a[j] * 2^(W*j) * G)
+
+    // shift a by W places.
     for (j = 0; j < 8; j++) {
-      a.val[j] =
-          (a.val[j] >> 4) | ((a.val[j + 1] & 0xf) << (BN_BITS_PER_LIMB - 4));
+      a.val[j] = (a.val[j] >> W) |
+                 ((a.val[j + 1] & ((1 << W) - 1)) << (BN_BITS_PER_LIMB - W));
     }
-    a.val[j] >>= 4;
-    // a = old(a)>>(4*i)
+    a.val[j] >>= W;
+    // a = old(a)>>(W*i)
     // a is even iff sign(a[i-1]) = -1
 
-    lowbits = a.val[0] & ((1 << 5) - 1);
-    lowbits ^= (lowbits >> 4) - 1;
-    lowbits &= 15;
+    lowbits = a.val[0] & ((1 << (W + 1)) - 1);
+    lowbits ^= (lowbits >> W) - 1;
+    lowbits &= (1 << W) - 1;
     // negate last result to make signs of this round and the
     // last round equal.
-    bn_cnegate(~lowbits & 1, &jres.y, prime);
+    bn_cnegate(~lowbits & 1, &jres->y, prime);
 
     // add odd factor
-    point_jacobian_add(&curve->cp[i][lowbits >> 1], &jres, curve);
+    precomputed_cp(curve, i, lowbits >> 1, &cp);
+    point_jacobian_add_field(&cp, jres, curve, mont);
   }
-  bn_cnegate(~(a.val[0] >> 4) & 1, &jres.y, prime);
-  jacobian_to_curve(&jres, res, prime);
+  bn_cnegate(~(a.val[0] >> W) & 1, &jres->y, prime);
   memzero(&a, sizeof(a));
-  memzero(&jres, sizeof(jres));
+  memzero(&cp, sizeof(cp));
 
   return 0;
 }
 
+// res = k * G
+// k must be a normalized number with 0 <= k < curve->order
+// returns 0 on success
+int scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
+                    curve_point *res) {
+  static CONFIDENTIAL jacobian_curve_point jres;
+
+  int result = scalar_multiply_field(curve, k, &jres, curve->montgomery);
+  if (result == 0) {
+    jacobian_to_curve_field(&jres, res, &curve->prime, curve->montgomery);
+  } else if (result == 2) {
+    point_set_infinity(res);
+  }
+  memzero(&jres, sizeof(jres));
+
+  return result == 1;
+}
+
+// res = k * G in jacobian coordinates
+// k must be a normalized number with 0 <= k < curve->order
+// returns 0 on success
+int scalar_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k,
+                             jacobian_curve_point *res) {
+  int result = scalar_multiply_field(curve, k, res, curve->montgomery);
+  if (result == 0) {
+    jacobian_from_field(res, &curve->prime, curve->montgomery);
+  }
+
+  return result == 1;
+}
+
 #else
 
 int scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
@@ -633,7 +1093,422 @@ int scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
   return point_multiply(curve, k, &curve->G, res);
 }
 
+int scalar_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k,
+                             jacobian_curve_point *res) {
+  return point_multiply_jacobian(curve, k, &curve->G, res);
+}
+
+#endif
+
+// naf = width-5 non-adjacent form of k, i.e. k = sum_i naf[i] * 2^i where
+// every non-zero digit is odd, |naf[i]| < 16 and any five consecutive digits
+// contain at most one non-zero digit
+// k must be normalized with k < 2^256
+// returns the number of digits, which is at most 257
+// doesn't have constant control flow, use only with public k
+static int wnaf_5(const bignum256 *k, int8_t naf[257]) {
+  bignum256 a = *k;
+  int len = 0;
+
+  while (!bn_is_zero(&a)) {
+    int8_t digit = 0;
+    if (bn_is_odd(&a)) {
+      digit = a.val[0] & 31;
+      if (digit >= 16) {
+        digit -= 32;
+        bn_addi(&a, -digit);
+      } else {
+        a.val[0] -= digit;
+      }
+    }
+    naf[len++] = digit;
+    bn_rshift(&a);
+  }
+
+  return len;
+}
+
+// table[8 * j + i] = (2 * i + 1) * p[j] for 0 <= i < 8 and 0 <= j < n
+// jp is a scratch buffer of 8 * n points
+// The affine conversions of all the points share two field inversions.
+static void point_odd_multiples(const ecdsa_curve *curve, const curve_point *p,
+                                size_t n, curve_point *table,
+                                jacobian_curve_point *jp) {
+  const bignum256 *prime = &curve->prime;
+  int mont = curve->montgomery;
+
+  // table[j] = 2 * p[j]
+  for (size_t j = 0; j < n; j++) {
+    curve_to_jacobian_field(&p[j], &jp[j], prime, mont);
+    point_jacobian_double_field(&jp[j], curve, mont);
+  }
+  jacobian_to_curve_batch_field(jp, table, n, prime, mont);
+
+  // jp[8 * j + i] = (2 * i + 1) * p[j], computed by repeatedly adding 2 * p[j]
+  // table[j] is overwritten only after the last use of 2 * p[j]
+  for (size_t j = n; j-- > 0;) {
+    curve_point p2 = table[j];
+    curve_to_jacobian_field(&p[j], &jp[8 * j], prime, mont);
+    for (int i = 1; i < 8; i++) {
+      jp[8 * j + i] = jp[8 * j + i - 1];
+      point_jacobian_add_field(&p2, &jp[8 * j + i], curve, mont);
+    }
+  }
+  jacobian_to_curve_batch_field(jp, table, 8 * n, prime, mont);
+}
+
+// jres = jres + digit * table[|digit| / 2], where digit is odd
+static void point_jacobian_add_digit(const curve_point table[8], int8_t digit,
+                                     jacobian_curve_point *jres,
+                                     const ecdsa_curve *curve, int mont) {
+  curve_point q = table[(digit < 0 ? -digit : digit) >> 1];
+  if (digit < 0) {
+    bn_subtract(&curve->prime, &q.y, &q.y);
+  }
+  point_jacobian_add_checked_field(&q, jres, curve, mont);
+}
+
+// jres = k1 * p1 + k2 * p2, jres is in Montgomery form iff mont is set
+// table1 and table2 hold the odd multiples p, 3 * p, ..., 15 * p of p1 and p2
+// k1 and k2 must be normalized numbers with 0 <= k1, k2 < curve->order
+// Both scalars are processed in a single pass of interleaved width-5 NAF
+// (Shamir's trick), so the doublings are shared.
+static void point_multiply_double_field(const ecdsa_curve *curve,
+                                        const bignum256 *k1,
+                                        const curve_point *table1,
+                                        const bignum256 *k2,
+                                        const curve_point *table2,
+                                        jacobian_curve_point *jres, int mont) {
+  int8_t naf1[257] = {0}, naf2[257] = {0};
+  int len1 = wnaf_5(k1, naf1);
+  int len2 = wnaf_5(k2, naf2);
+
+  point_jacobian_set_infinity(jres);
+  for (int i = (len1 > len2 ? len1 : len2) - 1; i >= 0; i--) {
+    point_jacobian_double_field(jres, curve, mont);
+    if (naf1[i] != 0) {
+      point_jacobian_add_digit(table1, naf1[i], jres, curve, mont);
+    }
+    if (naf2[i] != 0) {
+      point_jacobian_add_digit(table2, naf2[i], jres, curve, mont);
+    }
+  }
+}
+
+// table = G, 3 * G, ..., 15 * G, where G is the generator of the curve
+// jp is a scratch buffer of 8 points
+static const curve_point *generator_odd_multiples(const ecdsa_curve *curve,
+                                                  curve_point table[8],
+                                                  jacobian_curve_point *jp) {
+#if USE_PRECOMPUTED_CP && PRECOMPUTED_CP_COLS >= 8
+  (void)jp;
+#if USE_PRECOMPUTED_CP_PACKED
+  for (int j = 0; j < 8; j++) {
+    precomputed_cp(curve, 0, j, &table[j]);
+  }
+  return table;
+#else
+  // curve->cp[0][j] = (2*j+1) * G
+  (void)table;
+  return curve->cp[0];
+#endif
+#else
+  point_odd_multiples(curve, &curve->G, 1, table, jp);
+  return table;
 #endif
+}
+
+// res = k1 * p1 + k2 * p2
+// k1 and k2 must be normalized numbers with 0 <= k1, k2 < curve->order
+// If p1 or p2 is the generator and the precomputed table is available, it is
+// used for that point. Neither the control flow nor the memory access flow is
+// constant, so the function must only be used with public scalars and points,
+// e.g. in signature verification.
+// returns 0 on success
+int point_multiply_double(const ecdsa_curve *curve, const bignum256 *k1,
+                          const curve_point *p1, const bignum256 *k2,
+                          const curve_point *p2, curve_point *res) {
+  if (!bn_is_less(k1, &curve->order) || !bn_is_less(k2, &curve->order)) {
+    return 1;
+  }
+
+  const curve_point *p[2] = {p1, p2};
+  const curve_point *table[2] = {0};
+  curve_point points[2] = {0};
+  curve_point pmult[16] = {0};
+  jacobian_curve_point jp[16] = {0};
+  jacobian_curve_point jres = {0};
+  size_t n = 0;
+
+  for (int i = 0; i < 2; i++) {
+#if USE_PRECOMPUTED_CP && PRECOMPUTED_CP_COLS >= 8
+    if (point_is_equal(p[i], &curve->G)) {
+      // pmult[8..15] is only needed if neither point is the generator
+      table[i] = generator_odd_multiples(curve, &pmult[8], jp);
+      continue;
+    }
+#endif
+    table[i] = &pmult[8 * n];
+    points[n++] = *p[i];
+  }
+  point_odd_multiples(curve, points, n, pmult, jp);
+
+  point_multiply_double_field(curve, k1, table[0], k2, table[1], &jres,
+                              curve->montgomery);
+  jacobian_to_curve_batch_field(&jres, res, 1, &curve->prime,
+                                curve->montgomery);
+
+  return 0;
+}
+
+// p2 = p1 + p2, where both points are in jacobian coordinates, which are in
+// Montgomery form iff mont is set
+// This handles the point at infinity in both arguments and the doubling, but
+// doesn't have constant control flow with regard to them.
+static void point_jacobian_add_jacobian_field(const jacobian_curve_point *p1,
+                                              jacobian_curve_point *p2,
+                                              const ecdsa_curve *curve,
+                                              int mont) {
+  bignum256 z1sq = {0}, z2sq = {0}, u1 = {0}, u2 = {0}, s1 = {0}, s2 = {0};
+  bignum256 h = {0}, r = {0}, hsq = {0}, hcb = {0}, t = {0};
+  const bignum256 *prime = &curve->prime;
+
+  if (point_jacobian_is_infinity(p1, curve)) {
+    return;
+  }
+  if (point_jacobian_is_infinity(p2, curve)) {
+    *p2 = *p1;
+    return;
+  }
+
+  z1sq = p1->z;
+  field_square(mont, &z1sq, prime);
+  z2sq = p2->z;
+  field_square(mont, &z2sq, prime);
+
+  // u1 = x1 * z2^2, u2 = x2 * z1^2
+  u1 = p1->x;
+  field_multiply(mont, &z2sq, &u1, prime);
+  u2 = p2->x;
+  field_multiply(mont, &z1sq, &u2, prime);
+
+  // s1 = y1 * z2^3, s2 = y2 * z1^3
+  s1 = p1->y;
+  field_multiply(mont, &p2->z, &s1, prime);
+  field_multiply(mont, &z2sq, &s1, prime);
+  s2 = p2->y;
+  field_multiply(mont, &p1->z, &s2, prime);
+  field_multiply(mont, &z1sq, &s2, prime);
+
+  // h = u2 - u1, r = s2 - s1
+  bn_subtractmod(&u2, &u1, &h, prime);
+  bn_fast_mod(&h, prime);
+  bn_subtractmod(&s2, &s1, &r, prime);
+  bn_fast_mod(&r, prime);
+
+  t = h;
+  bn_mod(&t, prime);
+  if (bn_is_zero(&t)) {
+    t = r;
+    bn_mod(&t, prime);
+    if (bn_is_zero(&t)) {
+      point_jacobian_double_field(p2, curve, mont);
+    } else {
+      point_jacobian_set_infinity(p2);
+    }
+    return;
+  }
+
+  // hsq = h^2, hcb = h^3, u1 = u1 * h^2
+  hsq = h;
+  field_square(mont, &hsq, prime);
+  hcb = h;
+  field_multiply(mont, &hsq, &hcb, prime);
+  field_multiply(mont, &hsq, &u1, prime);
+
+  // z3 = z1 * z2 * h
+  field_multiply(mont, &p1->z, &p2->z, prime);
+  field_multiply(mont, &h, &p2->z, prime);
+
+  // x3 = r^2 - h^3 - 2 * u1 * h^2
+  p2->x = r;
+  field_square(mont, &p2->x, prime);
+  bn_subtractmod(&p2->x, &hcb, &p2->x, prime);
+  bn_fast_mod(&p2->x, prime);
+  t = u1;
+  bn_mult_k(&t, 2, prime);
+  bn_subtractmod(&p2->x, &t, &p2->x, prime);
+  bn_fast_mod(&p2->x, prime);
+
+  // y3 = r * (u1 * h^2 - x3) - s1 * h^3
+  bn_subtractmod(&u1, &p2->x, &p2->y, prime);
+  bn_fast_mod(&p2->y, prime);
+  field_multiply(mont, &r, &p2->y, prime);
+  field_multiply(mont, &s1, &hcb, prime);
+  bn_subtractmod(&p2->y, &hcb, &p2->y, prime);
+  bn_fast_mod(&p2->y, prime);
+}
+
+// returns bits i, i+1, ..., i+c-1 of x, where bits beyond 256 are zero
+static uint32_t pippenger_window(const bignum256 *x, int i, int c) {
+  int limb = i / BN_BITS_PER_LIMB, shift = i % BN_BITS_PER_LIMB;
+  uint32_t bits = x->val[limb] >> shift;
+  if (shift > BN_BITS_PER_LIMB - c && limb + 1 < BN_LIMBS) {
+    bits |= x->val[limb + 1] << (BN_BITS_PER_LIMB - shift);
+  }
+  return bits & ((1u << c) - 1);
+}
+
+// jres = k[0] * p[0] + ... + k[n - 1] * p[n - 1] by Pippenger's bucket method,
+// jres is in Montgomery form iff mont is set
+// k[i] must be normalized numbers with 0 <= k[i] < curve->order
+// The function is not inlined, so that its buckets and the tables of
+// point_multiply_straus_field don't add up in the stack frame of
+// point_multiply_multi.
+static __attribute__((noinline)) void point_multiply_pippenger_field(
+    const ecdsa_curve *curve, size_t n, const bignum256 *k,
+    const curve_point *p, jacobian_curve_point *jres, int mont) {
+  const int c = PIPPENGER_WINDOW;
+  const bignum256 *prime = &curve->prime;
+  jacobian_curve_point buckets[(1 << PIPPENGER_WINDOW) - 1] = {0};
+  jacobian_curve_point sum = {0}, total = {0};
+  uint32_t used = 0;
+
+  point_jacobian_set_infinity(jres);
+  for (int i = (256 + c - 1) / c - 1; i >= 0; i--) {
+    for (int j = 0; j < c; j++) {
+      point_jacobian_double_field(jres, curve, mont);
+    }
+
+    // buckets[d - 1] = sum of the points whose window i is d
+    used = 0;
+    for (size_t j = 0; j < n; j++) {
+      uint32_t d = pippenger_window(&k[j], i * c, c);
+      if (d == 0 || point_is_infinity(&p[j])) {
+        continue;
+      }
+      jacobian_curve_point *b = &buckets[d - 1];
+      if (used & (1u << (d - 1))) {
+        point_jacobian_add_checked_field(&p[j], b, curve, mont);
+        continue;
+      }
+      b->x = p[j].x;
+      b->y = p[j].y;
+      bn_one(&b->z);
+      if (mont) {
+        bn_to_mont(&b->x, &curve->mont_r2, prime);
+        bn_to_mont(&b->y, &curve->mont_r2, prime);
+        bn_to_mont(&b->z, &curve->mont_r2, prime);
+      }
+      used |= 1u << (d - 1);
+    }
+
+    // total = sum of d * buckets[d - 1] as a running sum
+    point_jacobian_set_infinity(&sum);
+    point_jacobian_set_infinity(&total);
+    for (int d = (1 << c) - 1; d > 0; d--) {
+      if (used & (1u << (d - 1))) {
+        point_jacobian_add_jacobian_field(&buckets[d - 1], &sum, curve, mont);
+      }
+      point_jacobian_add_jacobian_field(&sum, &total, curve, mont);
+    }
+    point_jacobian_add_jacobian_field(&total, jres, curve, mont);
+  }
+}
+
+// jsum = k[0] * p[0] + ... + k[n - 1] * p[n - 1] in chunks of up to
+// POINT_MULTIPLY_MULTI_SIZE points, the scalars of a chunk in a single pass of
+// interleaved width-5 NAF (Straus' method), jsum is in Montgomery form iff mont
+// is set
+// k[i] must be normalized numbers with 0 <= k[i] < curve->order
+static __attribute__((noinline)) void point_multiply_straus_field(
+    const ecdsa_curve *curve, size_t n, const bignum256 *k,
+    const curve_point *p, jacobian_curve_point *jsum, int mont) {
+  const bignum256 *prime = &curve->prime;
+  const curve_point *table[POINT_MULTIPLY_MULTI_SIZE] = {0};
+  curve_point points[POINT_MULTIPLY_MULTI_SIZE] = {0};
+  curve_point pmult[8 * POINT_MULTIPLY_MULTI_SIZE] = {0};
+#if USE_PRECOMPUTED_CP && PRECOMPUTED_CP_COLS >= 8
+  curve_point gmult[8] = {0};
+#endif
+  jacobian_curve_point jp[8 * POINT_MULTIPLY_MULTI_SIZE] = {0};
+  int8_t naf[POINT_MULTIPLY_MULTI_SIZE][257] = {0};
+  int len[POINT_MULTIPLY_MULTI_SIZE] = {0};
+  jacobian_curve_point jres = {0};
+  curve_point sum = {0};
+
+  point_jacobian_set_infinity(jsum);
+  for (size_t start = 0; start < n; start += POINT_MULTIPLY_MULTI_SIZE) {
+    size_t m = n - start;
+    if (m > POINT_MULTIPLY_MULTI_SIZE) {
+      m = POINT_MULTIPLY_MULTI_SIZE;
+    }
+
+    size_t count = 0;
+    int max_len = 0;
+    for (size_t j = 0; j < m; j++) {
+      len[j] = wnaf_5(&k[start + j], naf[j]);
+      if (len[j] > max_len) {
+        max_len = len[j];
+      }
+#if USE_PRECOMPUTED_CP && PRECOMPUTED_CP_COLS >= 8
+      if (point_is_equal(&p[start + j], &curve->G)) {
+        table[j] = generator_odd_multiples(curve, gmult, jp);
+        continue;
+      }
+#endif
+      table[j] = &pmult[8 * count];
+      points[count++] = p[start + j];
+    }
+    point_odd_multiples(curve, points, count, pmult, jp);
+
+    point_jacobian_set_infinity(&jres);
+    for (int i = max_len - 1; i >= 0; i--) {
+      point_jacobian_double_field(&jres, curve, mont);
+      for (size_t j = 0; j < m; j++) {
+        if (i < len[j] && naf[j][i] != 0) {
+          point_jacobian_add_digit(table[j], naf[j][i], &jres, curve, mont);
+        }
+      }
+    }
+
+    if (start == 0) {
+      *jsum = jres;
+    } else {
+      jacobian_to_curve_batch_field(&jres, &sum, 1, prime, mont);
+      point_jacobian_add_checked_field(&sum, jsum, curve, mont);
+    }
+  }
+}
+
+// res = k[0] * p[0] + k[1] * p[1] + ... + k[n - 1] * p[n - 1]
+// k[i] must be normalized numbers with 0 <= k[i] < curve->order
+// Fewer than PIPPENGER_MIN_POINTS points are processed in chunks of up to
+// POINT_MULTIPLY_MULTI_SIZE, the scalars of a chunk in a single pass of
+// interleaved width-5 NAF (Straus' method). More points use Pippenger's bucket
+// method. Like point_multiply_double, the function must only be used with
+// public scalars and points.
+// returns 0 on success
+int point_multiply_multi(const ecdsa_curve *curve, size_t n,
+                         const bignum256 *k, const curve_point *p,
+                         curve_point *res) {
+  for (size_t i = 0; i < n; i++) {
+    if (!bn_is_less(&k[i], &curve->order)) {
+      return 1;
+    }
+  }
+
+  int mont = curve->montgomery;
+  jacobian_curve_point jsum = {0};
+  if (n >= PIPPENGER_MIN_POINTS) {
+    point_multiply_pippenger_field(curve, n, k, p, &jsum, mont);
+  } else {
+    point_multiply_straus_field(curve, n, k, p, &jsum, mont);
+  }
+  jacobian_to_curve_batch_field(&jsum, res, 1, &curve->prime, mont);
+
+  return 0;
+}
 
 int tc_ecdh_multiply(const ecdsa_curve *curve, const uint8_t *priv_key,
                      const uint8_t *pub_key, uint8_t *session_key) {
@@ -1026,7 +1901,7 @@ int tc_ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
                                   const uint8_t *sig, const uint8_t *digest,
                                   int recid) {
   bignum256 r = {0}, s = {0}, e = {0};
-  curve_point cp = {0}, cp2 = {0};
+  curve_point cp = {0};
 
   // read r and s
   bn_read_be(sig, &r);
@@ -1062,12 +1937,9 @@ int tc_ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
   // s = s * r^-1
   bn_multiply(&r, &s, &curve->order);
   bn_mod(&s, &curve->order);
-  // cp = s * r^-1 * k * G
-  point_multiply(curve, &s, &cp, &cp);
-  // cp2 = -digest * r^-1 * G
-  scalar_multiply(curve, &e, &cp2);
-  // cp = (s * r^-1 * k - digest * r^-1) * G = Pub
-  point_add(curve, &cp2, &cp);
+  // cp = s * r^-1 * k * G - digest * r^-1 * G
+  //    = (s * r^-1 * k - digest * r^-1) * G = Pub
+  point_multiply_double(curve, &s, &cp, &e, &curve->G, &cp);
   // The point at infinity is not considered to be a valid public key.
   if (point_is_infinity(&cp)) {
     return 1;
@@ -1078,35 +1950,66 @@ int tc_ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
   return 0;
 }
 
+// Reads the public key, the signature (r, s) and the digest z of a signature
+// verification.
+// returns 0 on success, otherwise the error code of tc_ecdsa_verify_digest
+static int ecdsa_verify_digest_read(const ecdsa_curve *curve,
+                                    const uint8_t *pub_key, const uint8_t *sig,
+                                    const uint8_t *digest, curve_point *pub,
+                                    bignum256 *r, bignum256 *s, bignum256 *z) {
+  if (!ecdsa_read_pubkey(curve, pub_key, pub)) {
+    return 1;
+  }
+
+  bn_read_be(sig, r);
+  bn_read_be(sig + 32, s);
+  bn_read_be(digest, z);
+  if (bn_is_zero(z)) {
+    // The digest was all-zero. The probability of this happening by chance is
+    // infinitesimal, but it could be induced by a fault injection. In this
+    // case the signature (r,s) can be forged by taking r := (t * Q).x mod n
+    // and s := r * t^-1 mod n for any t in [1, n-1]. We fail verification,
+    // because there is no guarantee that the signature was created by the
+    // owner of the private key.
+    return 3;
+  }
+  if (bn_is_zero(r) || bn_is_zero(s) || (!bn_is_less(r, &curve->order)) ||
+      (!bn_is_less(s, &curve->order))) {
+    return 2;
+  }
+
+  return 0;
+}
+
+// Checks the point R = u1 * G + u2 * Q computed by a signature verification
+// against r.
+// returns 0 if the signature matches, otherwise the error code of
+// tc_ecdsa_verify_digest
+static int ecdsa_verify_digest_check(const ecdsa_curve *curve, curve_point *res,
+                                     const bignum256 *r) {
+  if (point_is_infinity(res)) {
+    // R == Infinity
+    return 4;
+  }
+
+  bn_mod(&(res->x), &curve->order);
+  if (!bn_is_equal(&res->x, r)) {
+    // R.x != r
+    // signature does not match
+    return 5;
+  }
+
+  return 0;
+}
+
 // returns 0 if verification succeeded
 int tc_ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
                            const uint8_t *sig, const uint8_t *digest) {
   curve_point pub = {0}, res = {0};
   bignum256 r = {0}, s = {0}, z = {0};
-  int result = 0;
-
-  if (!ecdsa_read_pubkey(curve, pub_key, &pub)) {
-    result = 1;
-  }
 
-  if (result == 0) {
-    bn_read_be(sig, &r);
-    bn_read_be(sig + 32, &s);
-    bn_read_be(digest, &z);
-    if (bn_is_zero(&r) || bn_is_zero(&s) || (!bn_is_less(&r, &curve->order)) ||
-        (!bn_is_less(&s, &curve->order))) {
-      result = 2;
-    }
-    if (bn_is_zero(&z)) {
-      // The digest was all-zero. The probability of this happening by chance is
-      // infinitesimal, but it could be induced by a fault injection. In this
-      // case the signature (r,s) can be forged by taking r := (t * Q).x mod n
-      // and s := r * t^-1 mod n for any t in [1, n-1]. We fail verification,
-      // because there is no guarantee that the signature was created by the
-      // owner of the private key.
-      result = 3;
-    }
-  }
+  int result =
+      ecdsa_verify_digest_read(curve, pub_key, sig, digest, &pub, &r, &s, &z);
 
   if (result == 0) {
     bn_inverse(&s, &curve->order);       // s = s^-1
@@ -1114,22 +2017,9 @@ int tc_ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
     bn_mod(&z, &curve->order);
     bn_multiply(&r, &s, &curve->order);  // s = r * s  [u2 = r * s^-1 mod n]
     bn_mod(&s, &curve->order);
-    scalar_multiply(curve, &z, &res);       // res = z * G    [= u1 * G]
-    point_multiply(curve, &s, &pub, &pub);  // pub = s * pub  [= u2 * Q]
-    point_add(curve, &pub, &res);  // res = pub + res  [R = u1 * G + u2 * Q]
-    if (point_is_infinity(&res)) {
-      // R == Infinity
-      result = 4;
-    }
-  }
-
-  if (result == 0) {
-    bn_mod(&(res.x), &curve->order);
-    if (!bn_is_equal(&res.x, &r)) {
-      // R.x != r
-      // signature does not match
-      result = 5;
-    }
+    // res = z * G + s * pub  [R = u1 * G + u2 * Q]
+    point_multiply_double(curve, &z, &curve->G, &s, &pub, &res);
+    result = ecdsa_verify_digest_check(curve, &res, &r);
   }
 
   memzero(&pub, sizeof(pub));
@@ -1142,13 +2032,149 @@ int tc_ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
   return result;
 }
 
+// x[i] = x[i]^-1 (mod prime) for 0 <= i < n
+// All the inversions share a single call of bn_inverse (Montgomery's trick).
+// x[i] must be partly reduced and different from zero modulo prime
+// tmp is a scratch buffer of n numbers
+static void bn_inverse_batch(bignum256 *x, bignum256 *tmp, size_t n,
+                             const bignum256 *prime) {
+  bignum256 acc = {0};
+
+  if (n == 0) {
+    return;
+  }
+
+  tmp[0] = x[0];
+  for (size_t i = 1; i < n; i++) {
+    // tmp[i] = x[0] * ... * x[i]
+    tmp[i] = x[i];
+    bn_multiply(&tmp[i - 1], &tmp[i], prime);
+  }
+
+  acc = tmp[n - 1];
+  bn_inverse(&acc, prime);
+  for (size_t i = n - 1; i > 0; i--) {
+    // acc = (x[0] * ... * x[i])^-1
+    bn_multiply(&acc, &tmp[i - 1], prime);
+    // tmp[i - 1] = x[i]^-1
+    bn_multiply(&x[i], &acc, prime);
+    x[i] = tmp[i - 1];
+  }
+  x[0] = acc;
+}
+
+// tc_ecdsa_verify_digest for n <= ECDSA_VERIFY_BATCH_SIZE signatures sharing
+// their field inversions
+// returns 0 if all the signatures are valid, otherwise the error code of the
+// first invalid signature, whose index is stored in bad_index
+static int tc_ecdsa_verify_digest_chunk(const ecdsa_curve *curve, size_t n,
+                                        const uint8_t *const *pub_keys,
+                                        const uint8_t *const *sigs,
+                                        const uint8_t *const *digests,
+                                        size_t *bad_index) {
+  curve_point pub[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  curve_point res[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 r[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 s[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 z[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  bignum256 tmp[ECDSA_VERIFY_BATCH_SIZE] = {0};
+  curve_point gmult[8] = {0};
+  curve_point pmult[8 * ECDSA_VERIFY_BATCH_SIZE] = {0};
+  jacobian_curve_point jp[8 * ECDSA_VERIFY_BATCH_SIZE] = {0};
+  const curve_point *gtable = NULL;
+  int read_result = 0;
+  int result = 0;
+
+  // only the signatures preceding the first malformed one are verified
+  for (size_t i = 0; i < n; i++) {
+    read_result = ecdsa_verify_digest_read(curve, pub_keys[i], sigs[i],
+                                           digests[i], &pub[i], &r[i], &s[i],
+                                           &z[i]);
+    if (read_result != 0) {
+      *bad_index = i;
+      n = i;
+      break;
+    }
+  }
+
+  // s[i] = s[i]^-1
+  bn_inverse_batch(s, tmp, n, &curve->order);
+  for (size_t i = 0; i < n; i++) {
+    // z = z * s  [u1 = z * s^-1 mod n]
+    bn_multiply(&s[i], &z[i], &curve->order);
+    bn_mod(&z[i], &curve->order);
+    // s = r * s  [u2 = r * s^-1 mod n]
+    bn_multiply(&r[i], &s[i], &curve->order);
+    bn_mod(&s[i], &curve->order);
+  }
+
+  if (n > 0) {
+    gtable = generator_odd_multiples(curve, gmult, jp);
+    point_odd_multiples(curve, pub, n, pmult, jp);
+  }
+  for (size_t i = 0; i < n; i++) {
+    // jp[i] = z * G + s * pub  [R = u1 * G + u2 * Q]
+    point_multiply_double_field(curve, &z[i], gtable, &s[i], &pmult[8 * i],
+                                &jp[i], curve->montgomery);
+  }
+  jacobian_to_curve_batch_field(jp, res, n, &curve->prime, curve->montgomery);
+
+  result = read_result;
+  for (size_t i = 0; i < n; i++) {
+    int check_result = ecdsa_verify_digest_check(curve, &res[i], &r[i]);
+    if (check_result != 0) {
+      *bad_index = i;
+      result = check_result;
+      break;
+    }
+  }
+
+  memzero(pub, sizeof(pub));
+  memzero(res, sizeof(res));
+  memzero(r, sizeof(r));
+  memzero(s, sizeof(s));
+  memzero(z, sizeof(z));
+
+  return result;
+}
+
+// Verifies count signatures, where sigs[i] is the signature of digests[i]
+// made with pub_keys[i]. Up to ECDSA_VERIFY_BATCH_SIZE signatures at a time
+// share the field inversions of their verification.
+// returns 0 if all the signatures are valid, otherwise the error code of
+// tc_ecdsa_verify_digest for the first invalid signature, whose index is
+// stored in bad_index unless it is NULL
+int tc_ecdsa_verify_digest_batch(const ecdsa_curve *curve, size_t count,
+                                 const uint8_t *const *pub_keys,
+                                 const uint8_t *const *sigs,
+                                 const uint8_t *const *digests,
+                                 size_t *bad_index) {
+  for (size_t i = 0; i < count; i += ECDSA_VERIFY_BATCH_SIZE) {
+    size_t n = count - i;
+    size_t bad = 0;
+    if (n > ECDSA_VERIFY_BATCH_SIZE) {
+      n = ECDSA_VERIFY_BATCH_SIZE;
+    }
+    int result = tc_ecdsa_verify_digest_chunk(curve, n, pub_keys + i, sigs + i,
+                                              digests + i, &bad);
+    if (result != 0) {
+      if (bad_index != NULL) {
+        *bad_index = i + bad;
+      }
+      return result;
+    }
+  }
+
+  return 0;
+}
+
 ecdsa_tweak_pubkey_result tc_ecdsa_tweak_pubkey(
     const ecdsa_curve *curve, const uint8_t *public_key_bytes,
     const uint8_t *tweak_bytes, uint8_t *tweaked_public_key_bytes) {
   int result = ECDSA_TWEAK_PUBKEY_SUCCESS;
   curve_point public_key = {0};
   bignum256 tweak = {0};
-  curve_point public_tweak = {0};
+  jacobian_curve_point public_tweak = {0};
 
   if (public_key_bytes[0] != 0x02 && public_key_bytes[0] != 0x03) {
     result = ECDSA_TWEAK_PUBKEY_INVALID_PUBKEY_ERR;
@@ -1166,13 +2192,14 @@ ecdsa_tweak_pubkey_result tc_ecdsa_tweak_pubkey(
     goto end;
   }
 
-  (void)scalar_multiply(curve, &tweak, &public_tweak);
-  point_add(curve, &public_tweak, &public_key);
+  (void)scalar_multiply_jacobian(curve, &tweak, &public_tweak);
+  point_jacobian_add(&public_key, &public_tweak, curve);
 
-  if (point_is_infinity(&public_key)) {
+  if (point_jacobian_is_infinity(&public_tweak, curve)) {
     result = ECDSA_TWEAK_PUBKEY_INVALID_TWEAK_OR_RESULT_ERR;
     goto end;
   }
+  jacobian_to_curve(&public_tweak, &public_key, &curve->prime);
 
   tweaked_public_key_bytes[0] = 0x02 | (public_key.y.val[0] & 0x01);
   bn_write_be(&public_key.x, tweaked_public_key_bytes + 1);
@@ -1303,10 +2330,41 @@ int ecdsa_sig_from_der(const uint8_t *der, size_t der_len, uint8_t sig[64]) {
   return 0;
 }
 
+#ifdef USE_SECP256K1_ZKP_ECDSA
+static int secp256k1_zkp_enabled = 1;
+
+// returns true iff the operations on curve are routed to libsecp256k1-zkp
+static inline int use_zkp(const ecdsa_curve *curve) {
+  return curve == &secp256k1 && secp256k1_zkp_enabled;
+}
+#endif
+
+// Routes the secp256k1 operations of the functions below to libsecp256k1-zkp
+// if enabled is nonzero and to trezor-crypto otherwise, the setting has no
+// effect unless compiled with USE_SECP256K1_ZKP_ECDSA
+// only meant for tests and benchmarks, the firmware exposes it to Python only
+// in debug builds (PYOPT=0)
+void ecdsa_secp256k1_set_zkp(int enabled) {
+#ifdef USE_SECP256K1_ZKP_ECDSA
+  secp256k1_zkp_enabled = enabled != 0;
+#else
+  (void)enabled;
+#endif
+}
+
+// returns 1 iff the secp256k1 operations are routed to libsecp256k1-zkp
+int ecdsa_secp256k1_get_zkp(void) {
+#ifdef USE_SECP256K1_ZKP_ECDSA
+  return secp256k1_zkp_enabled;
+#else
+  return 0;
+#endif
+}
+
 int ecdsa_get_public_key33(const ecdsa_curve *curve, const uint8_t *priv_key,
                            uint8_t *pub_key) {
 #ifdef USE_SECP256K1_ZKP_ECDSA
-  if (curve == &secp256k1) {
+  if (use_zkp(curve)) {
     return zkp_ecdsa_get_public_key33(curve, priv_key, pub_key);
   }
 #endif
@@ -1316,7 +2374,7 @@ int ecdsa_get_public_key33(const ecdsa_curve *curve, const uint8_t *priv_key,
 int ecdsa_get_public_key65(const ecdsa_curve *curve, const uint8_t *priv_key,
                            uint8_t *pub_key) {
 #ifdef USE_SECP256K1_ZKP_ECDSA
-  if (curve == &secp256k1) {
+  if (use_zkp(curve)) {
     return zkp_ecdsa_get_public_key65(curve, priv_key, pub_key);
   }
 #endif
@@ -1327,7 +2385,7 @@ int ecdsa_sign_digest(const ecdsa_curve *curve, const uint8_t *priv_key,
                       const uint8_t *digest, uint8_t *sig, uint8_t *pby,
                       int (*is_canonical)(uint8_t by, uint8_t sig[64])) {
 #ifdef USE_SECP256K1_ZKP_ECDSA
-  if (curve == &secp256k1) {
+  if (use_zkp(curve)) {
     return zkp_ecdsa_sign_digest(curve, priv_key, digest, sig, pby,
                                  is_canonical);
   }
@@ -1338,18 +2396,42 @@ int ecdsa_sign_digest(const ecdsa_curve *curve, const uint8_t *priv_key,
 int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
                         const uint8_t *sig, const uint8_t *digest) {
 #ifdef USE_SECP256K1_ZKP_ECDSA
-  if (curve == &secp256k1) {
+  if (use_zkp(curve)) {
     return zkp_ecdsa_verify_digest(curve, pub_key, sig, digest);
   }
 #endif
   return tc_ecdsa_verify_digest(curve, pub_key, sig, digest);
 }
 
+int ecdsa_verify_digest_batch(const ecdsa_curve *curve, size_t count,
+                              const uint8_t *const *pub_keys,
+                              const uint8_t *const *sigs,
+                              const uint8_t *const *digests,
+                              size_t *bad_index) {
+#ifdef USE_SECP256K1_ZKP_ECDSA
+  if (use_zkp(curve)) {
+    for (size_t i = 0; i < count; i++) {
+      int result =
+          zkp_ecdsa_verify_digest(curve, pub_keys[i], sigs[i], digests[i]);
+      if (result != 0) {
+        if (bad_index != NULL) {
+          *bad_index = i;
+        }
+        return result;
+      }
+    }
+    return 0;
+  }
+#endif
+  return tc_ecdsa_verify_digest_batch(curve, count, pub_keys, sigs, digests,
+                                      bad_index);
+}
+
 int ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
                                const uint8_t *sig, const uint8_t *digest,
                                int recid) {
 #ifdef USE_SECP256K1_ZKP_ECDSA
-  if (curve == &secp256k1) {
+  if (use_zkp(curve)) {
     return zkp_ecdsa_recover_pub_from_sig(curve, pub_key, sig, digest, recid);
   }
 #endif
@@ -1359,7 +2441,7 @@ int ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
 int ecdh_multiply(const ecdsa_curve *curve, const uint8_t *priv_key,
                   const uint8_t *pub_key, uint8_t *session_key) {
 #ifdef USE_SECP256K1_ZKP_ECDSA
-  if (curve == &secp256k1) {
+  if (use_zkp(curve)) {
     return zkp_ecdh_multiply(curve, priv_key, pub_key, session_key);
   }
 #endif
@@ -1371,7 +2453,7 @@ ecdsa_tweak_pubkey_result ecdsa_tweak_pubkey(const ecdsa_curve *curve,
                                              const uint8_t *tweak,
                                              uint8_t *tweaked_pub_key) {
 #ifdef USE_SECP256K1_ZKP_ECDSA
-  if (curve == &secp256k1) {
+  if (use_zkp(curve)) {
     return zkp_ecdsa_tweak_pubkey(curve, pub_key, tweak, tweaked_pub_key);
   }
 #endif
@@ -34,6 +34,26 @@ typedef struct {
   bignum256 x, y;
 } curve_point;
 
+// curve point in jacobian coordinates, represents the affine point
+// (x / z^2, y / z^3), any point with z == 0 is the point at infinity
+typedef struct jacobian_curve_point {
+  bignum256 x, y, z;
+} jacobian_curve_point;
+
+#if PRECOMPUTED_CP_WINDOW < 2 || PRECOMPUTED_CP_WINDOW > 8
+#error "PRECOMPUTED_CP_WINDOW must be between 2 and 8"
+#endif
+
+// dimensions of the table of precomputed curve points
+#define PRECOMPUTED_CP_ROWS \
+  ((256 + PRECOMPUTED_CP_WINDOW - 1) / PRECOMPUTED_CP_WINDOW)
+#define PRECOMPUTED_CP_COLS (1 << (PRECOMPUTED_CP_WINDOW - 1))
+
+// curve point with big-endian coordinates
+typedef struct {
+  uint8_t x[32], y[32];
+} packed_curve_point;
+
 typedef struct {
   bignum256 prime;       // prime order of the finite field
   curve_point G;         // initial curve point
@@ -41,9 +61,16 @@ typedef struct {
   bignum256 order_half;  // order of G divided by 2
   int a;                 // coefficient 'a' of the elliptic curve
   bignum256 b;           // coefficient 'b' of the elliptic curve
+  int montgomery;        // use Montgomery multiplication in point arithmetic
+  bignum256 mont_r2;     // 2**522 % prime, see bn_to_mont
 
 #if USE_PRECOMPUTED_CP
-  const curve_point cp[64][8];
+  // cp[i][j] = (2*j+1) * 2^(PRECOMPUTED_CP_WINDOW*i) * G
+#if USE_PRECOMPUTED_CP_PACKED
+  const packed_curve_point cp[PRECOMPUTED_CP_ROWS][PRECOMPUTED_CP_COLS];
+#else
+  const curve_point cp[PRECOMPUTED_CP_ROWS][PRECOMPUTED_CP_COLS];
+#endif
 #endif
 
 } ecdsa_curve;
@@ -73,6 +100,31 @@ int point_is_equal(const curve_point *p, const curve_point *q);
 int point_is_negative_of(const curve_point *p, const curve_point *q);
 int scalar_multiply(const ecdsa_curve *curve, const bignum256 *k,
                     curve_point *res);
+void curve_to_jacobian(const curve_point *p, jacobian_curve_point *jp,
+                       const bignum256 *prime);
+void jacobian_to_curve(const jacobian_curve_point *jp, curve_point *p,
+                       const bignum256 *prime);
+void jacobian_to_curve_batch(const jacobian_curve_point *jp, curve_point *p,
+                             size_t n, const bignum256 *prime);
+void point_jacobian_add(const curve_point *p1, jacobian_curve_point *p2,
+                        const ecdsa_curve *curve);
+void point_jacobian_double(jacobian_curve_point *p, const ecdsa_curve *curve);
+void point_jacobian_set_infinity(jacobian_curve_point *p);
+int point_jacobian_is_infinity(const jacobian_curve_point *p,
+                               const ecdsa_curve *curve);
+int point_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k,
+                            const curve_point *p, jacobian_curve_point *res);
+int scalar_multiply_jacobian(const ecdsa_curve *curve, const bignum256 *k,
+                             jacobian_curve_point *res);
+#if USE_PRECOMPUTED_CP
+void precomputed_cp(const ecdsa_curve *curve, int i, int j, curve_point *p);
+#endif
+int point_multiply_double(const ecdsa_curve *curve, const bignum256 *k1,
+                          const curve_point *p1, const bignum256 *k2,
+                          const curve_point *p2, curve_point *res);
+int point_multiply_multi(const ecdsa_curve *curve, size_t n,
+                         const bignum256 *k, const curve_point *p,
+                         curve_point *res);
 int ecdh_multiply(const ecdsa_curve *curve, const uint8_t *priv_key,
                   const uint8_t *pub_key, uint8_t *session_key);
 void compress_coords(const curve_point *cp, uint8_t *compressed);
@@ -88,6 +140,9 @@ int ecdsa_sign(const ecdsa_curve *curve, HasherType hasher_sign,
 int ecdsa_sign_digest(const ecdsa_curve *curve, const uint8_t *priv_key,
                       const uint8_t *digest, uint8_t *sig, uint8_t *pby,
                       int (*is_canonical)(uint8_t by, uint8_t sig[64]));
+void ecdsa_secp256k1_set_zkp(int enabled);
+int ecdsa_secp256k1_get_zkp(void);
+
 int ecdsa_get_public_key33(const ecdsa_curve *curve, const uint8_t *priv_key,
                            uint8_t *pub_key);
 int ecdsa_get_public_key65(const ecdsa_curve *curve, const uint8_t *priv_key,
@@ -119,6 +174,11 @@ int ecdsa_verify(const ecdsa_curve *curve, HasherType hasher_sign,
                  uint32_t msg_len);
 int ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
                         const uint8_t *sig, const uint8_t *digest);
+int ecdsa_verify_digest_batch(const ecdsa_curve *curve, size_t count,
+                              const uint8_t *const *pub_keys,
+                              const uint8_t *const *sigs,
+                              const uint8_t *const *digests,
+                              size_t *bad_index);
 int ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
                                const uint8_t *sig, const uint8_t *digest,
                                int recid);
@@ -36,6 +36,11 @@ int tc_ecdsa_sign_digest(const ecdsa_curve *curve, const uint8_t *priv_key,
                          int (*is_canonical)(uint8_t by, uint8_t sig[64]));
 int tc_ecdsa_verify_digest(const ecdsa_curve *curve, const uint8_t *pub_key,
                            const uint8_t *sig, const uint8_t *digest);
+int tc_ecdsa_verify_digest_batch(const ecdsa_curve *curve, size_t count,
+                                 const uint8_t *const *pub_keys,
+                                 const uint8_t *const *sigs,
+                                 const uint8_t *const *digests,
+                                 size_t *bad_index);
 int tc_ecdsa_recover_pub_from_sig(const ecdsa_curve *curve, uint8_t *pub_key,
                                   const uint8_t *sig, const uint8_t *digest,
                                   int recid);
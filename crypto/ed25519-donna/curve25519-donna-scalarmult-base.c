@@ -1,6 +1,240 @@
 #include "ed25519-donna.h"
 #include "ed25519.h"
 
+#if USE_CURVE25519_ASM_ARM && (defined(__ARM_ARCH_7EM__) || (defined(__ARM_ARCH_8M_MAIN__) && defined(__ARM_FEATURE_DSP)))
+#define CURVE25519_PACKED 1
+/* lo + hi * 2^32 = a * b + lo + hi */
+#define CURVE25519_UMAAL(lo, hi, a, b) \
+	__asm__("umaal %0, %1, %2, %3" : "+r"(lo), "+r"(hi) : "r"(a), "r"(b))
+#else
+#define CURVE25519_PACKED 0
+#endif
+
+#if CURVE25519_PACKED
+/*
+	Field element as eight 32-bit words, the value sum(x[i] * 2^(32*i)) is only
+	reduced below 2^256. Every partial product of a multiplication is a single
+	UMAAL, which needs about half the multiply instructions of the 25.5-bit limbs
+	of curve25519-donna-32bit.c.
+*/
+typedef uint32_t packed25519[8];
+
+/* out += c * 2^256, which is c * 38 mod p */
+static void curve25519_packed_carry(packed25519 out, uint32_t c) {
+	uint64_t acc = (uint64_t)c * 38;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		acc += out[i];
+		out[i] = (uint32_t)acc;
+		acc >>= 32;
+	}
+	/* a carry leaves out < c * 38, so adding it once more can't carry */
+	out[0] += (uint32_t)acc * 38;
+}
+
+/* out -= b * 2^256, which is b * 38 mod p */
+static void curve25519_packed_borrow(packed25519 out, uint32_t b) {
+	uint64_t d = (uint64_t)b * 38;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		d = (uint64_t)out[i] - d;
+		out[i] = (uint32_t)d;
+		d >>= 63;
+	}
+	/* a borrow leaves out >= 2^256 - 38, so subtracting it once more can't borrow */
+	out[0] -= (uint32_t)d * 38;
+}
+
+/* out = a + b */
+static void curve25519_packed_add(packed25519 out, const packed25519 a, const packed25519 b) {
+	uint64_t acc = 0;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		acc += (uint64_t)a[i] + b[i];
+		out[i] = (uint32_t)acc;
+		acc >>= 32;
+	}
+	curve25519_packed_carry(out, (uint32_t)acc);
+}
+
+/* out = a - b */
+static void curve25519_packed_sub(packed25519 out, const packed25519 a, const packed25519 b) {
+	uint64_t d = 0;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		d = (uint64_t)a[i] - b[i] - d;
+		out[i] = (uint32_t)d;
+		d >>= 63;
+	}
+	curve25519_packed_borrow(out, (uint32_t)d);
+}
+
+/* out = lo + hi * 2^256 for the 512-bit product t = lo + hi * 2^256 */
+static void curve25519_packed_reduce(packed25519 out, const uint32_t t[16]) {
+	uint32_t c = 0, lo = 0;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		lo = t[i];
+		CURVE25519_UMAAL(lo, c, t[i + 8], 38);
+		out[i] = lo;
+	}
+	curve25519_packed_carry(out, c);
+}
+
+/* out = a * b */
+static void curve25519_packed_mul(packed25519 out, const packed25519 a, const packed25519 b) {
+	uint32_t t[16] = {0};
+	uint32_t c = 0;
+	int i = 0, j = 0;
+
+	for (i = 0; i < 8; i++) {
+		c = 0;
+		for (j = 0; j < 8; j++)
+			CURVE25519_UMAAL(t[i + j], c, a[i], b[j]);
+		t[i + 8] = c;
+	}
+	curve25519_packed_reduce(out, t);
+}
+
+/* out = a^2, the products a[i] * a[j] with i != j are computed once and doubled */
+static void curve25519_packed_square(packed25519 out, const packed25519 a) {
+	uint32_t t[16] = {0};
+	uint32_t c = 0;
+	uint64_t acc = 0;
+	int i = 0, j = 0;
+
+	for (i = 0; i < 7; i++) {
+		c = 0;
+		for (j = i + 1; j < 8; j++)
+			CURVE25519_UMAAL(t[i + j], c, a[i], a[j]);
+		t[i + 8] = c;
+	}
+	for (i = 15; i > 0; i--)
+		t[i] = (t[i] << 1) | (t[i - 1] >> 31);
+	c = 0;
+	for (i = 0; i < 8; i++) {
+		CURVE25519_UMAAL(t[2 * i], c, a[i], a[i]);
+		acc = (uint64_t)t[2 * i + 1] + c;
+		t[2 * i + 1] = (uint32_t)acc;
+		c = (uint32_t)(acc >> 32);
+	}
+	curve25519_packed_reduce(out, t);
+}
+
+static void curve25519_packed_square_times(packed25519 out, const packed25519 in, int count) {
+	curve25519_packed_square(out, in);
+	while (--count)
+		curve25519_packed_square(out, out);
+}
+
+/* out = in * scalar */
+static void curve25519_packed_scalar_product(packed25519 out, const packed25519 in, const uint32_t scalar) {
+	uint32_t c = 0, lo = 0;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		lo = 0;
+		CURVE25519_UMAAL(lo, c, in[i], scalar);
+		out[i] = lo;
+	}
+	curve25519_packed_carry(out, c);
+}
+
+/* z^(p - 2) = z(2^255 - 21), the same chain as curve25519_recip */
+static void curve25519_packed_recip(packed25519 out, const packed25519 z) {
+	packed25519 a = {0}, t0 = {0}, b = {0}, c = {0};
+
+	/* 2 */ curve25519_packed_square(a, z);
+	/* 8 */ curve25519_packed_square_times(t0, a, 2);
+	/* 9 */ curve25519_packed_mul(b, t0, z);
+	/* 11 */ curve25519_packed_mul(a, b, a);
+	/* 22 */ curve25519_packed_square(t0, a);
+	/* 2^5 - 2^0 = 31 */ curve25519_packed_mul(b, t0, b);
+	/* 2^10 - 2^5 */ curve25519_packed_square_times(t0, b, 5);
+	/* 2^10 - 2^0 */ curve25519_packed_mul(b, t0, b);
+	/* 2^20 - 2^10 */ curve25519_packed_square_times(t0, b, 10);
+	/* 2^20 - 2^0 */ curve25519_packed_mul(c, t0, b);
+	/* 2^40 - 2^20 */ curve25519_packed_square_times(t0, c, 20);
+	/* 2^40 - 2^0 */ curve25519_packed_mul(t0, t0, c);
+	/* 2^50 - 2^10 */ curve25519_packed_square_times(t0, t0, 10);
+	/* 2^50 - 2^0 */ curve25519_packed_mul(b, t0, b);
+	/* 2^100 - 2^50 */ curve25519_packed_square_times(t0, b, 50);
+	/* 2^100 - 2^0 */ curve25519_packed_mul(c, t0, b);
+	/* 2^200 - 2^100 */ curve25519_packed_square_times(t0, c, 100);
+	/* 2^200 - 2^0 */ curve25519_packed_mul(t0, t0, c);
+	/* 2^250 - 2^50 */ curve25519_packed_square_times(t0, t0, 50);
+	/* 2^250 - 2^0 */ curve25519_packed_mul(b, t0, b);
+	/* 2^255 - 2^5 */ curve25519_packed_square_times(b, b, 5);
+	/* 2^255 - 21 */ curve25519_packed_mul(out, b, a);
+}
+
+static void curve25519_packed_swap_conditional(packed25519 a, packed25519 b, uint32_t iswap) {
+	const uint32_t swap = (uint32_t)(-(int32_t)iswap);
+	uint32_t x = 0;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		x = (a[i] ^ b[i]) & swap;
+		a[i] ^= x;
+		b[i] ^= x;
+	}
+}
+
+/* Take a little-endian, 32-byte number, ignoring the top bit */
+static void curve25519_packed_expand(packed25519 out, const unsigned char in[32]) {
+	int i = 0;
+
+	for (i = 0; i < 8; i++)
+		out[i] = ((uint32_t)in[4 * i]) | ((uint32_t)in[4 * i + 1] << 8) | ((uint32_t)in[4 * i + 2] << 16) | ((uint32_t)in[4 * i + 3] << 24);
+	out[7] &= 0x7fffffff;
+}
+
+/* out = in + 19 * (in >> 255) with bit 255 cleared, both are equal mod p */
+static void curve25519_packed_fold(packed25519 out, const packed25519 in) {
+	uint64_t acc = (uint64_t)(in[7] >> 31) * 19;
+	int i = 0;
+
+	for (i = 0; i < 8; i++) {
+		acc += (i == 7) ? (in[7] & 0x7fffffff) : in[i];
+		out[i] = (uint32_t)acc;
+		acc >>= 32;
+	}
+}
+
+/* Fully reduce in and contract it into a little-endian, 32-byte array */
+static void curve25519_packed_contract(unsigned char out[32], const packed25519 in) {
+	packed25519 f = {0}, g = {0};
+	uint32_t mask = 0;
+	uint64_t acc = 19;
+	int i = 0;
+
+	/* f < 2^255 + 19 after the first fold, f < 2^255 after the second one */
+	curve25519_packed_fold(f, in);
+	curve25519_packed_fold(f, f);
+
+	/* f - p = f + 19 - 2^255, taken if f + 19 reaches bit 255 */
+	for (i = 0; i < 8; i++) {
+		acc += f[i];
+		g[i] = (uint32_t)acc;
+		acc >>= 32;
+	}
+	mask = (uint32_t)(-(int32_t)(g[7] >> 31));
+	g[7] &= 0x7fffffff;
+	for (i = 0; i < 8; i++) {
+		f[i] ^= (f[i] ^ g[i]) & mask;
+		out[4 * i + 0] = (unsigned char)(f[i]);
+		out[4 * i + 1] = (unsigned char)(f[i] >> 8);
+		out[4 * i + 2] = (unsigned char)(f[i] >> 16);
+		out[4 * i + 3] = (unsigned char)(f[i] >> 24);
+	}
+}
+#endif
+
 /* Calculates nQ where Q is the x-coordinate of a point on the curve
  *
  *   mypublic: the packed little endian x coordinate of the resulting curve point
@@ -8,6 +242,65 @@
  *   basepoint: a packed little endian point of the curve
  */
 
+#if CURVE25519_PACKED
+void curve25519_scalarmult_donna(curve25519_key mypublic, const curve25519_key n, const curve25519_key basepoint) {
+	packed25519 nqpqx = {1}, nqpqz = {0}, nqz = {1}, nqx = {0};
+	packed25519 q = {0}, qx = {0}, qpqx = {0}, qqx = {0}, zzz = {0}, zmone = {0};
+	size_t bit = 0, lastbit = 0;
+	int32_t i = 0;
+
+	curve25519_packed_expand(q, basepoint);
+	memcpy(nqx, q, sizeof(packed25519));
+
+	/* bit 255 is always 0, and bit 254 is always 1, so skip bit 255 and
+	   start pre-swapped on bit 254 */
+	lastbit = 1;
+
+	/* we are doing bits 254..3 in the loop, but are swapping in bits 253..2 */
+	for (i = 253; i >= 2; i--) {
+		curve25519_packed_add(qx, nqx, nqz);
+		curve25519_packed_sub(nqz, nqx, nqz);
+		curve25519_packed_add(qpqx, nqpqx, nqpqz);
+		curve25519_packed_sub(nqpqz, nqpqx, nqpqz);
+		curve25519_packed_mul(nqpqx, qpqx, nqz);
+		curve25519_packed_mul(nqpqz, qx, nqpqz);
+		curve25519_packed_add(qqx, nqpqx, nqpqz);
+		curve25519_packed_sub(nqpqz, nqpqx, nqpqz);
+		curve25519_packed_square(nqpqz, nqpqz);
+		curve25519_packed_square(nqpqx, qqx);
+		curve25519_packed_mul(nqpqz, nqpqz, q);
+		curve25519_packed_square(qx, qx);
+		curve25519_packed_square(nqz, nqz);
+		curve25519_packed_mul(nqx, qx, nqz);
+		curve25519_packed_sub(nqz, qx, nqz);
+		curve25519_packed_scalar_product(zzz, nqz, 121665);
+		curve25519_packed_add(zzz, zzz, qx);
+		curve25519_packed_mul(nqz, nqz, zzz);
+
+		bit = (n[i/8] >> (i & 7)) & 1;
+		curve25519_packed_swap_conditional(nqx, nqpqx, bit ^ lastbit);
+		curve25519_packed_swap_conditional(nqz, nqpqz, bit ^ lastbit);
+		lastbit = bit;
+	}
+
+	/* the final 3 bits are always zero, so we only need to double */
+	for (i = 0; i < 3; i++) {
+		curve25519_packed_add(qx, nqx, nqz);
+		curve25519_packed_sub(nqz, nqx, nqz);
+		curve25519_packed_square(qx, qx);
+		curve25519_packed_square(nqz, nqz);
+		curve25519_packed_mul(nqx, qx, nqz);
+		curve25519_packed_sub(nqz, qx, nqz);
+		curve25519_packed_scalar_product(zzz, nqz, 121665);
+		curve25519_packed_add(zzz, zzz, qx);
+		curve25519_packed_mul(nqz, nqz, zzz);
+	}
+
+	curve25519_packed_recip(zmone, nqz);
+	curve25519_packed_mul(nqz, nqx, zmone);
+	curve25519_packed_contract(mypublic, nqz);
+}
+#else
 void curve25519_scalarmult_donna(curve25519_key mypublic, const curve25519_key n, const curve25519_key basepoint) {
 	bignum25519 nqpqx = {1}, nqpqz = {0}, nqz = {1}, nqx = {0};
 	bignum25519 q = {0}, qx = {0}, qpqx = {0}, qqx = {0}, zzz = {0}, zmone = {0};
@@ -65,3 +358,4 @@ void curve25519_scalarmult_donna(curve25519_key mypublic, const curve25519_key n
 	curve25519_mul(nqz, nqx, zmone);
 	curve25519_contract(mypublic, nqz);
 }
+#endif
@@ -380,6 +380,122 @@ void ge25519_double_scalarmult_vartime2(ge25519 *r, const ge25519 *p1, const big
 }
 #endif
 
+/* computes [s[0]]p[0] + ... + [s[n-1]]p[n-1] with Straus' method, n <= POINT_MULTIPLY_MULTI_SIZE */
+static void ge25519_multi_scalarmult_straus_vartime(ge25519 *r, size_t n, const bignum256modm *s, const ge25519 *p) {
+	signed char slide[POINT_MULTIPLY_MULTI_SIZE][256] = {0};
+	ge25519_pniels pre[POINT_MULTIPLY_MULTI_SIZE][S1_TABLE_SIZE] = {0};
+	ge25519 dp = {0};
+	ge25519_p1p1 t = {0};
+	int32_t i = 0;
+	size_t j = 0;
+
+	memzero(&t, sizeof(ge25519_p1p1));
+	for (j = 0; j < n; j++) {
+		contract256_slidingwindow_modm(slide[j], s[j], S1_SWINDOWSIZE);
+
+		ge25519_double(&dp, &p[j]);
+		ge25519_full_to_pniels(pre[j], &p[j]);
+		for (i = 0; i < S1_TABLE_SIZE - 1; i++)
+			ge25519_pnielsadd(&pre[j][i+1], &dp, &pre[j][i]);
+	}
+
+	ge25519_set_neutral(r);
+
+	for (i = 255; i >= 0; i--) {
+		for (j = 0; j < n; j++)
+			if (slide[j][i])
+				break;
+		if (j < n)
+			break;
+	}
+
+	for (; i >= 0; i--) {
+		ge25519_double_p1p1(&t, r);
+
+		for (j = 0; j < n; j++) {
+			if (slide[j][i]) {
+				ge25519_p1p1_to_full(r, &t);
+				ge25519_pnielsadd_p1p1(&t, r, &pre[j][abs(slide[j][i]) / 2], (unsigned char)slide[j][i] >> 7);
+			}
+		}
+
+		ge25519_p1p1_to_partial(r, &t);
+	}
+	curve25519_mul(r->t, t.x, t.y);
+	memzero(slide, sizeof(slide));
+}
+
+/* returns the c bits of s starting at bit pos */
+static uint32_t ge25519_multi_scalarmult_window(const bignum256modm s, int pos, int c) {
+	int limb = pos / bignum256modm_bits_per_limb;
+	int shift = pos % bignum256modm_bits_per_limb;
+	uint32_t w = s[limb] >> shift;
+	if (shift + c > bignum256modm_bits_per_limb && limb + 1 < bignum256modm_limb_size)
+		w |= s[limb + 1] << (bignum256modm_bits_per_limb - shift);
+	return w & ((1 << c) - 1);
+}
+
+/* computes [s[0]]p[0] + ... + [s[n-1]]p[n-1] with Pippenger's bucket method */
+static void ge25519_multi_scalarmult_pippenger_vartime(ge25519 *r, size_t n, const bignum256modm *s, const ge25519 *p) {
+	const int c = PIPPENGER_WINDOW;
+	ge25519 buckets[(1 << PIPPENGER_WINDOW) - 1] = {0};
+	ge25519 sum = {0}, total = {0};
+	uint32_t used = 0;
+	int i = 0, k = 0;
+	size_t j = 0;
+
+	ge25519_set_neutral(r);
+	for (i = (256 + c - 1) / c - 1; i >= 0; i--) {
+		for (k = 0; k < c - 1; k++)
+			ge25519_double_partial(r, r);
+		ge25519_double(r, r);
+
+		/* buckets[d - 1] = sum of the points whose window i is d */
+		used = 0;
+		for (j = 0; j < n; j++) {
+			uint32_t d = ge25519_multi_scalarmult_window(s[j], i * c, c);
+			if (d == 0)
+				continue;
+			if (used & (1u << (d - 1))) {
+				ge25519_add(&buckets[d - 1], &buckets[d - 1], &p[j], 0);
+			} else {
+				ge25519_copy(&buckets[d - 1], &p[j]);
+				used |= 1u << (d - 1);
+			}
+		}
+
+		/* total = sum of d * buckets[d - 1] as a running sum */
+		ge25519_set_neutral(&sum);
+		ge25519_set_neutral(&total);
+		for (k = (1 << c) - 2; k >= 0; k--) {
+			if (used & (1u << k))
+				ge25519_add(&sum, &sum, &buckets[k], 0);
+			ge25519_add(&total, &total, &sum, 0);
+		}
+		ge25519_add(r, r, &total, 0);
+	}
+}
+
+/* computes [s[0]]p[0] + ... + [s[n-1]]p[n-1] */
+void ge25519_multi_scalarmult_vartime(ge25519 *r, size_t n, const bignum256modm *s, const ge25519 *p) {
+	ge25519 t = {0};
+	size_t i = 0, m = 0;
+
+	if (n >= PIPPENGER_MIN_POINTS) {
+		ge25519_multi_scalarmult_pippenger_vartime(r, n, s, p);
+		return;
+	}
+
+	ge25519_set_neutral(r);
+	for (i = 0; i < n; i += m) {
+		m = n - i;
+		if (m > POINT_MULTIPLY_MULTI_SIZE)
+			m = POINT_MULTIPLY_MULTI_SIZE;
+		ge25519_multi_scalarmult_straus_vartime(&t, m, s + i, p + i);
+		ge25519_add(r, r, &t, 0);
+	}
+}
+
 /*
  * The following conditional move stuff uses conditional moves.
  * I will check on which compilers this works, and provide suitable
@@ -28,6 +28,9 @@ void ge25519_nielsadd2_p1p1(ge25519_p1p1 *r, const ge25519 *p, const ge25519_nie
 void ge25519_double_scalarmult_vartime2(ge25519 *r, const ge25519 *p1, const bignum256modm s1, const ge25519 *p2, const bignum256modm s2);
 #endif
 
+/* computes [s[0]]p[0] + ... + [s[n-1]]p[n-1] */
+void ge25519_multi_scalarmult_vartime(ge25519 *r, size_t n, const bignum256modm *s, const ge25519 *p);
+
 void ge25519_pnielsadd_p1p1(ge25519_p1p1 *r, const ge25519 *p, const ge25519_pniels *q, unsigned char signbit);
 
 void ge25519_double_partial(ge25519 *r, const ge25519 *p);
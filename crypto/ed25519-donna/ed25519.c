@@ -152,14 +152,15 @@ ED25519_FN(ed25519_sign) (const unsigned char *m, size_t mlen, const ed25519_sec
 	memzero(&extsk, sizeof(extsk));
 }
 
-int
-ED25519_FN(ed25519_sign_open) (const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ed25519_signature RS) {
-	ge25519 ALIGN(16) R = {0}, A = {0};
+/* verifies RS with the public key pk, whose negative point is A */
+static int
+ed25519_sign_open_point(const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ge25519 *A, const ed25519_signature RS) {
+	ge25519 ALIGN(16) R = {0};
 	hash_512bits hash = {0};
 	bignum256modm hram = {0}, S = {0};
 	unsigned char checkR[32] = {0};
 
-	if ((RS[63] & 224) || !ge25519_unpack_negative_vartime(&A, pk))
+	if (RS[63] & 224)
 		return -1;
 
 	/* hram = H(R,A,m) */
@@ -172,13 +173,164 @@ ED25519_FN(ed25519_sign_open) (const unsigned char *m, size_t mlen, const ed2551
 		return -1;
 
 	/* SB - H(R,A,m)A */
-	ge25519_double_scalarmult_vartime(&R, &A, hram, S);
+	ge25519_double_scalarmult_vartime(&R, A, hram, S);
 	ge25519_pack(checkR, &R);
 
 	/* check that R = SB - H(R,A,m)A */
 	return ed25519_verify(RS, checkR, 32) ? 0 : -1;
 }
 
+int
+ED25519_FN(ed25519_sign_open) (const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ed25519_signature RS) {
+	ge25519 ALIGN(16) A = {0};
+
+	if (!ge25519_unpack_negative_vartime(&A, pk))
+		return -1;
+
+	return ed25519_sign_open_point(m, mlen, pk, &A, RS);
+}
+
+/*
+	Same as ed25519_sign_open with a public key decompressed by ed25519_public_key_expand,
+	which saves the square root of the decompression when a key verifies many signatures.
+*/
+_Static_assert(sizeof(ge25519) == sizeof(((ed25519_public_key_expanded *)0)->negA), "ed25519_public_key_expanded doesn't fit ge25519");
+
+int
+ED25519_FN(ed25519_sign_open_expanded) (const unsigned char *m, size_t mlen, const ed25519_public_key_expanded *pk, const ed25519_signature RS) {
+	ge25519 ALIGN(16) A = {0};
+
+	memcpy(&A, pk->negA, sizeof(A));
+	return ed25519_sign_open_point(m, mlen, pk->pk, &A, RS);
+}
+
+/*
+	Verifies num signatures, RS[i] is the signature of m[i] (mlen[i] bytes) made with pk[i].
+	valid[i] is set to 1 if the signature is valid and to 0 otherwise, unless valid is NULL.
+
+	As many signatures at a time as fit into scratch are checked by the batch equation
+	(sum z_i S_i) B - sum z_i R_i - sum z_i H(R_i,A_i,m_i) A_i = 0 with random 128-bit z_i,
+	using a single multi-scalar multiplication. If the equation doesn't hold, the signatures
+	are verified one by one. scratch has to be aligned to 4 bytes, ED25519_BATCH_SCRATCH_SIZE(n)
+	bytes hold batches of n signatures. Like the upstream donna batch verifier, the equation
+	isn't multiplied by the cofactor, so it only differs from ed25519_sign_open for signatures
+	whose R has a small order component, which only the holder of the secret key can make.
+	Non-canonical encodings of R are verified one by one, so that they are rejected like by
+	ed25519_sign_open.
+
+	returns 0 if all the signatures are valid, -1 otherwise
+*/
+_Static_assert(sizeof(ge25519) + sizeof(bignum256modm) <= ED25519_BATCH_SCRATCH_ENTRY, "ED25519_BATCH_SCRATCH_ENTRY is too small");
+
+/*
+	returns 1 if R is the canonical encoding of a point: y < p, and the sign bit is clear if x = 0,
+	i.e. if y = 1 or y = p - 1. ed25519_sign_open compares R with a canonical encoding, so it
+	rejects the other encodings, which ge25519_unpack_negative_vartime accepts.
+*/
+static int
+ed25519_is_canonical_r(const unsigned char R[32]) {
+	unsigned char ones = 0xff, zeros = 0;
+	size_t i = 0;
+
+	for (i = 1; i < 31; i++) {
+		ones &= R[i];
+		zeros |= R[i];
+	}
+	zeros |= R[31] & 0x7f;
+
+	/* y = 1 */
+	if (R[0] == 1 && zeros == 0)
+		return !(R[31] & 0x80);
+	if (ones == 0xff && (R[31] & 0x7f) == 0x7f) {
+		/* y = p - 1 */
+		if (R[0] == 0xec)
+			return !(R[31] & 0x80);
+		/* y >= p */
+		if (R[0] >= 0xed)
+			return 0;
+	}
+	return 1;
+}
+
+int
+ED25519_FN(ed25519_sign_open_batch) (const unsigned char *const *m, const size_t *mlen, const unsigned char *const *pk, const unsigned char *const *RS, size_t num, int *valid, void *scratch, size_t scratch_size) {
+	ge25519 *points = (ge25519 *)scratch;
+	bignum256modm *scalars = NULL;
+	ge25519 ALIGN(16) sum = {0};
+	hash_512bits hash = {0};
+	bignum256modm z = {0}, t = {0};
+	unsigned char zbytes[16] = {0};
+	unsigned char check[32] = {0};
+	size_t batch = 0, i = 0, j = 0, n = 0;
+	int ok = 0, ret = 0;
+
+	if (scratch_size >= ED25519_BATCH_SCRATCH_SIZE(1))
+		batch = (scratch_size / ED25519_BATCH_SCRATCH_ENTRY - 1) / 2;
+	scalars = (bignum256modm *)(points + 2 * batch + 1);
+
+	for (i = 0; i < num; i += n) {
+		n = num - i;
+		if (n > batch)
+			n = batch;
+		ok = (n > 0);
+
+		/* points = B, -A_0, ..., -A_{n-1}, -R_0, ..., -R_{n-1} */
+		if (ok) {
+			ge25519_set_base(&points[0]);
+			set256_modm(scalars[0], 0);
+		}
+		for (j = 0; ok && j < n; j++) {
+			if ((RS[i+j][63] & 224) || !ed25519_is_canonical_r(RS[i+j]) || !ge25519_unpack_negative_vartime(&points[1+j], pk[i+j]) || !ge25519_unpack_negative_vartime(&points[1+n+j], RS[i+j])) {
+				ok = 0;
+				break;
+			}
+			expand_raw256_modm(t, RS[i+j] + 32);
+			if (!is_reduced256_modm(t)) {
+				ok = 0;
+				break;
+			}
+
+			/* z_i = 1 for the first signature, random otherwise */
+			if (j == 0) {
+				set256_modm(z, 1);
+			} else {
+				random_buffer(zbytes, sizeof(zbytes));
+				expand256_modm(z, zbytes, sizeof(zbytes));
+			}
+
+			/* scalars = sum z_i S_i, z_i H(R_i,A_i,m_i) for the A_i and z_i for the R_i */
+			mul256_modm(t, t, z);
+			add256_modm(scalars[0], scalars[0], t);
+			ed25519_hram(hash, RS[i+j], pk[i+j], m[i+j], mlen[i+j]);
+			expand256_modm(t, hash, 64);
+			mul256_modm(scalars[1+j], t, z);
+			copy256_modm(scalars[1+n+j], z);
+		}
+
+		if (ok) {
+			ge25519_multi_scalarmult_vartime(&sum, 2 * n + 1, scalars, points);
+			ge25519_pack(check, &sum);
+			/* the neutral element is (0, 1) */
+			ok = (check[0] == 1);
+			for (j = 1; j < 32; j++)
+				ok &= (check[j] == 0);
+		} else if (n == 0) {
+			/* no scratch space, verify the remaining signatures one by one */
+			n = num - i;
+		}
+
+		for (j = 0; j < n; j++) {
+			int v = ok || ED25519_FN(ed25519_sign_open)(m[i+j], mlen[i+j], pk[i+j], RS[i+j]) == 0;
+			if (valid)
+				valid[i+j] = v;
+			if (!v)
+				ret = -1;
+		}
+	}
+
+	return ret;
+}
+
 int
 ED25519_FN(ed25519_scalarmult) (ed25519_public_key res, const ed25519_secret_key sk, const ed25519_public_key pk) {
 	bignum256modm a = {0};
@@ -205,6 +357,58 @@ ED25519_FN(ed25519_scalarmult) (ed25519_public_key res, const ed25519_secret_key
 
 #include "curve25519-donna-scalarmult-base.h"
 
+#if USE_ED25519_PUBKEY_CACHE
+/* the first ed25519_pubkey_cache_count entries, most recently used first */
+static ed25519_public_key_expanded ed25519_pubkey_cache[ED25519_PUBKEY_CACHE_SIZE];
+static size_t ed25519_pubkey_cache_count = 0;
+#endif
+
+/*
+	Decompresses the public key pk for ed25519_sign_open_expanded, the recently
+	expanded keys are looked up in a cache instead of being decompressed again.
+
+	returns 0 on success, -1 if pk isn't a valid point
+*/
+int
+ed25519_public_key_expand(ed25519_public_key_expanded *res, const ed25519_public_key pk) {
+	ge25519 ALIGN(16) A = {0};
+
+#if USE_ED25519_PUBKEY_CACHE
+	for (size_t i = 0; i < ed25519_pubkey_cache_count; i++) {
+		if (memcmp(ed25519_pubkey_cache[i].pk, pk, sizeof(ed25519_public_key)) == 0) {
+			*res = ed25519_pubkey_cache[i];
+			memmove(&ed25519_pubkey_cache[1], &ed25519_pubkey_cache[0], i * sizeof(ed25519_public_key_expanded));
+			ed25519_pubkey_cache[0] = *res;
+			return 0;
+		}
+	}
+#endif
+
+	if (!ge25519_unpack_negative_vartime(&A, pk))
+		return -1;
+	memcpy(res->pk, pk, sizeof(ed25519_public_key));
+	memcpy(res->negA, &A, sizeof(A));
+
+#if USE_ED25519_PUBKEY_CACHE
+	if (ed25519_pubkey_cache_count < ED25519_PUBKEY_CACHE_SIZE)
+		ed25519_pubkey_cache_count++;
+	memmove(&ed25519_pubkey_cache[1], &ed25519_pubkey_cache[0], (ed25519_pubkey_cache_count - 1) * sizeof(ed25519_public_key_expanded));
+	ed25519_pubkey_cache[0] = *res;
+#endif
+	return 0;
+}
+
+/* negative point of pk, taken from the cache of ed25519_public_key_expand */
+static int
+ed25519_unpack_negative_expanded(ge25519 *r, const ed25519_public_key pk) {
+	ed25519_public_key_expanded epk = {0};
+
+	if (ed25519_public_key_expand(&epk, pk) != 0)
+		return 0;
+	memcpy(r, epk.negA, sizeof(ge25519));
+	return 1;
+}
+
 void
 ed25519_publickey_ext(const ed25519_secret_key extsk, ed25519_public_key pk) {
 	bignum256modm a = {0};
@@ -229,17 +433,17 @@ ed25519_cosi_combine_publickeys(ed25519_public_key res, CONST ed25519_public_key
 		memcpy(res, pks, sizeof(ed25519_public_key));
 		return 0;
 	}
-	if (!ge25519_unpack_negative_vartime(&P, pks[i++])) {
+	if (!ed25519_unpack_negative_expanded(&P, pks[i++])) {
 		return -1;
 	}
 	ge25519_full_to_pniels(&sump, &P);
 	while (i < n - 1) {
-		if (!ge25519_unpack_negative_vartime(&P, pks[i++])) {
+		if (!ed25519_unpack_negative_expanded(&P, pks[i++])) {
 			return -1;
 		}
 		ge25519_pnielsadd(&sump, &P, &sump);
 	}
-	if (!ge25519_unpack_negative_vartime(&P, pks[i++])) {
+	if (!ed25519_unpack_negative_expanded(&P, pks[i++])) {
 		return -1;
 	}
 	ge25519_pnielsadd_p1p1(&sump1, &P, &sump, 0);
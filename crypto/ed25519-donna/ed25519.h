@@ -2,6 +2,7 @@
 #define ED25519_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "options.h"
 
@@ -17,15 +18,29 @@ typedef unsigned char curve25519_key[32];
 
 typedef unsigned char ed25519_cosi_signature[32];
 
+/* public key together with its decompressed negative point, see ed25519_public_key_expand */
+typedef struct {
+	ed25519_public_key pk;
+	uint32_t negA[40];
+} ed25519_public_key_expanded;
+
+/* size of a point and a scalar, the scratch space of ed25519_sign_open_batch holds 2 * n + 1 of them for batches of n signatures */
+#define ED25519_BATCH_SCRATCH_ENTRY 196
+#define ED25519_BATCH_SCRATCH_SIZE(n) ((2 * (n) + 1) * ED25519_BATCH_SCRATCH_ENTRY)
+
 void ed25519_publickey(const ed25519_secret_key sk, ed25519_public_key pk);
 void ed25519_publickey_ext(const ed25519_secret_key extsk, ed25519_public_key pk);
 
 int ed25519_sign_open(const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ed25519_signature RS);
+int ed25519_sign_open_batch(const unsigned char *const *m, const size_t *mlen, const unsigned char *const *pk, const unsigned char *const *RS, size_t num, int *valid, void *scratch, size_t scratch_size);
+int ed25519_sign_open_expanded(const unsigned char *m, size_t mlen, const ed25519_public_key_expanded *pk, const ed25519_signature RS);
 void ed25519_sign(const unsigned char *m, size_t mlen, const ed25519_secret_key sk, ed25519_signature RS);
 void ed25519_sign_ext(const unsigned char *m, size_t mlen, const ed25519_secret_key secret_scalar, const ed25519_secret_key skext, ed25519_signature RS);
 
 int ed25519_scalarmult(ed25519_public_key res, const ed25519_secret_key sk, const ed25519_public_key pk);
 
+int ed25519_public_key_expand(ed25519_public_key_expanded *res, const ed25519_public_key pk);
+
 void curve25519_scalarmult(curve25519_key mypublic, const curve25519_key secret, const curve25519_key basepoint);
 void curve25519_scalarmult_basepoint(curve25519_key mypublic, const curve25519_key secret);
 
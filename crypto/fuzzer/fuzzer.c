@@ -1446,6 +1446,18 @@ int fuzz_segwit_addr_decode(void) {
 
 #define META_HEADER_SIZE 3
 
+// called once by libFuzzer before the first input
+int LLVMFuzzerInitialize(int *argc, char ***argv) {
+  (void)argc;
+  (void)argv;
+
+  // set up the expensive shared context ahead of the fuzzing loop so that
+  // its cost is not attributed to the first input (timeouts, exec/s stats),
+  // the targets still call this in case the engine skips the initializer
+  zkp_initialize_context_or_crash();
+  return 0;
+}
+
 int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
   // reject input that is too short
   if (size < META_HEADER_SIZE) {
@@ -151,6 +151,12 @@ void hasher_Raw(HasherType type, const uint8_t *data, size_t length,
                 uint8_t hash[HASHER_DIGEST_LENGTH]) {
   Hasher hasher = {0};
 
+  if (type == HASHER_SHA2) {
+    // sha256_Raw can use a hash peripheral
+    sha256_Raw(data, length, hash);
+    return;
+  }
+
   hasher_Init(&hasher, type);
   hasher_Update(&hasher, data, length);
   hasher_Final(&hasher, hash);
@@ -78,21 +78,34 @@ static void update_k(HMAC_DRBG_CTX *ctx, uint8_t domain, const uint8_t *data1,
   memzero(h, sizeof(h));
 }
 
+// The inner digest and outer digest of K = 0x00 ... 0x00.
+static const uint32_t zero_key_idig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)] =
+    {0xf454dead, 0x9725214f, 0x90daf2a0, 0xdf1228ea,
+     0x64e5750f, 0xa3924181, 0x824a932b, 0xf8e04e32};
+static const uint32_t zero_key_odig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)] =
+    {0xd385480f, 0x7abb6477, 0x37c9c538, 0x5dd82467,
+     0x8e043a72, 0x753434b0, 0xdeb82818, 0x361d45a6};
+
 static void update_v(HMAC_DRBG_CTX *ctx) {
   sha256_Transform(ctx->idig, ctx->v, ctx->v);
   sha256_Transform(ctx->odig, ctx->v, ctx->v);
 }
 
+// Finishes the state update of the last hmac_drbg_generate_deferred call.
+static void update_pending(HMAC_DRBG_CTX *ctx) {
+  if (ctx->update_pending) {
+    update_k(ctx, 0, NULL, 0, NULL, 0);
+    update_v(ctx);
+    ctx->update_pending = 0;
+  }
+}
+
 void hmac_drbg_init(HMAC_DRBG_CTX *ctx, const uint8_t *entropy,
                     size_t entropy_len, const uint8_t *nonce,
                     size_t nonce_len) {
-  uint32_t h[SHA256_BLOCK_LENGTH / sizeof(uint32_t)] = {0};
-
-  // Precompute the inner digest and outer digest of K = 0x00 ... 0x00.
-  memset(h, 0x36, sizeof(h));
-  sha256_Transform(sha256_initial_hash_value, h, ctx->idig);
-  memset(h, 0x5c, sizeof(h));
-  sha256_Transform(sha256_initial_hash_value, h, ctx->odig);
+  memcpy(ctx->idig, zero_key_idig, sizeof(ctx->idig));
+  memcpy(ctx->odig, zero_key_odig, sizeof(ctx->odig));
+  ctx->update_pending = 0;
 
   // Let V = 0x01 ... 0x01.
   memset(ctx->v, 1, SHA256_DIGEST_LENGTH);
@@ -101,12 +114,11 @@ void hmac_drbg_init(HMAC_DRBG_CTX *ctx, const uint8_t *entropy,
   ctx->v[15] = (SHA256_BLOCK_LENGTH + SHA256_DIGEST_LENGTH) * 8;
 
   hmac_drbg_reseed(ctx, entropy, entropy_len, nonce, nonce_len);
-
-  memzero(h, sizeof(h));
 }
 
 void hmac_drbg_reseed(HMAC_DRBG_CTX *ctx, const uint8_t *entropy, size_t len,
                       const uint8_t *addin, size_t addin_len) {
+  update_pending(ctx);
   update_k(ctx, 0, entropy, len, addin, addin_len);
   update_v(ctx);
   if (len == 0) return;
@@ -114,8 +126,15 @@ void hmac_drbg_reseed(HMAC_DRBG_CTX *ctx, const uint8_t *entropy, size_t len,
   update_v(ctx);
 }
 
-void hmac_drbg_generate(HMAC_DRBG_CTX *ctx, uint8_t *buf, size_t len) {
+// Same as hmac_drbg_generate, but the state update that follows the output is
+// only done by the next call using ctx. This saves it when no further output
+// is needed, e.g. if the first RFC 6979 nonce is accepted, but the state
+// keeps the value the output was derived from until then, so ctx has to be
+// wiped after the last use.
+void hmac_drbg_generate_deferred(HMAC_DRBG_CTX *ctx, uint8_t *buf,
+                                 size_t len) {
   size_t i = 0;
+  update_pending(ctx);
   while (i < len) {
     update_v(ctx);
     for (size_t j = 0; j < 8 && i < len; j++) {
@@ -125,6 +144,10 @@ void hmac_drbg_generate(HMAC_DRBG_CTX *ctx, uint8_t *buf, size_t len) {
       }
     }
   }
-  update_k(ctx, 0, NULL, 0, NULL, 0);
-  update_v(ctx);
+  ctx->update_pending = 1;
+}
+
+void hmac_drbg_generate(HMAC_DRBG_CTX *ctx, uint8_t *buf, size_t len) {
+  hmac_drbg_generate_deferred(ctx, buf, len);
+  update_pending(ctx);
 }
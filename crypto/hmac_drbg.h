@@ -32,6 +32,7 @@ typedef struct _HMAC_DRBG_CTX {
   uint32_t odig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)];
   uint32_t idig[SHA256_DIGEST_LENGTH / sizeof(uint32_t)];
   uint32_t v[SHA256_BLOCK_LENGTH / sizeof(uint32_t)];
+  uint32_t update_pending;
 } HMAC_DRBG_CTX;
 
 void hmac_drbg_init(HMAC_DRBG_CTX *ctx, const uint8_t *buf, size_t len,
@@ -39,5 +40,7 @@ void hmac_drbg_init(HMAC_DRBG_CTX *ctx, const uint8_t *buf, size_t len,
 void hmac_drbg_reseed(HMAC_DRBG_CTX *ctx, const uint8_t *buf, size_t len,
                       const uint8_t *addin, size_t addin_len);
 void hmac_drbg_generate(HMAC_DRBG_CTX *ctx, uint8_t *buf, size_t len);
+void hmac_drbg_generate_deferred(HMAC_DRBG_CTX *ctx, uint8_t *buf,
+                                 size_t len);
 
 #endif
@@ -1,8 +1,11 @@
 #ifndef __STDC_WANT_LIB_EXT1__
 #define __STDC_WANT_LIB_EXT1__ 1  // C11's bounds-checking interface.
 #endif
+#include <stdint.h>
 #include <string.h>
 
+#include "memzero.h"
+
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -23,10 +26,9 @@
 #define HAVE_EXPLICIT_BZERO 1
 #endif
 
-// Newlib
-#if defined(__NEWLIB__)
-#define HAVE_EXPLICIT_BZERO 1
-#endif
+// Newlib has explicit_bzero too, but it calls memset, which newlib-nano
+// (-lc_nano of the firmware) compiled for size clears byte by byte, so the
+// word-wise loop below is used instead.
 
 // FreeBSD version 11.0 or later.
 #if defined(__FreeBSD__) && __FreeBSD_version >= 1100037
@@ -43,6 +45,38 @@
 #define HAVE_EXPLICIT_MEMSET 1
 #endif
 
+// Clears len bytes at pnt one 32-bit word at a time, memzero uses it if the
+// platform has no secure clearing function, such as the firmware built with
+// newlib-nano.
+void memzero_words(void *const pnt, const size_t len) {
+  // The volatile stores can be neither removed nor merged by the compiler.
+  volatile unsigned char *pnt_ = (volatile unsigned char *)pnt;
+  size_t i = len;
+
+  while (i > 0 && ((uintptr_t)pnt_ & 3) != 0) {
+    *pnt_++ = 0U;
+    i--;
+  }
+  volatile uint32_t *pnt32 = (volatile uint32_t *)pnt_;
+  while (i >= 16) {
+    pnt32[0] = 0U;
+    pnt32[1] = 0U;
+    pnt32[2] = 0U;
+    pnt32[3] = 0U;
+    pnt32 += 4;
+    i -= 16;
+  }
+  while (i >= 4) {
+    *pnt32++ = 0U;
+    i -= 4;
+  }
+  pnt_ = (volatile unsigned char *)pnt32;
+  while (i > 0) {
+    *pnt_++ = 0U;
+    i--;
+  }
+}
+
 // Adapted from
 // https://github.com/jedisct1/libsodium/blob/1647f0d53ae0e370378a9195477e3df0a792408f/src/libsodium/sodium/utils.c#L102-L130
 
@@ -56,12 +90,7 @@ void memzero(void *const pnt, const size_t len) {
 #elif defined(HAVE_EXPLICIT_MEMSET)
   explicit_memset(pnt, 0, len);
 #else
-  volatile unsigned char *volatile pnt_ = (volatile unsigned char *volatile)pnt;
-  size_t i = (size_t)0U;
-
-  while (i < len) {
-    pnt_[i++] = 0U;
-  }
+  memzero_words(pnt, len);
 #endif
 
   // explicitly mark the memory as overwritten for the Clang MemorySanitizer
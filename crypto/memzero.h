@@ -4,5 +4,6 @@
 #include <stddef.h>
 
 void memzero(void* const pnt, const size_t len);
+void memzero_words(void* const pnt, const size_t len);
 
 #endif
@@ -18,8 +18,24 @@ const ge25519 ALIGN(16) xmr_h = {
     {0x24517f7, 0x05ee936, 0x3acf5d9, 0x14b08aa, 0x3363738, 0x1051745,
      0x360601e, 0x0f3f2c9, 0x1ead2cd, 0x1d3e3df}};
 
+#if !OPTIMIZE_SIZE_MONERO
+// multiples of H in packed {ysubx, xaddy, t2d} form for
+// ge25519_scalarmult_base_niels, generated by tools/mkniels
+static const uint8_t ALIGN(16) xmr_h_niels_multiples[256][96] = {
+#include "xmr_h.table"
+};
+#endif
+
 void ge25519_set_xmr_h(ge25519 *r) { ge25519_copy(r, &xmr_h); }
 
+void xmr_scalarmult_h(ge25519 *r, const bignum256modm a) {
+#if OPTIMIZE_SIZE_MONERO
+  ge25519_scalarmult(r, &xmr_h, a);
+#else
+  ge25519_scalarmult_base_niels(r, xmr_h_niels_multiples, a);
+#endif
+}
+
 void xmr_random_scalar(bignum256modm m) {
   unsigned char buff[32] = {0};
   random_buffer(buff, sizeof(buff));
@@ -36,6 +52,12 @@ void xmr_hasher_update(Hasher *hasher, const void *data, size_t length) {
   hasher_Update(hasher, data, length);
 }
 
+void xmr_hasher_update_varint(Hasher *hasher, uint64_t num) {
+  uint8_t buff[10] = {0};
+  int written = xmr_write_varint(buff, sizeof(buff), num);
+  hasher_Update(hasher, buff, written);
+}
+
 void xmr_hasher_final(Hasher *hasher, uint8_t *hash) {
   hasher_Final(hasher, hash);
 }
@@ -145,6 +167,9 @@ void xmr_get_subaddress_secret_key(bignum256modm r, uint32_t major,
 void xmr_gen_c(ge25519 *r, const bignum256modm a, uint64_t amount) {
   // C = aG + bH
   bignum256modm b = {0};
+  ge25519 aG = {0}, bH = {0};
   set256_modm(b, amount);
-  xmr_add_keys2(r, a, b, &xmr_h);
+  ge25519_scalarmult_base_wrapper(&aG, a);
+  xmr_scalarmult_h(&bH, b);
+  ge25519_add(r, &aG, &bH, 0);
 }
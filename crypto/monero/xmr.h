@@ -20,6 +20,9 @@ typedef struct xmr_ctkey {
 /* sets H point to r */
 void ge25519_set_xmr_h(ge25519 *r);
 
+/* aH, H is the Monero generator */
+void xmr_scalarmult_h(ge25519 *r, const bignum256modm a);
+
 /* random scalar value */
 void xmr_random_scalar(bignum256modm m);
 
@@ -29,6 +32,7 @@ void xmr_fast_hash(uint8_t *hash, const void *data, size_t length);
 /* incremental hashing wrappers */
 void xmr_hasher_init(Hasher *hasher);
 void xmr_hasher_update(Hasher *hasher, const void *data, size_t length);
+void xmr_hasher_update_varint(Hasher *hasher, uint64_t num);
 void xmr_hasher_final(Hasher *hasher, uint8_t *hash);
 void xmr_hasher_copy(Hasher *dst, const Hasher *src);
 
@@ -64,7 +64,8 @@ static inline bool nem_write_checked(nem_transaction_ctx *ctx,
     return false;
   }
 
-  memcpy(&ctx->buffer[ctx->offset], data, length);
+  // the inner transaction of nem_transaction_start_inner overlaps the buffer
+  memmove(&ctx->buffer[ctx->offset], data, length);
   ctx->offset += length;
   return true;
 }
@@ -201,6 +202,21 @@ void nem_transaction_start(nem_transaction_ctx *ctx,
   ctx->size = size;
 }
 
+// Starts the inner transaction of a multisig or a multisig signature
+// transaction in the unused part of the buffer of ctx, which is then created
+// from it, so that the inner transaction needs no buffer of its own.
+void nem_transaction_start_inner(nem_transaction_ctx *inner,
+                                 const nem_transaction_ctx *ctx,
+                                 const ed25519_public_key public_key) {
+  size_t offset = ctx->offset + NEM_MULTISIG_RESERVED_SIZE;
+
+  if (offset > ctx->size) {
+    offset = ctx->size;
+  }
+  nem_transaction_start(inner, public_key, &ctx->buffer[offset],
+                        ctx->size - offset);
+}
+
 size_t nem_transaction_end(nem_transaction_ctx *ctx,
                            const ed25519_secret_key private_key,
                            ed25519_signature signature) {
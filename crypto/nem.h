@@ -52,6 +52,17 @@
 
 #define NEM_SALT_SIZE sizeof(ed25519_public_key)
 
+// size of the common fields of a transaction
+#define NEM_COMMON_SIZE                                                   \
+  (3 * sizeof(uint32_t) + sizeof(uint32_t) + sizeof(ed25519_public_key) + \
+   sizeof(uint64_t) + sizeof(uint32_t))
+// space reserved by nem_transaction_start_inner for the fields which a
+// multisig or a multisig signature transaction writes before the inner
+// transaction or instead of it, the larger of the two
+#define NEM_MULTISIG_RESERVED_SIZE                         \
+  (NEM_COMMON_SIZE + sizeof(uint32_t) + sizeof(uint32_t) + \
+   SHA3_256_DIGEST_LENGTH + sizeof(uint32_t) + NEM_ADDRESS_SIZE)
+
 #define NEM_ENCRYPTED_SIZE(size) \
   (((size) + AES_BLOCK_SIZE) / AES_BLOCK_SIZE * AES_BLOCK_SIZE)
 #define NEM_ENCRYPTED_PAYLOAD_SIZE(size) \
@@ -84,6 +95,9 @@ bool nem_validate_address(const char *address, uint8_t network);
 void nem_transaction_start(nem_transaction_ctx *ctx,
                            const ed25519_public_key public_key, uint8_t *buffer,
                            size_t size);
+void nem_transaction_start_inner(nem_transaction_ctx *inner,
+                                 const nem_transaction_ctx *ctx,
+                                 const ed25519_public_key public_key);
 size_t nem_transaction_end(nem_transaction_ctx *ctx,
                            const ed25519_secret_key private_key,
                            ed25519_signature signature);
@@ -48,7 +48,13 @@ const ecdsa_curve nist256p1 = {
 
     /* b */
     {/*.val =*/{0x07d2604b, 0x1e71e1f1, 0x14ec3d8e, 0x1a0d6198, 0x086bc651,
-                0x1eaabb4c, 0x0f9ecfae, 0x1b154752, 0x005ac635}}
+                0x1eaabb4c, 0x0f9ecfae, 0x1b154752, 0x005ac635}},
+
+    /* montgomery */ 1,
+
+    /* mont_r2 */
+    {/*.val =*/{0x00000c00, 0x00000000, 0x1fff0000, 0x1fdfffff, 0x1fbfffff,
+                0x1fffffff, 0x1fffffff, 0x1ffffffe, 0x00000013}}
 
 #if USE_PRECOMPUTED_CP
     ,
@@ -39,16 +39,153 @@
 #define OPTIMIZE_SIZE_ED25519 OPTIMIZE_SIZE
 #endif
 
+// use the 32-bit Groestl-512 with only two of its four pairs of tables (4 KiB
+// instead of 8 KiB) and with no unrolled rounds, it is about 4 times slower
+#ifndef OPTIMIZE_SIZE_GROESTL
+#define OPTIMIZE_SIZE_GROESTL OPTIMIZE_SIZE
+#endif
+
+// use the generic scalar multiplication instead of a precomputed table of
+// multiples (24 KiB) for the Monero generator H in xmr_scalarmult_h
+#ifndef OPTIMIZE_SIZE_MONERO
+#define OPTIMIZE_SIZE_MONERO OPTIMIZE_SIZE_ED25519
+#endif
+
 // use precomputed Curve Points (some scalar multiples of curve base point G)
 #ifndef USE_PRECOMPUTED_CP
 #define USE_PRECOMPUTED_CP 0
 #endif
 
+// width in bits of the windows of the precomputed Curve Points, the table
+// holds 2^(w-1) points for each of the ceil(256 / w) windows of a scalar
+// the tables shipped in secp256k1.table and nist256p1.table are for the
+// default layout, other layouts have to be generated by tools/mktable
+#ifndef PRECOMPUTED_CP_WINDOW
+#define PRECOMPUTED_CP_WINDOW 4
+#endif
+
+// store the precomputed Curve Points as big-endian bytes (64 bytes per point)
+// instead of bignum256 (72 bytes per point)
+#ifndef USE_PRECOMPUTED_CP_PACKED
+#define USE_PRECOMPUTED_CP_PACKED 0
+#endif
+
+// maximal number of signatures sharing their field inversions in
+// ecdsa_verify_digest_batch
+#ifndef ECDSA_VERIFY_BATCH_SIZE
+#define ECDSA_VERIFY_BATCH_SIZE 4
+#endif
+
+// maximal number of signatures checked by a single multi-scalar
+// multiplication in zkp_bip340_verify_batch
+#ifndef BIP340_VERIFY_BATCH_SIZE
+#define BIP340_VERIFY_BATCH_SIZE 4
+#endif
+
+// maximal number of points sharing their point doublings in
+// point_multiply_multi and ge25519_multi_scalarmult_vartime
+#ifndef POINT_MULTIPLY_MULTI_SIZE
+#define POINT_MULTIPLY_MULTI_SIZE 4
+#endif
+
+// number of points from which point_multiply_multi and
+// ge25519_multi_scalarmult_vartime switch to Pippenger's bucket method
+#ifndef PIPPENGER_MIN_POINTS
+#define PIPPENGER_MIN_POINTS 48
+#endif
+
+// width in bits of the windows of Pippenger's bucket method, which uses
+// 2^w - 1 buckets of points
+#ifndef PIPPENGER_WINDOW
+#define PIPPENGER_WINDOW 5
+#endif
+
+#if PIPPENGER_WINDOW < 1 || PIPPENGER_WINDOW > 5
+#error "PIPPENGER_WINDOW must be between 1 and 5"
+#endif
+
 // use fast inverse method
 #ifndef USE_INVERSE_FAST
 #define USE_INVERSE_FAST 1
 #endif
 
+// use the safegcd inverse method, which has constant control flow and
+// constant memory access flow, takes precedence over USE_INVERSE_FAST
+#ifndef USE_INVERSE_SAFEGCD
+#define USE_INVERSE_SAFEGCD 1
+#endif
+
+// use the UMLAL based bn_multiply_long and bn_multiply_reduce_step on
+// ARMv7-M and ARMv8-M Mainline, ignored on other targets
+// not enabled by any firmware build until it is tested on hardware
+#ifndef USE_BN_ASM_ARM
+#define USE_BN_ASM_ARM 0
+#endif
+
+// use the UMAAL based field arithmetic with 32-bit limbs in
+// curve25519_scalarmult on ARMv7E-M and ARMv8-M Mainline with the DSP
+// extension, ignored on other targets
+// not enabled by any firmware build until it is tested on hardware
+#ifndef USE_CURVE25519_ASM_ARM
+#define USE_CURVE25519_ASM_ARM 0
+#endif
+
+// use the unrolled SHA-1, SHA-256 and SHA-512 transforms of sha2.c, which are
+// faster but about twice as large, same as defining SHA2_UNROLL_TRANSFORM
+#ifndef USE_SHA2_UNROLL
+#define USE_SHA2_UNROLL 0
+#endif
+
+// use the SHA extensions in sha256_Transform on x86-64 when the CPU has them,
+// which is detected at runtime, ignored on other targets
+#ifndef USE_SHA256_NI
+#define USE_SHA256_NI 1
+#endif
+
+// use the carry-less multiplication (PCLMULQDQ) in the GHASH of aesgcm.c on
+// x86-64 when the CPU has it, which is detected at runtime, ignored on other
+// targets
+#ifndef USE_GHASH_CLMUL
+#define USE_GHASH_CLMUL 1
+#endif
+
+// let ECRYPT_encrypt_bytes of ChaCha20 compute four blocks at once in the
+// lanes of SSE2 vectors on x86-64 for inputs of at least 256 bytes, ignored on
+// other targets
+#ifndef USE_CHACHA20_SSE2
+#define USE_CHACHA20_SSE2 1
+#endif
+
+// use the Poly1305 of poly1305-radix32.h, which keeps h and r in 32-bit words
+// and needs 19 instead of 25 32-bit multiplications per block, it is faster on
+// 32-bit targets and slower on 64-bit ones
+#ifndef USE_POLY1305_RADIX32
+#define USE_POLY1305_RADIX32 0
+#endif
+
+// use the bit-interleaved Keccak-f[1600] permutation in sha3.c, which works
+// on 32-bit words and is faster on 32-bit targets, slower on 64-bit ones
+#ifndef USE_KECCAK_INTERLEAVED
+#define USE_KECCAK_INTERLEAVED 0
+#endif
+
+// let sha256_Raw hash inputs of at least SHA256_HW_MIN_LENGTH bytes by
+// sha256_hw_Raw, which a platform with a hash peripheral can provide, below
+// that length the setup of the peripheral costs more than it saves
+#ifndef USE_SHA256_HW
+#define USE_SHA256_HW 0
+#endif
+
+#ifndef SHA256_HW_MIN_LENGTH
+#define SHA256_HW_MIN_LENGTH 512
+#endif
+
+// use the GLV endomorphism of secp256k1 in point_multiply, which halves the
+// number of point doublings
+#ifndef USE_SECP256K1_GLV
+#define USE_SECP256K1_GLV 1
+#endif
+
 // support for printing bignum256 structures via printf
 #ifndef USE_BN_PRINT
 #define USE_BN_PRINT 0
@@ -59,7 +196,8 @@
 #define USE_RFC6979 1
 #endif
 
-// implement BIP32 caching
+// implement BIP32 caching, each entry holds a node of any depth up to
+// BIP32_CACHE_MAXDEPTH, the least recently used entry is replaced
 #ifndef USE_BIP32_CACHE
 #define USE_BIP32_CACHE 1
 #define BIP32_CACHE_SIZE 10
@@ -71,6 +209,13 @@
 #define USE_BIP32_25519_CURVES 1
 #endif
 
+// cache the decompressed ed25519 public keys of ed25519_public_key_expand,
+// the least recently used entry is replaced
+#ifndef USE_ED25519_PUBKEY_CACHE
+#define USE_ED25519_PUBKEY_CACHE 1
+#define ED25519_PUBKEY_CACHE_SIZE 4
+#endif
+
 // implement BIP39 caching
 #ifndef USE_BIP39_CACHE
 #define USE_BIP39_CACHE 1
@@ -48,8 +48,10 @@ void init_rfc6979(const uint8_t *priv_key, const uint8_t *hash,
 }
 
 // generate next number from deterministic random number generator
+// the state update after each number is only done if another one is requested,
+// so the state must be wiped after use
 void generate_rfc6979(uint8_t rnd[32], rfc6979_state *state) {
-  hmac_drbg_generate(state, rnd, 32);
+  hmac_drbg_generate_deferred(state, rnd, 32);
 }
 
 // generate K in a deterministic way, according to RFC6979
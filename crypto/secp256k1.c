@@ -46,7 +46,13 @@ const ecdsa_curve secp256k1 = {
 
     /* a */ 0,
 
-    /* b */ {/*.val =*/{7}}
+    /* b */ {/*.val =*/{7}},
+
+    /* montgomery */ 1,
+
+    /* mont_r2 */
+    {/*.val =*/{0x1a428400, 0x00f44001, 0x00010000, 0x00000000, 0x00000000,
+                0x00000000, 0x00000000, 0x00000000, 0x00000000}}
 
 #if USE_PRECOMPUTED_CP
     ,
@@ -33,6 +33,17 @@
 #include "sha2.h"
 #include "memzero.h"
 #include "byte_order.h"
+#include "options.h"
+
+#if USE_SHA2_UNROLL && !defined(SHA2_UNROLL_TRANSFORM)
+#define SHA2_UNROLL_TRANSFORM
+#endif
+
+#if USE_SHA256_NI && defined(__x86_64__) && defined(__GNUC__)
+#define SHA256_NI
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 /*
  * ASSERT NOTE:
@@ -698,6 +709,69 @@ void sha256_Init_ex(SHA256_CTX *context, const uint32_t state[8], uint64_t bitco
   context->bitcount = bitcount;
 }
 
+#ifdef SHA256_NI
+
+/*
+ * SHA-256 transform by the SHA extensions of x86-64 CPUs, each
+ * _mm_sha256rnds2_epu32 does two rounds on the state split into
+ * ABEF and CDGH halves.
+ */
+__attribute__((target("sha,sse4.1")))
+static void sha256_Transform_ni(const sha2_word32* state_in, const sha2_word32* data, sha2_word32* state_out) {
+	__m128i	state0, state1, abef, cdgh, msg, tmp, w[4];
+	int	i = 0;
+
+	/* Reorder ABCD EFGH into ABEF CDGH */
+	tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state_in[0]), 0xB1);
+	state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state_in[4]), 0x1B);
+	state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+	abef = state0;
+	cdgh = state1;
+
+	for (i = 0; i < 16; i++) {
+		if (i < 4) {
+			/* the words are already in host byte order */
+			w[i] = _mm_loadu_si128((const __m128i*)&data[4 * i]);
+		} else {
+			/* Part of the message block expansion: */
+			tmp = _mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]);
+			tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4));
+			w[i & 3] = _mm_sha256msg2_epu32(tmp, w[(i + 3) & 3]);
+		}
+		msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128((const __m128i*)&K256[4 * i]));
+		state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+		msg = _mm_shuffle_epi32(msg, 0x0E);
+		state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+	}
+
+	state0 = _mm_add_epi32(state0, abef);
+	state1 = _mm_add_epi32(state1, cdgh);
+
+	/* Reorder ABEF CDGH back into ABCD EFGH */
+	tmp = _mm_shuffle_epi32(state0, 0x1B);
+	state1 = _mm_shuffle_epi32(state1, 0xB1);
+	_mm_storeu_si128((__m128i*)&state_out[0], _mm_blend_epi16(tmp, state1, 0xF0));
+	_mm_storeu_si128((__m128i*)&state_out[4], _mm_alignr_epi8(state1, tmp, 8));
+}
+
+/* Returns 1 if the CPU has the SHA extensions and SSE4.1 */
+static int sha256_ni_available(void) {
+	static int available = -1;
+	unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+	if (available < 0) {
+		available = 0;
+		if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1) &&
+		    __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_SHA)) {
+			available = 1;
+		}
+	}
+	return available;
+}
+
+#endif /* SHA256_NI */
+
 #ifdef SHA2_UNROLL_TRANSFORM
 
 /* Unrolled SHA-256 round macros: */
@@ -726,6 +800,13 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	sha2_word32 W256[16] = {0};
 	int		j = 0;
 
+#ifdef SHA256_NI
+	if (sha256_ni_available()) {
+		sha256_Transform_ni(state_in, data, state_out);
+		return;
+	}
+#endif
+
 	/* Initialize registers with the prev. intermediate value */
 	a = state_in[0];
 	b = state_in[1];
@@ -782,6 +863,13 @@ void sha256_Transform(const sha2_word32* state_in, const sha2_word32* data, sha2
 	sha2_word32	T1 = 0, T2 = 0 , W256[16] = {0};
 	int		j = 0;
 
+#ifdef SHA256_NI
+	if (sha256_ni_available()) {
+		sha256_Transform_ni(state_in, data, state_out);
+		return;
+	}
+#endif
+
 	/* Initialize registers with the prev. intermediate value */
 	a = state_in[0];
 	b = state_in[1];
@@ -980,8 +1068,27 @@ char *sha256_End(SHA256_CTX* context, char buffer[SHA256_DIGEST_STRING_LENGTH])
 	return buffer;
 }
 
+#if USE_SHA256_HW
+/*
+ * Hashes the data by a hash peripheral. A platform that has one overrides
+ * this weak definition and returns 0 whenever the peripheral cannot be used,
+ * e.g. before its initialization, then sha256_Raw hashes the data in software.
+ */
+int __attribute__((weak)) sha256_hw_Raw(const sha2_byte* data, size_t len, uint8_t digest[SHA256_DIGEST_LENGTH]) {
+	(void)data;
+	(void)len;
+	(void)digest;
+	return 0;
+}
+#endif
+
 void sha256_Raw(const sha2_byte* data, size_t len, uint8_t digest[SHA256_DIGEST_LENGTH]) {
 	SHA256_CTX	context = {0};
+#if USE_SHA256_HW
+	if (len >= SHA256_HW_MIN_LENGTH && sha256_hw_Raw(data, len, digest)) {
+		return;
+	}
+#endif
 	sha256_Init(&context);
 	sha256_Update(&context, data, len);
 	sha256_Final(&context, digest);
@@ -33,6 +33,7 @@
 /* constants */
 #define NumberOfRounds 24
 
+#if !USE_KECCAK_INTERLEAVED
 /* SHA3 (Keccak) constants for 24 rounds */
 static uint64_t keccak_round_constants[NumberOfRounds] = {
 	I64(0x0000000000000001), I64(0x0000000000008082), I64(0x800000000000808A), I64(0x8000000080008000),
@@ -42,6 +43,7 @@ static uint64_t keccak_round_constants[NumberOfRounds] = {
 	I64(0x8000000000008002), I64(0x8000000000000080), I64(0x000000000000800A), I64(0x800000008000000A),
 	I64(0x8000000080008081), I64(0x8000000000008080), I64(0x0000000080000001), I64(0x8000000080008008)
 };
+#endif
 
 /* Initializing a sha3 context for given number of output bits */
 static void keccak_Init(SHA3_CTX *ctx, unsigned bits)
@@ -94,6 +96,178 @@ void sha3_512_Init(SHA3_CTX *ctx)
 	keccak_Init(ctx, 512);
 }
 
+#if USE_KECCAK_INTERLEAVED
+/*
+ * Bit-interleaved Keccak-f[1600] for 32-bit targets, see "Keccak
+ * implementation overview", section 2.1. The state keeps each lane as two
+ * 32-bit words with its even bits in the low word and its odd bits in the high
+ * word, so that a 64-bit rotation becomes two 32-bit rotations. The lanes are
+ * interleaved when absorbed and deinterleaved when squeezed.
+ */
+#define ROTL32(dword, n) ((dword) << (n) | ((dword) >> ((32 - (n)) & 31)))
+
+/* the round constants of keccak_round_constants, interleaved */
+static const uint32_t keccak_round_constants_interleaved[NumberOfRounds][2] = {
+	{0x00000001, 0x00000000}, {0x00000000, 0x00000089}, {0x00000000, 0x8000008B}, {0x00000000, 0x80008080},
+	{0x00000001, 0x0000008B}, {0x00000001, 0x00008000}, {0x00000001, 0x80008088}, {0x00000001, 0x80000082},
+	{0x00000000, 0x0000000B}, {0x00000000, 0x0000000A}, {0x00000001, 0x00008082}, {0x00000000, 0x00008003},
+	{0x00000001, 0x0000808B}, {0x00000001, 0x8000000B}, {0x00000001, 0x8000008A}, {0x00000001, 0x80000081},
+	{0x00000000, 0x80000081}, {0x00000000, 0x80000008}, {0x00000000, 0x00000083}, {0x00000000, 0x80008003},
+	{0x00000001, 0x80008088}, {0x00000000, 0x80000088}, {0x00000001, 0x00008000}, {0x00000000, 0x80008082}
+};
+
+/* swap the bits of x selected by mask with the bits shift positions above */
+#define SWAP_BITS(x, mask, shift) \
+	do { uint32_t t = ((x) ^ ((x) >> (shift))) & (mask); (x) ^= t ^ (t << (shift)); } while (0)
+
+/* convert a little-endian lane to the interleaved form */
+static uint64_t keccak_interleave(uint64_t lane)
+{
+#if BYTE_ORDER == BIG_ENDIAN
+	REVERSE64(lane, lane);
+#endif
+	uint32_t lo = (uint32_t)lane, hi = (uint32_t)(lane >> 32);
+	/* gather the even bits in the low and the odd bits in the high halves */
+	SWAP_BITS(lo, 0x22222222, 1); SWAP_BITS(hi, 0x22222222, 1);
+	SWAP_BITS(lo, 0x0C0C0C0C, 2); SWAP_BITS(hi, 0x0C0C0C0C, 2);
+	SWAP_BITS(lo, 0x00F000F0, 4); SWAP_BITS(hi, 0x00F000F0, 4);
+	SWAP_BITS(lo, 0x0000FF00, 8); SWAP_BITS(hi, 0x0000FF00, 8);
+	return ((uint64_t)((lo >> 16) | (hi & 0xFFFF0000)) << 32) | ((lo & 0xFFFF) | (hi << 16));
+}
+
+/* convert an interleaved lane back to the little-endian form */
+static uint64_t keccak_deinterleave(uint64_t lane)
+{
+	uint32_t even = (uint32_t)lane, odd = (uint32_t)(lane >> 32);
+	uint32_t lo = (even & 0xFFFF) | (odd << 16), hi = (even >> 16) | (odd & 0xFFFF0000);
+	SWAP_BITS(lo, 0x0000FF00, 8); SWAP_BITS(hi, 0x0000FF00, 8);
+	SWAP_BITS(lo, 0x00F000F0, 4); SWAP_BITS(hi, 0x00F000F0, 4);
+	SWAP_BITS(lo, 0x0C0C0C0C, 2); SWAP_BITS(hi, 0x0C0C0C0C, 2);
+	SWAP_BITS(lo, 0x22222222, 1); SWAP_BITS(hi, 0x22222222, 1);
+	lane = ((uint64_t)hi << 32) | lo;
+#if BYTE_ORDER == BIG_ENDIAN
+	REVERSE64(lane, lane);
+#endif
+	return lane;
+}
+
+/*
+ * Keccak rho() and pi() transformations of lane s into lane d of B, an odd
+ * rotation by n swaps the halves of the lane
+ */
+#define KECCAK_RHO_PI(d, s, n) \
+	do { \
+		if ((n) & 1) { \
+			BE[d] = ROTL32(O[s], ((n) + 1) / 2); \
+			BO[d] = ROTL32(E[s], (n) / 2); \
+		} else { \
+			BE[d] = ROTL32(E[s], (n) / 2); \
+			BO[d] = ROTL32(O[s], (n) / 2); \
+		} \
+	} while (0)
+
+/* Keccak chi() transformation of one half of the lanes of B into A */
+static void keccak_chi32(uint32_t *A, const uint32_t *B)
+{
+	int i = 0;
+	for (i = 0; i < 25; i += 5) {
+		A[0 + i] = B[0 + i] ^ (~B[1 + i] & B[2 + i]);
+		A[1 + i] = B[1 + i] ^ (~B[2 + i] & B[3 + i]);
+		A[2 + i] = B[2 + i] ^ (~B[3 + i] & B[4 + i]);
+		A[3 + i] = B[3 + i] ^ (~B[4 + i] & B[0 + i]);
+		A[4 + i] = B[4 + i] ^ (~B[0 + i] & B[1 + i]);
+	}
+}
+
+static void sha3_permutation(uint64_t *state)
+{
+	/* even and odd halves of the lanes and of their rho() and pi() images */
+	uint32_t E[25] = {0}, O[25] = {0}, BE[25] = {0}, BO[25] = {0};
+	uint32_t CE[5] = {0}, CO[5] = {0}, DE[5] = {0}, DO[5] = {0};
+	int i = 0, x = 0, round = 0;
+
+	for (i = 0; i < 25; i++) {
+		E[i] = (uint32_t)state[i];
+		O[i] = (uint32_t)(state[i] >> 32);
+	}
+	for (round = 0; round < NumberOfRounds; round++)
+	{
+		/* apply Keccak theta() transformation, ROTL64(C, 1) swaps the halves */
+		for (x = 0; x < 5; x++) {
+			CE[x] = E[x] ^ E[x + 5] ^ E[x + 10] ^ E[x + 15] ^ E[x + 20];
+			CO[x] = O[x] ^ O[x + 5] ^ O[x + 10] ^ O[x + 15] ^ O[x + 20];
+		}
+		DE[0] = ROTL32(CO[1], 1) ^ CE[4]; DO[0] = CE[1] ^ CO[4];
+		DE[1] = ROTL32(CO[2], 1) ^ CE[0]; DO[1] = CE[2] ^ CO[0];
+		DE[2] = ROTL32(CO[3], 1) ^ CE[1]; DO[2] = CE[3] ^ CO[1];
+		DE[3] = ROTL32(CO[4], 1) ^ CE[2]; DO[3] = CE[4] ^ CO[2];
+		DE[4] = ROTL32(CO[0], 1) ^ CE[3]; DO[4] = CE[0] ^ CO[3];
+		for (x = 0; x < 5; x++) {
+			for (i = x; i < 25; i += 5) {
+				E[i] ^= DE[x];
+				O[i] ^= DO[x];
+			}
+		}
+
+		BE[0] = E[0];
+		BO[0] = O[0];
+		KECCAK_RHO_PI(10,  1,  1);
+		KECCAK_RHO_PI(20,  2, 62);
+		KECCAK_RHO_PI( 5,  3, 28);
+		KECCAK_RHO_PI(15,  4, 27);
+		KECCAK_RHO_PI(16,  5, 36);
+		KECCAK_RHO_PI( 1,  6, 44);
+		KECCAK_RHO_PI(11,  7,  6);
+		KECCAK_RHO_PI(21,  8, 55);
+		KECCAK_RHO_PI( 6,  9, 20);
+		KECCAK_RHO_PI( 7, 10,  3);
+		KECCAK_RHO_PI(17, 11, 10);
+		KECCAK_RHO_PI( 2, 12, 43);
+		KECCAK_RHO_PI(12, 13, 25);
+		KECCAK_RHO_PI(22, 14, 39);
+		KECCAK_RHO_PI(23, 15, 41);
+		KECCAK_RHO_PI( 8, 16, 45);
+		KECCAK_RHO_PI(18, 17, 15);
+		KECCAK_RHO_PI( 3, 18, 21);
+		KECCAK_RHO_PI(13, 19,  8);
+		KECCAK_RHO_PI(14, 20, 18);
+		KECCAK_RHO_PI(24, 21,  2);
+		KECCAK_RHO_PI( 9, 22, 61);
+		KECCAK_RHO_PI(19, 23, 56);
+		KECCAK_RHO_PI( 4, 24, 14);
+
+		keccak_chi32(E, BE);
+		keccak_chi32(O, BO);
+
+		/* apply iota(state, round) */
+		E[0] ^= keccak_round_constants_interleaved[round][0];
+		O[0] ^= keccak_round_constants_interleaved[round][1];
+	}
+	for (i = 0; i < 25; i++) {
+		state[i] = ((uint64_t)O[i] << 32) | E[i];
+	}
+	memzero(E, sizeof(E));
+	memzero(O, sizeof(O));
+	memzero(BE, sizeof(BE));
+	memzero(BO, sizeof(BO));
+}
+
+/* store the first length bytes of the interleaved state */
+static void sha3_squeeze(unsigned char *to, const uint64_t *hash, size_t length)
+{
+	uint64_t lane = 0;
+	for (; length >= 8; length -= 8, to += 8) {
+		lane = keccak_deinterleave(*hash++);
+		memcpy(to, &lane, 8);
+	}
+	if (length) {
+		lane = keccak_deinterleave(*hash);
+		memcpy(to, &lane, length);
+	}
+}
+
+#define sha3_lane(x) keccak_interleave(x)
+#else
 /* Keccak theta() transformation */
 static void keccak_theta(uint64_t *A)
 {
@@ -218,6 +392,10 @@ static void sha3_permutation(uint64_t *state)
 #endif
 }
 
+#define sha3_lane(x) le2me_64(x)
+#define sha3_squeeze(to, hash, length) me64_to_le_str((to), (hash), (length))
+#endif /* USE_KECCAK_INTERLEAVED */
+
 /**
  * The core transformation. Process the specified block of data.
  *
@@ -228,40 +406,40 @@ static void sha3_permutation(uint64_t *state)
 static void sha3_process_block(uint64_t hash[25], const uint64_t *block, size_t block_size)
 {
 	/* expanded loop */
-	hash[ 0] ^= le2me_64(block[ 0]);
-	hash[ 1] ^= le2me_64(block[ 1]);
-	hash[ 2] ^= le2me_64(block[ 2]);
-	hash[ 3] ^= le2me_64(block[ 3]);
-	hash[ 4] ^= le2me_64(block[ 4]);
-	hash[ 5] ^= le2me_64(block[ 5]);
-	hash[ 6] ^= le2me_64(block[ 6]);
-	hash[ 7] ^= le2me_64(block[ 7]);
-	hash[ 8] ^= le2me_64(block[ 8]);
+	hash[ 0] ^= sha3_lane(block[ 0]);
+	hash[ 1] ^= sha3_lane(block[ 1]);
+	hash[ 2] ^= sha3_lane(block[ 2]);
+	hash[ 3] ^= sha3_lane(block[ 3]);
+	hash[ 4] ^= sha3_lane(block[ 4]);
+	hash[ 5] ^= sha3_lane(block[ 5]);
+	hash[ 6] ^= sha3_lane(block[ 6]);
+	hash[ 7] ^= sha3_lane(block[ 7]);
+	hash[ 8] ^= sha3_lane(block[ 8]);
 	/* if not sha3-512 */
 	if (block_size > 72) {
-		hash[ 9] ^= le2me_64(block[ 9]);
-		hash[10] ^= le2me_64(block[10]);
-		hash[11] ^= le2me_64(block[11]);
-		hash[12] ^= le2me_64(block[12]);
+		hash[ 9] ^= sha3_lane(block[ 9]);
+		hash[10] ^= sha3_lane(block[10]);
+		hash[11] ^= sha3_lane(block[11]);
+		hash[12] ^= sha3_lane(block[12]);
 		/* if not sha3-384 */
 		if (block_size > 104) {
-			hash[13] ^= le2me_64(block[13]);
-			hash[14] ^= le2me_64(block[14]);
-			hash[15] ^= le2me_64(block[15]);
-			hash[16] ^= le2me_64(block[16]);
+			hash[13] ^= sha3_lane(block[13]);
+			hash[14] ^= sha3_lane(block[14]);
+			hash[15] ^= sha3_lane(block[15]);
+			hash[16] ^= sha3_lane(block[16]);
 			/* if not sha3-256 */
 			if (block_size > 136) {
-				hash[17] ^= le2me_64(block[17]);
+				hash[17] ^= sha3_lane(block[17]);
 #ifdef FULL_SHA3_FAMILY_SUPPORT
 				/* if not sha3-224 */
 				if (block_size > 144) {
-					hash[18] ^= le2me_64(block[18]);
-					hash[19] ^= le2me_64(block[19]);
-					hash[20] ^= le2me_64(block[20]);
-					hash[21] ^= le2me_64(block[21]);
-					hash[22] ^= le2me_64(block[22]);
-					hash[23] ^= le2me_64(block[23]);
-					hash[24] ^= le2me_64(block[24]);
+					hash[18] ^= sha3_lane(block[18]);
+					hash[19] ^= sha3_lane(block[19]);
+					hash[20] ^= sha3_lane(block[20]);
+					hash[21] ^= sha3_lane(block[21]);
+					hash[22] ^= sha3_lane(block[22]);
+					hash[23] ^= sha3_lane(block[23]);
+					hash[24] ^= sha3_lane(block[24]);
 				}
 #endif
 			}
@@ -346,7 +524,7 @@ void sha3_Final(SHA3_CTX *ctx, unsigned char* result)
 	}
 
 	assert(block_size > digest_length);
-	if (result) me64_to_le_str(result, ctx->hash, digest_length);
+	if (result) sha3_squeeze(result, ctx->hash, digest_length);
 	memzero(ctx, sizeof(SHA3_CTX));
 }
 
@@ -375,7 +553,7 @@ void keccak_Final(SHA3_CTX *ctx, unsigned char* result)
 	}
 
 	assert(block_size > digest_length);
-	if (result) me64_to_le_str(result, ctx->hash, digest_length);
+	if (result) sha3_squeeze(result, ctx->hash, digest_length);
 	memzero(ctx, sizeof(SHA3_CTX));
 }
 
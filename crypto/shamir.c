@@ -260,76 +260,147 @@ static void gf256_inv(uint32_t r[8], uint32_t x[8]) {
   memzero(z, sizeof(z));
 }
 
+/*
+ * Set all the lanes of `r` to lane `lane` of `x`.
+ */
+static void bitslice_getlane(uint32_t r[8], const uint32_t x[8], size_t lane) {
+  size_t idx = 0;
+  for (idx = 0; idx < 8; idx++) {
+    r[idx] = -((x[idx] >> lane) & 1);
+  }
+}
+
 bool shamir_interpolate(uint8_t *result, uint8_t result_index,
                         const uint8_t *share_indices,
                         const uint8_t **share_values, uint8_t share_count,
                         size_t len) {
-  size_t i = 0, j = 0;
+  return shamir_interpolate_multi(&result, &result_index, 1, share_indices,
+                                  share_values, share_count, len);
+}
+
+bool shamir_interpolate_multi(uint8_t **results, const uint8_t *result_indices,
+                              uint8_t result_count,
+                              const uint8_t *share_indices,
+                              const uint8_t **share_values, uint8_t share_count,
+                              size_t len) {
+  size_t i = 0, j = 0, k = 0, base = 0, count = 0, rbase = 0, rcount = 0;
   uint32_t x[8] = {0};
-  uint32_t xs[share_count][8];
-  memset(xs, 0, sizeof(xs));
-  uint32_t ys[share_count][8];
-  memset(ys, 0, sizeof(ys));
-  uint32_t num[8] = {~0}; /* num is the numerator (=1) */
+  uint32_t xs[8] = {0};
+  uint32_t nums[8] = {0};
+  uint32_t weights[8] = {0};
   uint32_t denom[8] = {0};
   uint32_t tmp[8] = {0};
   uint32_t secret[8] = {0};
+  uint32_t values[32][8];
+  uint8_t bytes[SHAMIR_MAX_LEN] = {0};
+  uint32_t lanes = 0, equal = 0;
   bool ret = true;
 
   if (len > SHAMIR_MAX_LEN) return false;
 
-  /* Collect the x and y values */
-  for (i = 0; i < share_count; i++) {
-    bitslice_setall(xs[i], share_indices[i]);
-    bitslice(ys[i], share_values[i], len);
+  for (k = 0; k < result_count; k++) {
+    memset(results[k], 0, len);
   }
-  bitslice_setall(x, result_index);
 
-  for (i = 0; i < share_count; i++) {
-    memcpy(tmp, x, sizeof(uint32_t[8]));
-    gf256_add(tmp, xs[i]);
-    gf256_mul(num, num, tmp);
-  }
+  /* The shares are processed in blocks of up to 32, lane i of xs, weights,
+   * denom and values belongs to share base + i. The results are the sums of
+   * the contributions of all blocks. */
+  for (base = 0; base < share_count; base += 32) {
+    count = share_count - base < 32 ? share_count - base : 32;
+    lanes = count < 32 ? ((uint32_t)1 << count) - 1 : ~(uint32_t)0;
 
-  /* Use Lagrange basis polynomials to calculate the secret coefficient */
-  for (i = 0; i < share_count; i++) {
-    /* The code below assumes that none of the share_indices are equal to
-     * result_index. We need to treat that as a special case. */
-    if (share_indices[i] != result_index) {
-      memcpy(denom, x, sizeof(denom));
-      gf256_add(denom, xs[i]);
-    } else {
-      bitslice_setall(denom, 1);
-      gf256_add(secret, ys[i]);
-    }
+    /* The barycentric weights 1 / prod_{j != i} (x_i - x_j) of the shares do
+     * not depend on the x coordinate of the result, so they are computed and
+     * inverted only once for all results. */
+    bitslice(xs, &share_indices[base], count);
+    memset(weights, 0, sizeof(weights));
+    weights[0] = ~(uint32_t)0;
     for (j = 0; j < share_count; j++) {
-      if (i == j) continue;
-      memcpy(tmp, xs[i], sizeof(uint32_t[8]));
-      gf256_add(tmp, xs[j]);
-      gf256_mul(denom, denom, tmp);
+      bitslice_setall(tmp, share_indices[j]);
+      gf256_add(tmp, xs);
+      if (j >= base && j < base + count) {
+        /* Replace the factor x_j - x_j by 1. */
+        for (i = 1; i < 8; i++) tmp[i] &= ~((uint32_t)1 << (j - base));
+        tmp[0] |= (uint32_t)1 << (j - base);
+      }
+      gf256_mul(weights, weights, tmp);
     }
-    if ((denom[0] | denom[1] | denom[2] | denom[3] | denom[4] | denom[5] |
-         denom[6] | denom[7]) == 0) {
+    if (((weights[0] | weights[1] | weights[2] | weights[3] | weights[4] |
+          weights[5] | weights[6] | weights[7]) &
+         lanes) != lanes) {
       /* The share_indices are not unique. */
       ret = false;
       break;
     }
-    gf256_inv(tmp, denom);      /* inverted denominator */
-    gf256_mul(tmp, tmp, num);   /* basis polynomial */
-    gf256_mul(tmp, tmp, ys[i]); /* scaled coefficient */
-    gf256_add(secret, tmp);
+    gf256_inv(tmp, weights);
+    memcpy(weights, tmp, sizeof(weights));
+
+    for (i = 0; i < count; i++) {
+      bitslice(values[i], share_values[base + i], len);
+    }
+
+    /* The numerators prod_j (x - x_j) of the Lagrange basis polynomials of up
+     * to 32 results are computed at once, lane k of nums belongs to result
+     * rbase + k. */
+    for (rbase = 0; rbase < result_count; rbase += 32) {
+      rcount = result_count - rbase < 32 ? result_count - rbase : 32;
+
+      bitslice(x, &result_indices[rbase], rcount);
+      memset(nums, 0, sizeof(nums));
+      nums[0] = ~(uint32_t)0;
+      for (j = 0; j < share_count; j++) {
+        bitslice_setall(tmp, share_indices[j]);
+        gf256_add(tmp, x);
+        gf256_mul(nums, nums, tmp);
+      }
+
+      for (k = 0; k < rcount; k++) {
+        bitslice_setall(x, result_indices[rbase + k]);
+        memcpy(denom, x, sizeof(denom));
+        gf256_add(denom, xs);
+
+        /* The code below needs a nonzero factor x - x_i. If a share index is
+         * equal to the result index, then num is zero and the basis
+         * polynomial of the share must be 1, so we use 1 instead. */
+        equal = ~(denom[0] | denom[1] | denom[2] | denom[3] | denom[4] |
+                  denom[5] | denom[6] | denom[7]);
+        denom[0] |= equal;
+
+        gf256_inv(tmp, denom);
+        gf256_mul(tmp, tmp, weights);
+        bitslice_getlane(denom, nums, k);
+        gf256_mul(denom, denom, tmp); /* basis polynomials */
+        denom[0] |= equal;
+
+        memset(secret, 0, sizeof(secret));
+        for (i = 0; i < count; i++) {
+          bitslice_getlane(tmp, denom, i);
+          gf256_mul(tmp, tmp, values[i]); /* scaled coefficient */
+          gf256_add(secret, tmp);
+        }
+        unbitslice(bytes, secret, len);
+        for (i = 0; i < len; i++) {
+          results[rbase + k][i] ^= bytes[i];
+        }
+      }
+    }
   }
 
-  if (ret == true) {
-    unbitslice(result, secret, len);
+  if (ret != true) {
+    for (k = 0; k < result_count; k++) {
+      memzero(results[k], len);
+    }
   }
 
   memzero(x, sizeof(x));
   memzero(xs, sizeof(xs));
-  memzero(ys, sizeof(ys));
-  memzero(num, sizeof(num));
+  memzero(nums, sizeof(nums));
+  memzero(weights, sizeof(weights));
   memzero(denom, sizeof(denom));
   memzero(tmp, sizeof(tmp));
   memzero(secret, sizeof(secret));
+  memzero(values, (share_count < 32 ? share_count : 32) * sizeof(values[0]));
+  memzero(bytes, sizeof(bytes));
+  memzero(&equal, sizeof(equal));
   return ret;
 }
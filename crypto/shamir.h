@@ -67,4 +67,22 @@ bool shamir_interpolate(uint8_t *result, uint8_t result_index,
                         const uint8_t **share_values, uint8_t share_count,
                         size_t len);
 
+/*
+ * Computes f(x) of shamir_interpolate for each of the x coordinates
+ * result_indices[0], ... , result_indices[result_count - 1] and writes it to
+ * results[0], ... , results[result_count - 1]. The parts of the computation
+ * which do not depend on x, the Lagrange weights of the shares and the
+ * bitsliced share values, are done only once, so this is faster than calling
+ * shamir_interpolate for each x. Returns true on success, otherwise false and
+ * the results are zeroed.
+ *
+ * This function treats `result_count` as a public value in addition to
+ * `share_count`.
+ */
+bool shamir_interpolate_multi(uint8_t **results, const uint8_t *result_indices,
+                              uint8_t result_count,
+                              const uint8_t *share_indices,
+                              const uint8_t **share_values, uint8_t share_count,
+                              size_t len);
+
 #endif /* __SHAMIR_H__ */
@@ -149,3 +149,23 @@ uint16_t slip39_word_completion_mask(uint16_t prefix) {
 
   return bitmap;
 }
+
+/**
+ * Updates the state `chk` of the RS1024 checksum of SLIP-39 with the 10-bit
+ * value `value` and returns the new state. The state of an empty sequence is 1,
+ * a mnemonic has a valid checksum if the state after its customization string
+ * and all its words is 1.
+ */
+uint32_t slip39_rs1024_polymod_update(uint32_t chk, uint16_t value) {
+  static const uint32_t gen[10] = {
+      0x00e0e040, 0x01c1c080, 0x03838100, 0x07070200, 0x0e0e0009,
+      0x1c0c2412, 0x38086c24, 0x3090fc48, 0x21b1f890, 0x03f3f120,
+  };
+
+  uint32_t b = chk >> 20;
+  chk = ((chk & 0xfffff) << 10) ^ value;
+  for (int i = 0; i < 10; i++) {
+    chk ^= gen[i] & -((b >> i) & 1);
+  }
+  return chk;
+}
@@ -38,6 +38,8 @@ uint16_t slip39_word_completion_mask(uint16_t prefix);
 
 const char* button_sequence_to_word(uint16_t prefix);
 
+uint32_t slip39_rs1024_polymod_update(uint32_t chk, uint16_t value);
+
 extern const char* const SLIP39_WORDLIST[SLIP39_WORD_COUNT];
 
 #endif
@@ -23,6 +23,7 @@ lib = ctypes.cdll.LoadLibrary(os.path.join(dir, "libtrezor-crypto.so"))
 
 limbs_number = 9
 bits_per_limb = 29
+montgomery_bits = limbs_number * bits_per_limb
 
 secp256k1_prime = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F
 p256_prime = 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
@@ -554,6 +555,73 @@ def assert_bn_divide_base(x_old, prime):
     assert x_new * 2**bits_per_limb % prime == x_old % prime
 
 
+def assert_bn_square_long(x):
+    bn_x = int_to_bignum256(x)
+    bn_res = bignum512()
+    lib.bn_square_long(bn_x, bn_res)
+    res = bignum512_to_int(bn_res)
+
+    assert bignum_is_normalised(bn_res)
+    assert res == x * x
+
+
+def assert_bn_mont_reduce(x_old, prime):
+    bn_x = int_to_bignum512(x_old)
+    bn_prime = int_to_bignum256(prime)
+    lib.bn_mont_reduce(bn_x, bn_prime)
+    x_new = bignum256_to_int(bn_x)
+
+    assert bignum_is_normalised(bn_x)
+    assert number_is_partly_reduced(x_new, prime)
+    assert x_new * 2**montgomery_bits % prime == x_old % prime
+
+
+def assert_bn_mont_mul(k, x_old, prime):
+    bn_k = int_to_bignum256(k)
+    bn_x = int_to_bignum256(x_old)
+    bn_prime = int_to_bignum256(prime)
+    lib.bn_mont_mul(bn_k, bn_x, bn_prime)
+    x_new = bignum256_to_int(bn_x)
+
+    assert bignum_is_normalised(bn_x)
+    assert number_is_partly_reduced(x_new, prime)
+    assert x_new * 2**montgomery_bits % prime == (k * x_old) % prime
+
+
+def assert_bn_mont_sqr(x_old, prime):
+    bn_x = int_to_bignum256(x_old)
+    bn_prime = int_to_bignum256(prime)
+    lib.bn_mont_sqr(bn_x, bn_prime)
+    x_new = bignum256_to_int(bn_x)
+
+    assert bignum_is_normalised(bn_x)
+    assert number_is_partly_reduced(x_new, prime)
+    assert x_new * 2**montgomery_bits % prime == (x_old * x_old) % prime
+
+
+def assert_bn_to_mont(x_old, prime):
+    bn_x = int_to_bignum256(x_old)
+    bn_r2 = int_to_bignum256(2 ** (2 * montgomery_bits) % prime)
+    bn_prime = int_to_bignum256(prime)
+    lib.bn_to_mont(bn_x, bn_r2, bn_prime)
+    x_new = bignum256_to_int(bn_x)
+
+    assert bignum_is_normalised(bn_x)
+    assert number_is_partly_reduced(x_new, prime)
+    assert x_new % prime == x_old * 2**montgomery_bits % prime
+
+
+def assert_bn_from_mont(x_old, prime):
+    bn_x = int_to_bignum256(x_old)
+    bn_prime = int_to_bignum256(prime)
+    lib.bn_from_mont(bn_x, bn_prime)
+    x_new = bignum256_to_int(bn_x)
+
+    assert bignum_is_normalised(bn_x)
+    assert number_is_fully_reduced(x_new, prime)
+    assert x_new * 2**montgomery_bits % prime == x_old % prime
+
+
 def assert_bn_inverse(x_old, prime):
     bn_x = int_to_bignum256(x_old)
     bn_prime = int_to_bignum256(prime)
@@ -1005,11 +1073,43 @@ def test_bn_divide_base(r, prime):
     assert_bn_divide_base(r.rand_int_256(), prime)
 
 
+def test_bn_square_long(r):
+    assert_bn_square_long(r.rand_int_normalized())
+
+
+def test_bn_mont_reduce(r, prime):
+    assert_bn_mont_reduce(r.randrange(2**montgomery_bits * prime), prime)
+
+
+def test_bn_mont_mul(r, prime):
+    k = r.rand_int_reduced(prime)
+    x = r.rand_int_reduced(prime)
+    assert_bn_mont_mul(k, x, prime)
+
+
+def test_bn_mont_sqr(r, prime):
+    assert_bn_mont_sqr(r.rand_int_reduced(prime), prime)
+
+
+def test_bn_to_mont(r, prime):
+    assert_bn_to_mont(r.rand_int_normalized(), prime)
+
+
+def test_bn_from_mont(r, prime):
+    assert_bn_from_mont(r.rand_int_normalized(), prime)
+
+
 def test_bn_inverse_1(prime):
     assert_bn_inverse(0, prime)
     assert_bn_inverse(1, prime)
 
 
+def test_bn_inverse_3(prime):
+    assert_bn_inverse(prime - 1, prime)
+    assert_bn_inverse(prime + 1, prime)
+    assert_bn_inverse(2 * prime - 1, prime)
+
+
 def test_bn_inverse_2(r, prime):
     from math import gcd
 
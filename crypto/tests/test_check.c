@@ -53,6 +53,7 @@
 #include "blake2s.h"
 #include "buffer.h"
 #include "cardano.h"
+#include "chacha20poly1305/poly1305-donna.h"
 #include "chacha_drbg.h"
 #include "curves.h"
 #include "der.h"
@@ -1211,6 +1212,54 @@ START_TEST(test_base58) {
 }
 END_TEST
 
+START_TEST(test_b58enc_b58tobin) {
+  static const struct {
+    const char *raw;
+    const char *str;
+  } vectors[] = {
+      {"", ""},
+      {"00", "1"},
+      {"0000", "11"},
+      {"000001", "112"},
+      {"ff", "5Q"},
+      {"0000ff", "115Q"},
+      {"00000000000000000000", "1111111111"},
+      {"ffffffffffffffffffffffffffffffffffffffff",
+       "4ZrjxJnU1LA5xSyrWMNuXTvSYKwt"},
+  };
+  uint8_t raw[32];
+  char str[64];
+  size_t len;
+
+  for (size_t i = 0; i < sizeof(vectors) / sizeof(*vectors); i++) {
+    size_t rawlen = strlen(vectors[i].raw) / 2;
+    size_t strlength = strlen(vectors[i].str);
+
+    len = sizeof(str);
+    ck_assert(b58enc(str, &len, fromhex(vectors[i].raw), rawlen));
+    ck_assert_uint_eq(len, strlength + 1);
+    ck_assert_str_eq(str, vectors[i].str);
+
+    // a buffer too short for the string and its terminator
+    len = strlength;
+    ck_assert(!b58enc(str, &len, fromhex(vectors[i].raw), rawlen));
+    ck_assert_uint_eq(len, strlength + 1);
+
+    if (rawlen > 0) {
+      len = rawlen;
+      ck_assert(b58tobin(raw, &len, vectors[i].str));
+      ck_assert_uint_eq(len, rawlen);
+      ck_assert_mem_eq(raw, fromhex(vectors[i].raw), rawlen);
+    }
+  }
+
+  len = sizeof(raw);
+  ck_assert(!b58tobin(raw, &len, "5Q0"));
+  len = 1;
+  ck_assert(!b58tobin(raw, &len, "LUw"));
+}
+END_TEST
+
 START_TEST(test_bignum_divmod) {
   uint32_t r;
   int i;
@@ -2127,6 +2176,93 @@ START_TEST(test_bip32_cache_2) {
 }
 END_TEST
 
+START_TEST(test_bip32_cache_3) {
+  static const char *seeds[] = {
+      "301133282ad079cbeb59bc446ad39d333928f74c46997d3609cd3e2801ca69d62788"
+      "f9f174429946ff4e9be89f67c22fae28cb296a9b37734f75e73d1477af19",
+      "000000002ad079cbeb59bc446ad39d333928f74c46997d3609cd3e2801ca69d62788"
+      "f9f174429946ff4e9be89f67c22fae28cb296a9b37734f75e73d1477af19",
+  };
+  static const uint32_t paths[][5] = {
+      {0x8000002c, 0x80000000, 0x80000000, 0, 3},
+      {0x80000054, 0x80000000, 0x80000000, 1, 5},
+      {0x80000031, 0x80000000, 0x80000001, 0, 0},
+      {0x80000054, 0x80000000, 0x80000000, 0, 7},
+  };
+  HDNode root, node1, node2;
+  uint32_t fingerprint1 = 0, fingerprint2 = 0;
+  int r = 0;
+
+  // interleave roots and paths sharing prefixes of different lengths
+  for (size_t round = 0; round < 3; round++) {
+    for (size_t j = 0; j < sizeof(paths) / sizeof(*paths); j++) {
+      for (size_t k = 0; k < sizeof(seeds) / sizeof(*seeds); k++) {
+        hdnode_from_seed(fromhex(seeds[k]), 64, SECP256K1_NAME, &root);
+        memcpy(&node1, &root, sizeof(HDNode));
+        memcpy(&node2, &root, sizeof(HDNode));
+        for (size_t i = 0; i < 5; i++) {
+          if (i == 4) {
+            fingerprint1 = hdnode_fingerprint(&node1);
+          }
+          r = hdnode_private_ckd(&node1, paths[j][i]);
+          ck_assert_int_eq(r, 1);
+        }
+        r = hdnode_private_ckd_cached(&node2, paths[j], 4 + round % 2,
+                                      &fingerprint2);
+        ck_assert_int_eq(r, 1);
+        if (round % 2 == 0) {
+          // the cached parent is the node at depth 3
+          hdnode_private_ckd(&node2, paths[j][4]);
+        } else {
+          ck_assert_uint_eq(fingerprint1, fingerprint2);
+        }
+        ck_assert_mem_eq(&node1, &node2, sizeof(HDNode));
+      }
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_bip32_public_ckd_range) {
+  static const char *curves[] = {SECP256K1_NAME, NIST256P1_NAME};
+  HDNode parent, node, children[21];
+  int r;
+
+  for (size_t c = 0; c < sizeof(curves) / sizeof(*curves); c++) {
+    hdnode_from_seed(
+        fromhex(
+            "301133282ad079cbeb59bc446ad39d333928f74c46997d3609cd3e2801ca69d6"
+            "2788f9f174429946ff4e9be89f67c22fae28cb296a9b37734f75e73d1477af19"),
+        64, curves[c], &parent);
+    hdnode_private_ckd_prime(&parent, 44);
+    hdnode_fill_public_key(&parent);
+    memzero(parent.private_key, 32);
+
+    // ranges not aligned to the batches of the implementation
+    r = hdnode_public_ckd_range(&parent, 5, 21, children);
+    ck_assert_int_eq(r, 1);
+    for (size_t k = 0; k < 21; k++) {
+      memcpy(&node, &parent, sizeof(HDNode));
+      r = hdnode_public_ckd(&node, 5 + k);
+      ck_assert_int_eq(r, 1);
+      ck_assert_mem_eq(&node, &children[k], sizeof(HDNode));
+    }
+
+    r = hdnode_public_ckd_range(&parent, 0x7ffffffe, 2, children);
+    ck_assert_int_eq(r, 1);
+    memcpy(&node, &parent, sizeof(HDNode));
+    hdnode_public_ckd(&node, 0x7fffffff);
+    ck_assert_mem_eq(&node, &children[1], sizeof(HDNode));
+
+    // hardened children
+    r = hdnode_public_ckd_range(&parent, 0x7fffffff, 2, children);
+    ck_assert_int_eq(r, 0);
+    r = hdnode_public_ckd_range(&parent, 0x80000000, 1, children);
+    ck_assert_int_eq(r, 0);
+  }
+}
+END_TEST
+
 START_TEST(test_bip32_nist_seed) {
   HDNode node;
 
@@ -4075,6 +4211,69 @@ START_TEST(test_zkp_ecdsa_verify_digest) {
 }
 END_TEST
 
+static void test_ecdsa_verify_digest_batch_curve(const ecdsa_curve *curve) {
+  // more than ECDSA_VERIFY_BATCH_SIZE signatures to span several chunks
+  enum { COUNT = 2 * ECDSA_VERIFY_BATCH_SIZE + 1 };
+  uint8_t priv_keys[COUNT][32];
+  uint8_t pub_keys[COUNT][33];
+  uint8_t sigs[COUNT][64];
+  uint8_t digests[COUNT][32];
+  const uint8_t *pub_key_ptrs[COUNT], *sig_ptrs[COUNT], *digest_ptrs[COUNT];
+  size_t bad_index = 0;
+
+  for (int i = 0; i < COUNT; i++) {
+    sha256_Raw((const uint8_t *)&i, sizeof(i), priv_keys[i]);
+    sha256_Raw(priv_keys[i], sizeof(priv_keys[i]), digests[i]);
+    ck_assert_int_eq(
+        tc_ecdsa_get_public_key33(curve, priv_keys[i], pub_keys[i]), 0);
+    ck_assert_int_eq(tc_ecdsa_sign_digest(curve, priv_keys[i], digests[i],
+                                          sigs[i], NULL, NULL),
+                     0);
+    pub_key_ptrs[i] = pub_keys[i];
+    sig_ptrs[i] = sigs[i];
+    digest_ptrs[i] = digests[i];
+  }
+
+  ck_assert_int_eq(tc_ecdsa_verify_digest_batch(curve, 0, pub_key_ptrs,
+                                                sig_ptrs, digest_ptrs, NULL),
+                   0);
+  ck_assert_int_eq(tc_ecdsa_verify_digest_batch(curve, COUNT, pub_key_ptrs,
+                                                sig_ptrs, digest_ptrs, NULL),
+                   0);
+
+  // a signature that doesn't match is located
+  sig_ptrs[COUNT - 2] = sigs[0];
+  ck_assert_int_eq(tc_ecdsa_verify_digest_batch(curve, COUNT, pub_key_ptrs,
+                                                sig_ptrs, digest_ptrs,
+                                                &bad_index),
+                   5);
+  ck_assert_int_eq(bad_index, COUNT - 2);
+  ck_assert_int_eq(tc_ecdsa_verify_digest(curve, pub_key_ptrs[COUNT - 2],
+                                          sig_ptrs[COUNT - 2],
+                                          digest_ptrs[COUNT - 2]),
+                   5);
+
+  // the first invalid signature is reported even if a later one is malformed
+  pub_key_ptrs[COUNT - 1] = sigs[0];
+  ck_assert_int_eq(tc_ecdsa_verify_digest_batch(curve, COUNT, pub_key_ptrs,
+                                                sig_ptrs, digest_ptrs,
+                                                &bad_index),
+                   5);
+  ck_assert_int_eq(bad_index, COUNT - 2);
+  sig_ptrs[COUNT - 2] = sigs[COUNT - 2];
+  ck_assert_int_eq(tc_ecdsa_verify_digest_batch(curve, COUNT, pub_key_ptrs,
+                                                sig_ptrs, digest_ptrs,
+                                                &bad_index),
+                   1);
+  ck_assert_int_eq(bad_index, COUNT - 1);
+}
+
+START_TEST(test_tc_ecdsa_verify_digest_batch) {
+  test_ecdsa_verify_digest_batch_curve(&secp256k1);
+  test_ecdsa_verify_digest_batch_curve(&nist256p1);
+}
+END_TEST
+
 #define test_deterministic(KEY, MSG, K)           \
   do {                                            \
     sha256_Raw((uint8_t *)MSG, strlen(MSG), buf); \
@@ -4216,6 +4415,18 @@ START_TEST(test_aes) {
     cipherp += 2;
   }
 
+  // ECB with several blocks at once
+  uint8_t mbuf[4 * 16] = {0}, mout[4 * 16] = {0};
+  for (int i = 0; i < 4; i++) {
+    memcpy(mbuf + 16 * i, fromhex(ecb_vector[2 * i]), 16);
+  }
+  aes_ecb_encrypt(mbuf, mout, sizeof(mbuf), &ctxe);
+  for (int i = 0; i < 4; i++) {
+    ck_assert_mem_eq(mout + 16 * i, fromhex(ecb_vector[2 * i + 1]), 16);
+  }
+  aes_ecb_decrypt(mout, mout, sizeof(mout), &ctxd);
+  ck_assert_mem_eq(mout, mbuf, sizeof(mbuf));
+
   // CBC
   static const char *cbc_vector[] = {
       // iv                               plain cipher
@@ -4847,6 +5058,81 @@ START_TEST(test_aesccm) {
                           ciphertext_len, vectors[i].mac_len, plaintext);
     ck_assert_int_eq(ret, EXIT_SUCCESS);
     ck_assert_mem_eq(plaintext, fromhex(vectors[i].plaintext), plaintext_len);
+
+    // Test streaming encryption in place, in chunks of 1, 2, 3, ... bytes.
+    aes_ccm_ctx ccm_ctx;
+    memcpy(ciphertext, fromhex(vectors[i].plaintext), plaintext_len);
+    ret = aes_ccm_init(&ccm_ctx, &ctx, nonce, nonce_len, aad, aad_len,
+                       plaintext_len, vectors[i].mac_len);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    for (size_t pos = 0, len = 1; pos < plaintext_len; pos += len, len++) {
+      if (len > plaintext_len - pos) {
+        len = plaintext_len - pos;
+      }
+      ret = aes_ccm_encrypt_update(&ccm_ctx, ciphertext + pos, len,
+                                   ciphertext + pos);
+      ck_assert_int_eq(ret, EXIT_SUCCESS);
+    }
+    ret = aes_ccm_encrypt_final(&ccm_ctx, ciphertext + plaintext_len);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    ck_assert_mem_eq(ciphertext, fromhex(vectors[i].ciphertext),
+                     ciphertext_len);
+
+    // Test streaming decryption, in chunks of 16 and 1 bytes.
+    ret = aes_ccm_init(&ccm_ctx, &ctx, nonce, nonce_len, aad, aad_len,
+                       plaintext_len, vectors[i].mac_len);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    for (size_t pos = 0, len = 16; pos < plaintext_len; pos += len) {
+      len = (len == 16 ? 1 : 16);
+      if (len > plaintext_len - pos) {
+        len = plaintext_len - pos;
+      }
+      ret = aes_ccm_decrypt_update(&ccm_ctx, ciphertext + pos, len,
+                                   plaintext + pos);
+      ck_assert_int_eq(ret, EXIT_SUCCESS);
+    }
+    ret = aes_ccm_decrypt_final(&ccm_ctx, ciphertext + plaintext_len);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    ck_assert_mem_eq(plaintext, fromhex(vectors[i].plaintext), plaintext_len);
+
+    // Test that a modified MAC is rejected and that the message length is
+    // enforced.
+    ciphertext[ciphertext_len - 1] ^= 1;
+    ret = aes_ccm_init(&ccm_ctx, &ctx, nonce, nonce_len, aad, aad_len,
+                       plaintext_len, vectors[i].mac_len);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    ret = aes_ccm_decrypt_update(&ccm_ctx, ciphertext, plaintext_len,
+                                 plaintext);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    ret = aes_ccm_decrypt_final(&ccm_ctx, ciphertext + plaintext_len);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
+    ret = aes_ccm_init(&ccm_ctx, &ctx, nonce, nonce_len, aad, aad_len,
+                       plaintext_len, vectors[i].mac_len);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    ret = aes_ccm_encrypt_update(&ccm_ctx, plaintext, plaintext_len + 1,
+                                 ciphertext);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
+
+    // Test that a context fails closed after an error, the MAC check must not
+    // pass for any tag.
+    ciphertext[ciphertext_len - 1] ^= 1;
+    ret = aes_ccm_init(&ccm_ctx, &ctx, nonce, nonce_len, aad, aad_len,
+                       plaintext_len, vectors[i].mac_len);
+    ck_assert_int_eq(ret, EXIT_SUCCESS);
+    ret = aes_ccm_decrypt_update(&ccm_ctx, ciphertext, plaintext_len + 1,
+                                 plaintext);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
+    ret = aes_ccm_decrypt_update(&ccm_ctx, ciphertext, 0, plaintext);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
+    ret = aes_ccm_decrypt_final(&ccm_ctx, ciphertext + plaintext_len);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
+    ret = aes_ccm_encrypt_final(&ccm_ctx, ciphertext + plaintext_len);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
+    ret = aes_ccm_init(&ccm_ctx, &ctx, nonce, 1, aad, aad_len, plaintext_len,
+                       vectors[i].mac_len);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
+    ret = aes_ccm_decrypt_final(&ccm_ctx, ciphertext + plaintext_len);
+    ck_assert_int_eq(ret, EXIT_FAILURE);
   }
 }
 END_TEST
@@ -6158,6 +6444,77 @@ START_TEST(test_chacha_drbg) {
     ck_assert_mem_eq(result, fromhex(expected), i);
     ck_assert_mem_eq(result + i, null_bytes, sizeof(result) - i);
   }
+
+  // the buffered output is the output of chacha_drbg_generate in pieces of
+  // CHACHA_DRBG_BUFFER_LENGTH bytes
+  CHACHA_DRBG_CTX buffered_ctx;
+  uint8_t expected_buffer[2 * CHACHA_DRBG_BUFFER_LENGTH];
+  uint8_t buffer[2 * CHACHA_DRBG_BUFFER_LENGTH];
+  chacha_drbg_init(&ctx, fromhex(entropy), strlen(entropy) / 2, nonce_bytes,
+                   strlen(nonce) / 2);
+  chacha_drbg_init(&buffered_ctx, fromhex(entropy), strlen(entropy) / 2,
+                   nonce_bytes, strlen(nonce) / 2);
+  chacha_drbg_generate(&ctx, expected_buffer, CHACHA_DRBG_BUFFER_LENGTH);
+  chacha_drbg_generate(&ctx, expected_buffer + CHACHA_DRBG_BUFFER_LENGTH,
+                       CHACHA_DRBG_BUFFER_LENGTH);
+  for (size_t i = 0, length = 1; i < sizeof(buffer); i += length, length++) {
+    if (length > sizeof(buffer) - i) {
+      length = sizeof(buffer) - i;
+    }
+    chacha_drbg_generate_buffered(&buffered_ctx, buffer + i, length);
+  }
+  ck_assert_mem_eq(buffer, expected_buffer, sizeof(buffer));
+
+  // reseeding discards the buffered output
+  chacha_drbg_generate(&ctx, expected_buffer, CHACHA_DRBG_BUFFER_LENGTH);
+  chacha_drbg_generate_buffered(&buffered_ctx, buffer, 1);
+  ck_assert_mem_eq(buffer, expected_buffer, 1);
+  chacha_drbg_reseed(&ctx, fromhex(reseed), strlen(reseed) / 2, NULL, 0);
+  chacha_drbg_reseed(&buffered_ctx, fromhex(reseed), strlen(reseed) / 2, NULL,
+                     0);
+  chacha_drbg_generate(&ctx, expected_buffer, CHACHA_DRBG_BUFFER_LENGTH);
+  chacha_drbg_generate_buffered(&buffered_ctx, buffer, 32);
+  ck_assert_mem_eq(buffer, expected_buffer, 32);
+}
+END_TEST
+
+START_TEST(test_poly1305) {
+  static const struct {
+    const char *key;
+    const char *msg;
+    const char *tag;
+  } tests[] = {
+      // RFC 8439, section 2.5.2
+      {"85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b",
+       "43727970746f6772617068696320466f72756d2052657365617263682047726f7570",
+       "a8061dc1305136c6c22b8baf0c0127a9"},
+      // RFC 8439, appendix A.3, test vectors #5 to #9
+      {"0200000000000000000000000000000000000000000000000000000000000000",
+       "ffffffffffffffffffffffffffffffff", "03000000000000000000000000000000"},
+      {"02000000000000000000000000000000ffffffffffffffffffffffffffffffff",
+       "02000000000000000000000000000000", "03000000000000000000000000000000"},
+      {"0100000000000000000000000000000000000000000000000000000000000000",
+       "fffffffffffffffffffffffffffffffff0ffffffffffffffffffffffffffffff11000"
+       "000000000000000000000000000",
+       "05000000000000000000000000000000"},
+      {"0100000000000000000000000000000000000000000000000000000000000000",
+       "fffffffffffffffffffffffffffffffffbfefefefefefefefefefefefefefefe0101"
+       "0101010101010101010101010101",
+       "00000000000000000000000000000000"},
+      {"0200000000000000000000000000000000000000000000000000000000000000",
+       "fdffffffffffffffffffffffffffffff", "faffffffffffffffffffffffffffffff"},
+  };
+  uint8_t key[32], msg[48], tag[16];
+
+  ck_assert_int_eq(poly1305_power_on_self_test(), 1);
+
+  for (size_t i = 0; i < sizeof(tests) / sizeof(*tests); i++) {
+    size_t len = strlen(tests[i].msg) / 2;
+    memcpy(key, fromhex(tests[i].key), sizeof(key));
+    memcpy(msg, fromhex(tests[i].msg), len);
+    poly1305_auth(tag, msg, len, key);
+    ck_assert_mem_eq(tag, fromhex(tests[i].tag), sizeof(tag));
+  }
 }
 END_TEST
 
@@ -6342,6 +6699,22 @@ START_TEST(test_hmac_drbg) {
     ck_assert_mem_eq(result, fromhex(expected), i);
     ck_assert_mem_eq(result + i, null_bytes, sizeof(result) - i);
   }
+
+  // deferring the state update doesn't change the output
+  uint8_t deferred[128];
+  hmac_drbg_init(&ctx, fromhex(entropy), strlen(entropy) / 2, nonce_bytes,
+                 strlen(nonce) / 2);
+  hmac_drbg_generate_deferred(&ctx, deferred, sizeof(deferred));
+  hmac_drbg_reseed(&ctx, fromhex(reseed), strlen(reseed) / 2, NULL, 0);
+  hmac_drbg_generate_deferred(&ctx, deferred, sizeof(deferred));
+  hmac_drbg_generate(&ctx, deferred, sizeof(deferred));
+  hmac_drbg_init(&ctx, fromhex(entropy), strlen(entropy) / 2, nonce_bytes,
+                 strlen(nonce) / 2);
+  hmac_drbg_generate(&ctx, result, sizeof(result));
+  hmac_drbg_reseed(&ctx, fromhex(reseed), strlen(reseed) / 2, NULL, 0);
+  hmac_drbg_generate(&ctx, result, sizeof(result));
+  hmac_drbg_generate(&ctx, result, sizeof(result));
+  ck_assert_mem_eq(deferred, result, sizeof(result));
 }
 END_TEST
 
@@ -6500,6 +6873,61 @@ START_TEST(test_mnemonic) {
 }
 END_TEST
 
+#if USE_BIP39_CACHE
+START_TEST(test_bip39_cache) {
+  static const char *mnemonic =
+      "abandon abandon abandon abandon abandon abandon abandon abandon "
+      "abandon abandon abandon about";
+  static const char *passphrases[] = {
+      "",
+      "TREZOR",
+      "TREZOR1",
+      "a passphrase longer than the 64 characters that the cache used to "
+      "keep",
+      "TREZOR2",
+      "TREZOR3",
+  };
+  const size_t n = sizeof(passphrases) / sizeof(*passphrases);
+  uint8_t expected[sizeof(passphrases) / sizeof(*passphrases)][64];
+  uint8_t seed[64];
+
+  bip39_cache_clear();
+  for (size_t i = 0; i < n; i++) {
+    mnemonic_to_seed(mnemonic, passphrases[i], expected[i], 0);
+  }
+  ck_assert_mem_eq(
+      expected[1],
+      fromhex("c55257c360c07c72029aebc1b53c05ed0362ada38ead3e3e9efa3708e53495"
+              "531f09a6987599d18264c1e1c92f2cf141630c7a3c4ab7c81b2f001698e746"
+              "3b04"),
+      64);
+
+  // seeds of the cache and recomputed ones have to agree also after the
+  // least recently used entries are replaced
+  static const size_t order[] = {5, 4, 1, 5, 0, 3, 3, 2, 1, 0, 4, 5, 2};
+  for (size_t i = 0; i < sizeof(order) / sizeof(*order); i++) {
+    mnemonic_to_seed(mnemonic, passphrases[order[i]], seed, 0);
+    ck_assert_mem_eq(seed, expected[order[i]], 64);
+  }
+
+  // a different mnemonic with the same passphrase
+  mnemonic_to_seed("legal winner thank year wave sausage worth useful legal "
+                   "winner thank yellow",
+                   "TREZOR", seed, 0);
+  ck_assert_mem_eq(
+      seed,
+      fromhex("2e8905819b8723fe2c1d161860e5ee1830318dbf49a83bd451cfb8440c28bd"
+              "6fa457fe1296106559a3c80937a1c1069be3a3a5bd381ee6260e8d9739fce1"
+              "f607"),
+      64);
+
+  bip39_cache_clear();
+  mnemonic_to_seed(mnemonic, passphrases[3], seed, 0);
+  ck_assert_mem_eq(seed, expected[3], 64);
+}
+END_TEST
+#endif
+
 START_TEST(test_groestl512) {
   static struct {
     const char *msg;
@@ -6821,6 +7249,55 @@ START_TEST(test_mnemonic_find_word) {
 }
 END_TEST
 
+START_TEST(test_mnemonic_complete_word) {
+  ck_assert_str_eq(mnemonic_complete_word("", 0), "abandon");
+  ck_assert_str_eq(mnemonic_complete_word("zo", 2), "zone");
+  ck_assert_str_eq(mnemonic_complete_word("zoo", 3), "zoo");
+  ck_assert_ptr_eq(mnemonic_complete_word("aaa", 3), NULL);
+  ck_assert_ptr_eq(mnemonic_complete_word("zzz", 3), NULL);
+  ck_assert_uint_eq(mnemonic_word_completion_mask("zo", 2),
+                    (1 << ('n' - 'a')) | (1 << ('o' - 'a')));
+  ck_assert_uint_eq(mnemonic_word_completion_mask("zoo", 3), 0);
+  ck_assert_uint_eq(mnemonic_word_completion_mask("zzz", 3), 0);
+
+  // compare with a linear search for every prefix of up to two letters and
+  // every prefix of the words
+  char prefix[10] = {0};
+  for (int n = 0; n < 26 * 27 + BIP39_WORD_COUNT * 8; n++) {
+    int len = 0;
+    if (n < 26 * 27) {
+      prefix[0] = 'a' + n / 27;
+      prefix[1] = 'a' + n % 27 - 1;
+      len = n % 27 == 0 ? 1 : 2;
+    } else {
+      const char *word = mnemonic_get_word((n - 26 * 27) / 8);
+      len = (n - 26 * 27) % 8 + 1;
+      if (len > (int)strlen(word)) {
+        continue;
+      }
+      memcpy(prefix, word, len);
+    }
+    prefix[len] = 0;
+
+    const char *first = NULL;
+    uint32_t mask = 0;
+    for (int i = 0; i < BIP39_WORD_COUNT; i++) {
+      const char *word = mnemonic_get_word(i);
+      if (strncmp(word, prefix, len) == 0) {
+        if (!first) {
+          first = word;
+        }
+        if (word[len]) {
+          mask |= 1 << (word[len] - 'a');
+        }
+      }
+    }
+    ck_assert_ptr_eq(mnemonic_complete_word(prefix, len), first);
+    ck_assert_uint_eq(mnemonic_word_completion_mask(prefix, len), mask);
+  }
+}
+END_TEST
+
 START_TEST(test_slip39_get_word) {
   static const struct {
     const int index;
@@ -6922,6 +7399,38 @@ START_TEST(test_slip39_word_completion) {
 }
 END_TEST
 
+START_TEST(test_slip39_rs1024_checksum) {
+  static const char *mnemonic =
+      "duckling enlarge academic academic agency result length solution fridge "
+      "kidney coal piece deal husband erode duke ajar critical decision "
+      "keyboard";
+  static const char *customization = "shamir";
+
+  uint32_t chk = 1;
+  for (const char *c = customization; *c != '\0'; c++) {
+    chk = slip39_rs1024_polymod_update(chk, (uint8_t)*c);
+  }
+
+  uint16_t index = 0, last_index = 0;
+  const char *word = mnemonic;
+  while (*word != '\0') {
+    const char *end = strchr(word, ' ');
+    if (end == NULL) {
+      end = word + strlen(word);
+    }
+    ck_assert(word_index(&index, word, end - word));
+    last_index = index;
+    chk = slip39_rs1024_polymod_update(chk, index);
+    word = (*end == ' ') ? end + 1 : end;
+  }
+  ck_assert_uint_eq(chk, 1);
+
+  // Changing the last word invalidates the checksum.
+  chk ^= last_index ^ ((last_index + 1) % SLIP39_WORD_COUNT);
+  ck_assert_uint_ne(chk, 1);
+}
+END_TEST
+
 START_TEST(test_shamir) {
 #define SHAMIR_MAX_COUNT 16
   static const struct {
@@ -7034,6 +7543,50 @@ START_TEST(test_shamir) {
 }
 END_TEST
 
+START_TEST(test_shamir_interpolate_multi) {
+  // 40 shares take two blocks of lanes, 255 results take eight
+  static uint8_t share_indices[40], values[40][SHAMIR_MAX_LEN];
+  static uint8_t result_indices[255], results[255][SHAMIR_MAX_LEN];
+  const uint8_t *share_values[40];
+  uint8_t *result_ptrs[255];
+  uint8_t expected[SHAMIR_MAX_LEN];
+
+  for (size_t i = 0; i < 40; i++) {
+    share_indices[i] = 6 * i + 3;
+    random_buffer(values[i], SHAMIR_MAX_LEN);
+    share_values[i] = values[i];
+  }
+  for (size_t i = 0; i < 255; i++) {
+    result_indices[i] = 255 - i;
+    result_ptrs[i] = results[i];
+  }
+
+  for (size_t count = 1; count <= 40; count += 13) {
+    ck_assert(shamir_interpolate_multi(result_ptrs, result_indices, 255,
+                                       share_indices, share_values, count,
+                                       SHAMIR_MAX_LEN));
+    for (size_t i = 0; i < 255; i++) {
+      ck_assert(shamir_interpolate(expected, result_indices[i], share_indices,
+                                   share_values, count, SHAMIR_MAX_LEN));
+      ck_assert_mem_eq(results[i], expected, SHAMIR_MAX_LEN);
+    }
+    // the polynomial goes through the shares
+    for (size_t i = 0; i < count; i++) {
+      ck_assert_mem_eq(results[255 - share_indices[i]], values[i],
+                       SHAMIR_MAX_LEN);
+    }
+  }
+
+  // duplicate share indices in different blocks
+  share_indices[39] = share_indices[0];
+  ck_assert(!shamir_interpolate_multi(result_ptrs, result_indices, 255,
+                                      share_indices, share_values, 40,
+                                      SHAMIR_MAX_LEN));
+  memset(expected, 0, SHAMIR_MAX_LEN);
+  ck_assert_mem_eq(results[0], expected, SHAMIR_MAX_LEN);
+}
+END_TEST
+
 START_TEST(test_address) {
   char address[36];
   uint8_t pub_key[65];
@@ -7548,26 +8101,29 @@ END_TEST
 
 #if USE_PRECOMPUTED_CP
 static void test_codepoints_curve(const ecdsa_curve *curve) {
-  int i, j;
+  int i, j, k;
   bignum256 a;
-  curve_point p, p1;
-  for (i = 0; i < 64; i++) {
-    for (j = 0; j < 8; j++) {
-      bn_zero(&a);
-      a.val[(4 * i) / BN_BITS_PER_LIMB] = (uint32_t)(2 * j + 1)
-                                          << (4 * i % BN_BITS_PER_LIMB);
-      bn_normalize(&a);
+  curve_point p, p1, cp;
+  for (i = 0; i < PRECOMPUTED_CP_ROWS; i++) {
+    for (j = 0; j < PRECOMPUTED_CP_COLS; j++) {
+      // a = (2*j+1) * 2^(PRECOMPUTED_CP_WINDOW*i) mod order
+      bn_read_uint32(2 * j + 1, &a);
+      for (k = 0; k < PRECOMPUTED_CP_WINDOW * i; k++) {
+        bn_lshift(&a);
+        bn_mod(&a, &curve->order);
+      }
+      precomputed_cp(curve, i, j, &cp);
       // note that this is not a trivial test.  We add 64 curve
       // points in the table to get that particular curve point.
       scalar_multiply(curve, &a, &p);
-      ck_assert_mem_eq(&p, &curve->cp[i][j], sizeof(curve_point));
+      ck_assert_mem_eq(&p, &cp, sizeof(curve_point));
       bn_zero(&p.y);  // test that point_multiply curve, is not a noop
       point_multiply(curve, &a, &curve->G, &p);
-      ck_assert_mem_eq(&p, &curve->cp[i][j], sizeof(curve_point));
+      ck_assert_mem_eq(&p, &cp, sizeof(curve_point));
       // mul 2 test. this should catch bugs
       bn_lshift(&a);
       bn_mod(&a, &curve->order);
-      p1 = curve->cp[i][j];
+      p1 = cp;
       point_double(curve, &p1);
       // note that this is not a trivial test.  We add 64 curve
       // points in the table to get that particular curve point.
@@ -7698,6 +8254,223 @@ END_TEST
 START_TEST(test_point_mult_nist256p1) { test_point_mult_curve(&nist256p1); }
 END_TEST
 
+static void test_point_jacobian_curve(const ecdsa_curve *curve) {
+  int i;
+  // get two "random" numbers
+  bignum256 a = curve->G.x;
+  bignum256 b = curve->G.y;
+  curve_point p1, p2, p3;
+  jacobian_curve_point jp;
+  for (i = 0; i < 100; i++) {
+    /* test distributivity with jacobian accumulation: (a + b)G = aG + bG */
+    bn_mod(&a, &curve->order);
+    bn_mod(&b, &curve->order);
+    ck_assert_int_eq(scalar_multiply(curve, &a, &p1), 0);
+    ck_assert_int_eq(point_multiply_jacobian(curve, &b, &curve->G, &jp), 0);
+    point_jacobian_add(&p1, &jp, curve);
+    jacobian_to_curve(&jp, &p2, &curve->prime);
+    bn_addmod(&a, &b, &curve->order);
+    bn_mod(&a, &curve->order);
+    ck_assert_int_eq(scalar_multiply(curve, &a, &p3), 0);
+    ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+    // new "random" numbers
+    a = p3.x;
+    b = p3.y;
+  }
+
+  // P + (-P) is the point at infinity
+  bn_one(&a);
+  ck_assert_int_eq(scalar_multiply_jacobian(curve, &a, &jp), 0);
+  p1 = curve->G;
+  bn_subtract(&curve->prime, &p1.y, &p1.y);
+  point_jacobian_add(&p1, &jp, curve);
+  ck_assert(point_jacobian_is_infinity(&jp, curve));
+
+  // infinity + P == P
+  point_jacobian_set_infinity(&jp);
+  point_jacobian_add(&curve->G, &jp, curve);
+  ck_assert(!point_jacobian_is_infinity(&jp, curve));
+  jacobian_to_curve(&jp, &p2, &curve->prime);
+  ck_assert_mem_eq(&p2, &curve->G, sizeof(curve_point));
+
+  // P + P == 2P
+  point_jacobian_add(&curve->G, &jp, curve);
+  jacobian_to_curve(&jp, &p2, &curve->prime);
+  p3 = curve->G;
+  point_double(curve, &p3);
+  ck_assert_mem_eq(&p2, &p3, sizeof(curve_point));
+}
+
+START_TEST(test_point_jacobian_secp256k1) {
+  test_point_jacobian_curve(&secp256k1);
+}
+END_TEST
+START_TEST(test_point_jacobian_nist256p1) {
+  test_point_jacobian_curve(&nist256p1);
+}
+END_TEST
+
+static void test_point_multiply_double_curve(const ecdsa_curve *curve) {
+  int i;
+  // get three "random" numbers
+  bignum256 a = curve->G.x;
+  bignum256 b = curve->G.y;
+  bignum256 c = curve->b;
+  curve_point q, p1, p2, p3;
+  for (i = 0; i < 100; i++) {
+    /* test a*G + b*Q == (a + b*c)G, where Q = c*G */
+    bn_mod(&a, &curve->order);
+    bn_mod(&b, &curve->order);
+    bn_mod(&c, &curve->order);
+    ck_assert_int_eq(scalar_multiply(curve, &c, &q), 0);
+    ck_assert_int_eq(point_multiply_double(curve, &a, &curve->G, &b, &q, &p1),
+                     0);
+    // the order of the summands doesn't matter
+    ck_assert_int_eq(point_multiply_double(curve, &b, &q, &a, &curve->G, &p2),
+                     0);
+    ck_assert_mem_eq(&p1, &p2, sizeof(curve_point));
+    bn_multiply(&c, &b, &curve->order);
+    bn_addmod(&b, &a, &curve->order);
+    bn_mod(&b, &curve->order);
+    ck_assert_int_eq(scalar_multiply(curve, &b, &p3), 0);
+    ck_assert_mem_eq(&p1, &p3, sizeof(curve_point));
+    // new "random" numbers
+    a = p1.x;
+    b = p1.y;
+    c = q.x;
+  }
+
+  // 0*G + b*Q == b*Q
+  bn_zero(&a);
+  bn_mod(&b, &curve->order);
+  ck_assert_int_eq(point_multiply_double(curve, &a, &curve->G, &b, &q, &p1),
+                   0);
+  ck_assert_int_eq(point_multiply(curve, &b, &q, &p2), 0);
+  ck_assert_mem_eq(&p1, &p2, sizeof(curve_point));
+
+  // a*G + (n - a)*G is the point at infinity
+  bn_one(&a);
+  bn_subtract(&curve->order, &a, &b);
+  ck_assert_int_eq(
+      point_multiply_double(curve, &a, &curve->G, &b, &curve->G, &p1), 0);
+  ck_assert(point_is_infinity(&p1));
+
+  // out of range scalars are rejected
+  ck_assert_int_eq(
+      point_multiply_double(curve, &curve->order, &curve->G, &a, &q, &p1), 1);
+}
+
+START_TEST(test_point_multiply_double_secp256k1) {
+  test_point_multiply_double_curve(&secp256k1);
+}
+END_TEST
+START_TEST(test_point_multiply_double_nist256p1) {
+  test_point_multiply_double_curve(&nist256p1);
+}
+END_TEST
+
+START_TEST(test_point_multiply_glv) {
+  // scalars whose GLV decomposition has halves which are zero, negative, even
+  // or close to 2^128
+  static const char *scalars[] = {
+      "0000000000000000000000000000000000000000000000000000000000000001",
+      "0000000000000000000000000000000000000000000000000000000000000002",
+      "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140",
+      "fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd036413f",
+      "5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72",
+      "a6c75a9980b861c14a4c38051024c8b4245c45d44102ccf1be052cf836477ae4",
+      "ac9c52b33fa3cf1f5ad9e3fd77ed9ba4a880b9fc8ec739c2e0cfc810b51283cf",
+      "e2d7277f4566dd29ad3ba425f913e14c25f8981d2a72802611dd5712563f14b1",
+      "000000000000000000000000000000003086d221a7d46bcde86c90e49284eb15",
+      "00000000000000000000000000000000e4437ed6010e88286f547fa90abfe4c3",
+      "0000000000000000000000000000000114ca50f7a8e2f3f657c1108d9d44cfd8",
+      "0000000000000000000000000000000100000000000000000000000000000000",
+      "00000000000000000000000000000000ffffffffffffffffffffffffffffffff",
+      "7fffffffffffffffffffffffffffffff5d576e7357a4501ddfe92f46681b20a0",
+      "7fffffffffffffffffffffffffffffff5d576e7357a4501ddfe92f46681b20a1",
+      "8000000000000000000000000000000000000000000000000000000000000000",
+  };
+  const ecdsa_curve *curve = &secp256k1;
+  bignum256 k = {0}, zero = {0};
+  curve_point q, p1, p2;
+
+  bn_read_uint32(7, &k);
+  ck_assert_int_eq(scalar_multiply(curve, &k, &q), 0);
+  for (size_t i = 0; i < sizeof(scalars) / sizeof(*scalars); i++) {
+    bn_read_be(fromhex(scalars[i]), &k);
+    // point_multiply_double doesn't use the endomorphism
+    ck_assert_int_eq(point_multiply(curve, &k, &q, &p1), 0);
+    ck_assert_int_eq(point_multiply_double(curve, &k, &q, &zero, &q, &p2), 0);
+    ck_assert_mem_eq(&p1, &p2, sizeof(curve_point));
+  }
+}
+END_TEST
+
+static void test_point_multiply_multi_curve(const ecdsa_curve *curve) {
+  // the numbers of points around the chunk size of Straus' method and around
+  // the switch to Pippenger's method
+  static const size_t counts[] = {0, 1, 2, 3, 4, 5, 8, 9, 10,
+                                  PIPPENGER_MIN_POINTS - 1,
+                                  PIPPENGER_MIN_POINTS};
+  bignum256 k[PIPPENGER_MIN_POINTS] = {0}, a = curve->G.x, b = curve->G.y;
+  curve_point p[PIPPENGER_MIN_POINTS], q, r, s;
+
+  for (size_t c = 0; c < sizeof(counts) / sizeof(*counts); c++) {
+    size_t n = counts[c];
+    point_set_infinity(&s);
+    for (size_t i = 0; i < n; i++) {
+      // "random" points and scalars, p[0] is the generator, k[3] is zero and
+      // k[9] * p[9] equals k[8] * p[8]
+      bn_multiply(&b, &a, &curve->order);
+      bn_mod(&a, &curve->order);
+      k[i] = a;
+      if (i == 3) {
+        bn_zero(&k[i]);
+      }
+      if (i == 0) {
+        p[i] = curve->G;
+      } else if (i == 9) {
+        p[i] = p[8];
+        k[i] = k[8];
+      } else {
+        ck_assert_int_eq(scalar_multiply(curve, &b, &p[i]), 0);
+        bn_addi(&b, 1);
+      }
+      if (!bn_is_zero(&k[i])) {
+        ck_assert_int_eq(point_multiply(curve, &k[i], &p[i], &q), 0);
+        point_add(curve, &q, &s);
+      }
+    }
+    ck_assert_int_eq(point_multiply_multi(curve, n, k, p, &r), 0);
+    ck_assert_mem_eq(&r, &s, sizeof(curve_point));
+  }
+
+  // a * p[1] + (-a) * p[1] is the point at infinity
+  p[0] = p[1];
+  bn_subtract(&curve->order, &k[1], &k[0]);
+  ck_assert_int_eq(point_multiply_multi(curve, 2, k, p, &r), 0);
+  ck_assert(point_is_infinity(&r));
+  p[PIPPENGER_MIN_POINTS - 1] = p[1];
+  bn_subtract(&curve->order, &k[1], &k[PIPPENGER_MIN_POINTS - 1]);
+  bn_zero(&k[0]);
+  for (size_t i = 2; i < PIPPENGER_MIN_POINTS - 1; i++) {
+    bn_zero(&k[i]);
+  }
+  ck_assert_int_eq(point_multiply_multi(curve, PIPPENGER_MIN_POINTS, k, p, &r),
+                   0);
+  ck_assert(point_is_infinity(&r));
+
+  // scalars must be less than the order of the curve
+  k[5] = curve->order;
+  ck_assert_int_eq(point_multiply_multi(curve, 10, k, p, &r), 1);
+}
+
+START_TEST(test_point_multiply_multi) {
+  test_point_multiply_multi_curve(&secp256k1);
+  test_point_multiply_multi_curve(&nist256p1);
+}
+END_TEST
+
 static void test_scalar_point_mult_curve(const ecdsa_curve *curve) {
   int i;
   // get two "random" numbers
@@ -8045,6 +8818,190 @@ START_TEST(test_ed25519_keccak) {
 }
 END_TEST
 
+START_TEST(test_ed25519_sign_open_batch) {
+  static uint32_t scratch[ED25519_BATCH_SCRATCH_SIZE(8) / 4];
+  // scratch space for no batch, a single batch, and batches of 4 and 8
+  static const size_t scratch_sizes[] = {
+      0, ED25519_BATCH_SCRATCH_SIZE(1), ED25519_BATCH_SCRATCH_SIZE(4),
+      ED25519_BATCH_SCRATCH_SIZE(8)};
+  ed25519_secret_key sk;
+  ed25519_public_key pks[20];
+  ed25519_signature sigs[20];
+  uint8_t msgs[20][32];
+  const unsigned char *m[20], *pk[20], *rs[20];
+  size_t mlen[20];
+  int valid[20];
+
+  for (size_t i = 0; i < 20; i++) {
+    sha256_Raw((const uint8_t *)&i, sizeof(i), sk);
+    ed25519_publickey(sk, pks[i]);
+    sha256_Raw(sk, 32, msgs[i]);
+    // the messages have different lengths
+    ed25519_sign(msgs[i], i + 1, sk, sigs[i]);
+    m[i] = msgs[i];
+    mlen[i] = i + 1;
+    pk[i] = pks[i];
+    rs[i] = sigs[i];
+  }
+
+  for (size_t i = 0; i < sizeof(scratch_sizes) / sizeof(*scratch_sizes); i++) {
+    for (size_t n = 0; n <= 20; n += 5) {
+      memset(valid, 0, sizeof(valid));
+      ck_assert_int_eq(ed25519_sign_open_batch(m, mlen, pk, rs, n, valid,
+                                               scratch, scratch_sizes[i]),
+                       0);
+      for (size_t j = 0; j < n; j++) {
+        ck_assert_int_eq(valid[j], 1);
+      }
+    }
+
+    // invalid signature, public key and S
+    sigs[5][0] ^= 1;
+    pks[11][0] ^= 1;
+    sigs[17][63] |= 0xe0;
+    ck_assert_int_eq(ed25519_sign_open_batch(m, mlen, pk, rs, 20, valid,
+                                             scratch, scratch_sizes[i]),
+                     -1);
+    for (size_t j = 0; j < 20; j++) {
+      ck_assert_int_eq(valid[j], j != 5 && j != 11 && j != 17);
+    }
+    ck_assert_int_eq(ed25519_sign_open_batch(m, mlen, pk, rs, 20, NULL,
+                                             scratch, scratch_sizes[i]),
+                     -1);
+    sigs[5][0] ^= 1;
+    pks[11][0] ^= 1;
+    sigs[17][63] &= 0x1f;
+  }
+
+  // signatures with non-canonical encodings of R = (0, 1), made with the
+  // secret key 000102...1f: the sign bit set and y = p + 1, they satisfy the
+  // batch equation but ed25519_sign_open rejects them
+  static const char *noncanonical_sigs[] = {
+      "0100000000000000000000000000000000000000000000000000000000000080"
+      "42aa2cbd2bc04bc8ad185c5df49914e97c993f2fb2670d0c9562f46b2df68901",
+      "eeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f"
+      "68edbd2d98899774ca6b4f469d633541669bff08bc0ce049d94f593e783aa201",
+  };
+  memcpy(pks[0],
+         fromhex("03a107bff3ce10be1d70dd18e74bc099"
+                 "67e4d6309ba50d5f1ddc8664125531b8"),
+         32);
+  m[0] = (const unsigned char *)"non-canonical R";
+  mlen[0] = 15;
+  for (size_t i = 0; i < sizeof(noncanonical_sigs) / sizeof(*noncanonical_sigs);
+       i++) {
+    memcpy(sigs[0], fromhex(noncanonical_sigs[i]), 64);
+    ck_assert_int_eq(ed25519_sign_open(m[0], mlen[0], pk[0], rs[0]), -1);
+    for (size_t j = 0; j < sizeof(scratch_sizes) / sizeof(*scratch_sizes);
+         j++) {
+      ck_assert_int_eq(ed25519_sign_open_batch(m, mlen, pk, rs, 5, valid,
+                                               scratch, scratch_sizes[j]),
+                       -1);
+      ck_assert_int_eq(valid[0], 0);
+      for (size_t k = 1; k < 5; k++) {
+        ck_assert_int_eq(valid[k], 1);
+      }
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_ed25519_sign_open_expanded) {
+  ed25519_secret_key sk;
+  ed25519_public_key pks[8];
+  ed25519_signature sigs[8];
+  ed25519_public_key_expanded epk, epk2;
+  uint8_t msg[32];
+
+  for (size_t i = 0; i < 8; i++) {
+    sha256_Raw((const uint8_t *)&i, sizeof(i), sk);
+    ed25519_publickey(sk, pks[i]);
+    sha256_Raw(sk, 32, msg);
+    ed25519_sign(msg, sizeof(msg), sk, sigs[i]);
+  }
+
+  // more keys than the cache holds, each of them expanded twice in a row and
+  // again after being evicted
+  for (size_t r = 0; r < 2; r++) {
+    for (size_t i = 0; i < 8; i++) {
+      sha256_Raw((const uint8_t *)&i, sizeof(i), sk);
+      sha256_Raw(sk, 32, msg);
+      ck_assert_int_eq(ed25519_public_key_expand(&epk, pks[i]), 0);
+      ck_assert_int_eq(ed25519_public_key_expand(&epk2, pks[i]), 0);
+      ck_assert_mem_eq(&epk, &epk2, sizeof(epk));
+      ck_assert_mem_eq(epk.pk, pks[i], sizeof(ed25519_public_key));
+      ck_assert_int_eq(
+          ed25519_sign_open_expanded(msg, sizeof(msg), &epk, sigs[i]), 0);
+      ck_assert_int_eq(
+          ed25519_sign_open_expanded(msg, sizeof(msg), &epk, sigs[(i + 1) % 8]),
+          -1);
+      msg[0] ^= 1;
+      ck_assert_int_eq(
+          ed25519_sign_open_expanded(msg, sizeof(msg), &epk, sigs[i]), -1);
+    }
+  }
+
+  // about half of the y coordinates aren't on the curve
+  ed25519_public_key invalid = {0};
+  int found = 0;
+  for (invalid[0] = 2; invalid[0] < 64 && !found; invalid[0]++) {
+    if (ed25519_public_key_expand(&epk, invalid) != 0) {
+      found = 1;
+      // an invalid key isn't cached
+      ck_assert_int_eq(ed25519_public_key_expand(&epk, invalid), -1);
+    }
+  }
+  ck_assert_int_eq(found, 1);
+}
+END_TEST
+
+// test vectors from RFC 7748
+START_TEST(test_curve25519_scalarmult) {
+  static const struct {
+    const char *scalar;
+    const char *u;
+    const char *result;
+  } tests[] = {
+      {"a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4",
+       "e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c",
+       "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552"},
+      {"4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d",
+       "e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493",
+       "95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957"},
+  };
+  curve25519_key k, u, r;
+
+  for (size_t i = 0; i < sizeof(tests) / sizeof(*tests); i++) {
+    memcpy(k, fromhex(tests[i].scalar), 32);
+    memcpy(u, fromhex(tests[i].u), 32);
+    curve25519_scalarmult(r, k, u);
+    ck_assert_mem_eq(r, fromhex(tests[i].result), 32);
+  }
+
+  // k = u = 9, then k, u = X25519(k, u), k
+  memzero(k, sizeof(k));
+  k[0] = 9;
+  memcpy(u, k, sizeof(u));
+  for (int i = 1; i <= 1000; i++) {
+    curve25519_scalarmult(r, k, u);
+    memcpy(u, k, sizeof(u));
+    memcpy(k, r, sizeof(k));
+    if (i == 1) {
+      ck_assert_mem_eq(
+          k,
+          fromhex(
+              "422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079"),
+          32);
+    }
+  }
+  ck_assert_mem_eq(
+      k,
+      fromhex(
+          "684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51"),
+      32);
+}
+END_TEST
+
 START_TEST(test_ed25519_cosi) {
   const int MAXN = 10;
   ed25519_secret_key keys[MAXN];
@@ -8393,6 +9350,40 @@ START_TEST(test_ge25519_double_scalarmult_vartime2) {
 }
 END_TEST
 
+START_TEST(test_ge25519_multi_scalarmult_vartime) {
+  // the numbers of points around the chunk size of Straus' method and around
+  // the switch to Pippenger's method
+  static const size_t counts[] = {0, 1, 2, 4, 5, 9, PIPPENGER_MIN_POINTS - 1,
+                                  PIPPENGER_MIN_POINTS};
+  uint8_t hash[32] = {0}, packed1[32] = {0}, packed2[32] = {0};
+  bignum256modm s[PIPPENGER_MIN_POINTS] = {0}, t = {0};
+  ge25519 p[PIPPENGER_MIN_POINTS], q, r, sum;
+
+  for (size_t i = 0; i < PIPPENGER_MIN_POINTS; i++) {
+    // "random" scalars and points, s[3] is zero and p[7] equals p[6]
+    sha256_Raw((const uint8_t *)&i, sizeof(i), hash);
+    expand256_modm(s[i], hash, 32);
+    sha256_Raw(hash, 32, hash);
+    expand256_modm(t, hash, 32);
+    ge25519_scalarmult_base_wrapper(&p[i], t);
+  }
+  set256_modm(s[3], 0);
+  ge25519_copy(&p[7], &p[6]);
+
+  for (size_t i = 0; i < sizeof(counts) / sizeof(*counts); i++) {
+    ge25519_set_neutral(&sum);
+    for (size_t j = 0; j < counts[i]; j++) {
+      ge25519_scalarmult(&q, &p[j], s[j]);
+      ge25519_add(&sum, &sum, &q, 0);
+    }
+    ge25519_multi_scalarmult_vartime(&r, counts[i], s, p);
+    ge25519_pack(packed1, &r);
+    ge25519_pack(packed2, &sum);
+    ck_assert_mem_eq(packed1, packed2, 32);
+  }
+}
+END_TEST
+
 static void test_bip32_ecdh_init_node(HDNode *node, const char *seed_str,
                                       const char *curve_name) {
   hdnode_from_seed((const uint8_t *)seed_str, strlen(seed_str), curve_name,
@@ -9469,6 +10460,53 @@ START_TEST(test_nem_transaction_multisig) {
   ck_assert_int_eq(ed25519_sign_open_keccak(ctx.buffer, ctx.offset,
                                             ctx.public_key, signature),
                    0);
+
+  // the same transactions with the inner transaction built in place
+  uint8_t expected[1024];
+  size_t expected_size = 0;
+  for (int cosigning = 0; cosigning < 2; cosigning++) {
+    nem_transaction_start(
+        &ctx,
+        fromhex(
+            "7ba4b39209f1b9846b098fe43f74381e43cb2882ccde780f558a63355840aa87"),
+        buffer, sizeof(buffer));
+    if (cosigning) {
+      ck_assert(nem_transaction_create_multisig_signature(
+          &ctx, NEM_NETWORK_MAINNET, 59414381, NULL, 6000000, 59500781,
+          &other_trans));
+    } else {
+      ck_assert(nem_transaction_create_multisig(&ctx, NEM_NETWORK_MAINNET,
+                                                59414381, NULL, 6000000,
+                                                59500781, &other_trans));
+    }
+    memcpy(expected, ctx.buffer, ctx.offset);
+    expected_size = ctx.offset;
+
+    nem_transaction_ctx in_place;
+    nem_transaction_start(
+        &ctx,
+        fromhex(
+            "7ba4b39209f1b9846b098fe43f74381e43cb2882ccde780f558a63355840aa87"),
+        buffer, sizeof(buffer));
+    nem_transaction_start_inner(
+        &in_place, &ctx,
+        fromhex(
+            "a1df5306355766bd2f9a64efdc089eb294be265987b3359093ae474c051d7d5a"));
+    ck_assert(nem_transaction_create_provision_namespace(
+        &in_place, NEM_NETWORK_MAINNET, 59414272, NULL, 20000000, 59500672,
+        "dim", NULL, "NAMESPACEWH4MKFMBCVFERDPOOP4FK7MTBXDPZZA", 5000000000));
+    if (cosigning) {
+      ck_assert(nem_transaction_create_multisig_signature(
+          &ctx, NEM_NETWORK_MAINNET, 59414381, NULL, 6000000, 59500781,
+          &in_place));
+    } else {
+      ck_assert(nem_transaction_create_multisig(&ctx, NEM_NETWORK_MAINNET,
+                                                59414381, NULL, 6000000,
+                                                59500781, &in_place));
+    }
+    ck_assert_uint_eq(ctx.offset, expected_size);
+    ck_assert_mem_eq(ctx.buffer, expected, expected_size);
+  }
 }
 END_TEST
 
@@ -10494,6 +11532,52 @@ START_TEST(test_zkp_bip340_verify) {
 }
 END_TEST
 
+START_TEST(test_zkp_bip340_verify_batch) {
+  uint8_t priv_key[32] = {0};
+  uint8_t pub_keys[10][32] = {0};
+  uint8_t digests[10][32] = {0};
+  uint8_t sigs[10][64] = {0};
+  uint8_t aux_input[32] = {0};
+  const uint8_t *pub_key_ptrs[10] = {0};
+  const uint8_t *digest_ptrs[10] = {0};
+  const uint8_t *sig_ptrs[10] = {0};
+  size_t bad_index = 0;
+  int res = 0;
+
+  for (size_t i = 0; i < 10; i++) {
+    sha256_Raw((const uint8_t *)&i, sizeof(i), priv_key);
+    sha256_Raw(priv_key, 32, digests[i]);
+    ck_assert_int_eq(zkp_bip340_get_public_key(priv_key, pub_keys[i]), 0);
+    ck_assert_int_eq(
+        zkp_bip340_sign_digest(priv_key, digests[i], sigs[i], aux_input), 0);
+    pub_key_ptrs[i] = pub_keys[i];
+    digest_ptrs[i] = digests[i];
+    sig_ptrs[i] = sigs[i];
+  }
+
+  for (size_t n = 0; n <= 10; n++) {
+    res = zkp_bip340_verify_batch(n, pub_key_ptrs, sig_ptrs, digest_ptrs,
+                                  &bad_index);
+    ck_assert_int_eq(res, 0);
+  }
+
+  // invalid signature
+  sigs[7][63] ^= 1;
+  res = zkp_bip340_verify_batch(10, pub_key_ptrs, sig_ptrs, digest_ptrs,
+                                &bad_index);
+  ck_assert_int_eq(res, 5);
+  ck_assert_uint_eq(bad_index, 7);
+  sigs[7][63] ^= 1;
+
+  // x coordinate of the public key exceeds the field size
+  memset(pub_keys[2], 0xff, 32);
+  res = zkp_bip340_verify_batch(10, pub_key_ptrs, sig_ptrs, digest_ptrs,
+                                &bad_index);
+  ck_assert_int_eq(res, 1);
+  ck_assert_uint_eq(bad_index, 2);
+}
+END_TEST
+
 START_TEST(test_zkp_bip340_tweak) {
   static struct {
     const char *root_hash;
@@ -10781,6 +11865,29 @@ START_TEST(test_hash_to_curve_optiga) {
 }
 END_TEST
 
+START_TEST(test_memzero) {
+  // memzero_words is the fallback of memzero on platforms without a secure
+  // clearing function such as explicit_bzero, test it directly as well
+  void (*const functions[])(void *const, const size_t) = {memzero,
+                                                          memzero_words};
+  uint32_t words[24] = {0};
+  uint8_t *buffer = (uint8_t *)words;
+  for (size_t f = 0; f < sizeof(functions) / sizeof(*functions); f++) {
+    // unaligned heads and tails, lengths around the word and block sizes
+    for (size_t offset = 0; offset < 8; offset++) {
+      for (size_t len = 0; len <= sizeof(words) - 16; len++) {
+        memset(buffer, 0xAB, sizeof(words));
+        functions[f](buffer + offset, len);
+        for (size_t i = 0; i < sizeof(words); i++) {
+          bool cleared = i >= offset && i < offset + len;
+          ck_assert_uint_eq(buffer[i], cleared ? 0 : 0xAB);
+        }
+      }
+    }
+  }
+}
+END_TEST
+
 START_TEST(test_der_length) {
   static struct {
     const char *der;
@@ -11461,6 +12568,7 @@ Suite *test_suite(void) {
 
   tc = tcase_create("base58");
   tcase_add_test(tc, test_base58);
+  tcase_add_test(tc, test_b58enc_b58tobin);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("bignum_divmod");
@@ -11473,8 +12581,10 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_bip32_vector_3);
   tcase_add_test(tc, test_bip32_vector_4);
   tcase_add_test(tc, test_bip32_compare);
+  tcase_add_test(tc, test_bip32_public_ckd_range);
   tcase_add_test(tc, test_bip32_cache_1);
   tcase_add_test(tc, test_bip32_cache_2);
+  tcase_add_test(tc, test_bip32_cache_3);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("bip32-nist");
@@ -11511,6 +12621,7 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_tc_ecdsa_get_public_key65);
   tcase_add_test(tc, test_tc_ecdsa_recover_pub_from_sig);
   tcase_add_test(tc, test_tc_ecdsa_verify_digest);
+  tcase_add_test(tc, test_tc_ecdsa_verify_digest_batch);
   tcase_add_test(tc, test_tc_ecdh_multiply);
   tcase_add_test(tc, test_tc_ecdsa_tweak_pubkey);
   tcase_add_test(tc, test_zkp_ecdsa_get_public_key33);
@@ -11596,6 +12707,10 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_chacha_drbg);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("poly1305");
+  tcase_add_test(tc, test_poly1305);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("pbkdf2");
   tcase_add_test(tc, test_pbkdf2_hmac_sha256);
   tcase_add_test(tc, test_pbkdf2_hmac_sha512);
@@ -11611,9 +12726,13 @@ Suite *test_suite(void) {
 
   tc = tcase_create("bip39");
   tcase_add_test(tc, test_mnemonic);
+#if USE_BIP39_CACHE
+  tcase_add_test(tc, test_bip39_cache);
+#endif
   tcase_add_test(tc, test_mnemonic_check);
   tcase_add_test(tc, test_mnemonic_to_bits);
   tcase_add_test(tc, test_mnemonic_find_word);
+  tcase_add_test(tc, test_mnemonic_complete_word);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("slip39");
@@ -11622,10 +12741,12 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_slip39_word_completion_mask);
   tcase_add_test(tc, test_slip39_sequence_to_word);
   tcase_add_test(tc, test_slip39_word_completion);
+  tcase_add_test(tc, test_slip39_rs1024_checksum);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("shamir");
   tcase_add_test(tc, test_shamir);
+  tcase_add_test(tc, test_shamir_interpolate_multi);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("pubkey_validity");
@@ -11663,14 +12784,32 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_scalar_point_mult_nist256p1);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("point_jacobian");
+  tcase_add_test(tc, test_point_jacobian_secp256k1);
+  tcase_add_test(tc, test_point_jacobian_nist256p1);
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("point_multiply_double");
+  tcase_add_test(tc, test_point_multiply_double_secp256k1);
+  tcase_add_test(tc, test_point_multiply_double_nist256p1);
+  tcase_add_test(tc, test_point_multiply_glv);
+  tcase_add_test(tc, test_point_multiply_multi);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("ed25519");
   tcase_add_test(tc, test_ed25519);
+  tcase_add_test(tc, test_ed25519_sign_open_batch);
+  tcase_add_test(tc, test_ed25519_sign_open_expanded);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("ed25519_keccak");
   tcase_add_test(tc, test_ed25519_keccak);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("curve25519");
+  tcase_add_test(tc, test_curve25519_scalarmult);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("ed25519_cosi");
   tcase_add_test(tc, test_ed25519_cosi);
   suite_add_tcase(s, tc);
@@ -11681,11 +12820,12 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_ed25519_modl_sub);
   suite_add_tcase(s, tc);
 
-#if USE_MONERO
   tc = tcase_create("ed25519_ge");
+#if USE_MONERO
   tcase_add_test(tc, test_ge25519_double_scalarmult_vartime2);
-  suite_add_tcase(s, tc);
 #endif
+  tcase_add_test(tc, test_ge25519_multi_scalarmult_vartime);
+  suite_add_tcase(s, tc);
 
   tc = tcase_create("script");
   tcase_add_test(tc, test_output_script);
@@ -11721,6 +12861,10 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_rc4_rfc6229);
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("memzero");
+  tcase_add_test(tc, test_memzero);
+  suite_add_tcase(s, tc);
+
   tc = tcase_create("segwit");
   tcase_add_test(tc, test_segwit);
   suite_add_tcase(s, tc);
@@ -11736,6 +12880,7 @@ Suite *test_suite(void) {
   tc = tcase_create("zkp_bip340");
   tcase_add_test(tc, test_zkp_bip340_sign);
   tcase_add_test(tc, test_zkp_bip340_verify);
+  tcase_add_test(tc, test_zkp_bip340_verify_batch);
   tcase_add_test(tc, test_zkp_bip340_tweak);
   tcase_add_test(tc, test_zkp_bip340_verify_publickey);
   suite_add_tcase(s, tc);
@@ -11767,6 +12912,8 @@ Suite *test_suite(void) {
   tcase_add_test(tc, test_bip32_cardano_hdnode_vector_7);
   tcase_add_test(tc, test_bip32_cardano_hdnode_vector_8);
   tcase_add_test(tc, test_bip32_cardano_hdnode_vector_9);
+  tcase_add_test(tc, test_bip32_cardano_cache);
+  tcase_add_test(tc, test_cardano_icarus_incremental);
 
   tcase_add_test(tc, test_cardano_ledger_vector_1);
   tcase_add_test(tc, test_cardano_ledger_vector_2);
@@ -11801,6 +12948,7 @@ Suite *test_suite(void) {
   tc = tcase_create("xmr_xmr");
   tcase_add_test(tc, test_xmr_check_point);
   tcase_add_test(tc, test_xmr_h);
+  tcase_add_test(tc, test_xmr_scalarmult_h);
   tcase_add_test(tc, test_xmr_fast_hash);
   tcase_add_test(tc, test_xmr_hasher);
   tcase_add_test(tc, test_xmr_hash_to_scalar);
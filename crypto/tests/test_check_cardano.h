@@ -501,6 +501,92 @@ START_TEST(test_bip32_cardano_hdnode_vector_9) {
 }
 END_TEST
 
+START_TEST(test_cardano_icarus_incremental) {
+  CARDANO_ICARUS_CTX ctx;
+  uint8_t secret1[CARDANO_SECRET_LENGTH];
+  uint8_t secret2[CARDANO_SECRET_LENGTH];
+
+  uint8_t mnemonic_bits[66];
+  int mnemonic_bits_len = mnemonic_to_bits(
+      "ring crime symptom enough erupt lady behave ramp apart settle citizen "
+      "junk",
+      mnemonic_bits);
+  ck_assert_int_eq(mnemonic_bits_len, 132);
+  secret_from_entropy_cardano_icarus((const uint8_t *)"foo", 3, mnemonic_bits,
+                                     mnemonic_bits_len / 8, secret1, NULL);
+
+  // steps which cross the boundary between the two PBKDF2 blocks
+  cardano_icarus_Init(&ctx, (const uint8_t *)"foo", 3, mnemonic_bits,
+                      mnemonic_bits_len / 8);
+  uint32_t remaining = CARDANO_ICARUS_ITERATIONS;
+  uint32_t step = 1;
+  while (remaining > 0) {
+    uint32_t expected = remaining > step ? remaining - step : 0;
+    remaining = cardano_icarus_Update(&ctx, step);
+    ck_assert_uint_eq(remaining, expected);
+    step = step * 3 + 1;
+  }
+  ck_assert_uint_eq(cardano_icarus_Update(&ctx, 100), 0);
+  cardano_icarus_Final(&ctx, secret2);
+  ck_assert_mem_eq(secret1, secret2, CARDANO_SECRET_LENGTH);
+
+  // Final runs the iterations which were not done by Update
+  cardano_icarus_Init(&ctx, (const uint8_t *)"foo", 3, mnemonic_bits,
+                      mnemonic_bits_len / 8);
+  cardano_icarus_Update(&ctx, CARDANO_ICARUS_PBKDF2_ROUNDS - 1);
+  cardano_icarus_Final(&ctx, secret2);
+  ck_assert_mem_eq(secret1, secret2, CARDANO_SECRET_LENGTH);
+}
+END_TEST
+
+START_TEST(test_bip32_cardano_cache) {
+  HDNode root, node1, node2;
+  int i, r;
+
+  uint8_t mnemonic_bits[66];
+  uint8_t cardano_secret[CARDANO_SECRET_LENGTH];
+  int mnemonic_bits_len = mnemonic_to_bits(
+      "ring crime symptom enough erupt lady behave ramp apart settle citizen "
+      "junk",
+      mnemonic_bits);
+  ck_assert_int_eq(mnemonic_bits_len, 132);
+  secret_from_entropy_cardano_icarus((const uint8_t *)"", 0, mnemonic_bits,
+                                     mnemonic_bits_len / 8, cardano_secret,
+                                     NULL);
+  hdnode_from_secret_cardano(cardano_secret, &root);
+
+  // m/1852'/1815'/0'/0/i, all but the first derivation hit the cache
+  uint32_t ii[] = {0x8000073c, 0x80000717, 0x80000000, 0, 0};
+  for (i = 0; i < 4; i++) {
+    ii[4] = i;
+    memcpy(&node1, &root, sizeof(HDNode));
+    memcpy(&node2, &root, sizeof(HDNode));
+    for (int j = 0; j < 5; j++) {
+      r = hdnode_private_ckd(&node1, ii[j]);
+      ck_assert_int_eq(r, 1);
+    }
+    r = hdnode_private_ckd_cached(&node2, ii, 5, NULL);
+    ck_assert_int_eq(r, 1);
+    ck_assert_mem_eq(&node1, &node2, sizeof(HDNode));
+  }
+
+  // parent path longer than BIP32_CACHE_MAXDEPTH
+  uint32_t deep[BIP32_CACHE_MAXDEPTH + 2] = {0};
+  for (i = 0; i < BIP32_CACHE_MAXDEPTH + 2; i++) {
+    deep[i] = 0x80000000 + i;
+  }
+  memcpy(&node1, &root, sizeof(HDNode));
+  memcpy(&node2, &root, sizeof(HDNode));
+  for (i = 0; i < BIP32_CACHE_MAXDEPTH + 2; i++) {
+    r = hdnode_private_ckd(&node1, deep[i]);
+    ck_assert_int_eq(r, 1);
+  }
+  r = hdnode_private_ckd_cached(&node2, deep, BIP32_CACHE_MAXDEPTH + 2, NULL);
+  ck_assert_int_eq(r, 1);
+  ck_assert_mem_eq(&node1, &node2, sizeof(HDNode));
+}
+END_TEST
+
 START_TEST(test_cardano_ledger_vector_1) {
   uint8_t seed[512 / 8];
   uint8_t cardano_secret[CARDANO_SECRET_LENGTH];
@@ -613,6 +613,31 @@ START_TEST(test_xmr_h) {
 }
 END_TEST
 
+START_TEST(test_xmr_scalarmult_h) {
+  bignum256modm a, b;
+  ge25519 P1, P2;
+
+  for (int i = 0; i < 16; i++) {
+    xmr_random_scalar(a);
+    if (i == 0) {
+      set256_modm(a, 0);
+    } else if (i == 1) {
+      set256_modm(a, 1);
+    }
+    xmr_scalarmult_h(&P1, a);
+    ge25519_scalarmult(&P2, &xmr_h, a);
+    ck_assert_int_eq(ge25519_eq(&P1, &P2), 1);
+
+    // C = aG + bH
+    uint64_t amount = i == 2 ? UINT64_MAX : 1000000000ull * i;
+    set256_modm(b, amount);
+    xmr_gen_c(&P1, a, amount);
+    xmr_add_keys2(&P2, a, b, &xmr_h);
+    ck_assert_int_eq(ge25519_eq(&P1, &P2), 1);
+  }
+}
+END_TEST
+
 START_TEST(test_xmr_fast_hash) {
   uint8_t hash[32];
   char tests[][2][65] = {
@@ -1126,6 +1151,14 @@ START_TEST(test_xmr_varint) {
     read = xmr_read_varint(buff, sizeof(buff), &val);
     ck_assert_int_eq(read, written);
     ck_assert(tests[i].x == val);
+
+    Hasher hasher;
+    uint8_t hash[SHA3_256_DIGEST_LENGTH], expected[SHA3_256_DIGEST_LENGTH];
+    xmr_hasher_init(&hasher);
+    xmr_hasher_update_varint(&hasher, tests[i].x);
+    xmr_hasher_final(&hasher, hash);
+    keccak_256(buff, written, expected);
+    ck_assert_mem_eq(hash, expected, SHA3_256_DIGEST_LENGTH);
   }
 }
 END_TEST
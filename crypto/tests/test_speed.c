@@ -1,22 +1,123 @@
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include "aes/aes.h"
 #include "bip32.h"
+#include "blake2b.h"
+#include "blake2s.h"
+#include "chacha20poly1305/rfc7539.h"
 #include "curves.h"
 #include "ecdsa.h"
 #include "ed25519-donna/ed25519.h"
+#include "groestl.h"
 #include "hasher.h"
 #include "nist256p1.h"
+#include "pbkdf2.h"
+#include "ripemd160.h"
 #include "secp256k1.h"
+#include "sha2.h"
+#include "sha3.h"
 
 static uint8_t msg[256];
 
+// input of the hashes and ciphers, which are measured per byte
+static uint8_t data[4096];
+
 void prepare_msg(void) {
   for (size_t i = 0; i < sizeof(msg); i++) {
     msg[i] = i * 1103515245;
   }
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = i * 1103515245;
+  }
+}
+
+void bench_sha256(int iterations) {
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    sha256_Raw(data, sizeof(data), digest);
+  }
+}
+
+void bench_sha512(int iterations) {
+  uint8_t digest[SHA512_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    sha512_Raw(data, sizeof(data), digest);
+  }
+}
+
+void bench_sha3_256(int iterations) {
+  uint8_t digest[SHA3_256_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    sha3_256(data, sizeof(data), digest);
+  }
+}
+
+void bench_blake2b(int iterations) {
+  uint8_t digest[32];
+  for (int i = 0; i < iterations; i++) {
+    blake2b(data, sizeof(data), digest, sizeof(digest));
+  }
+}
+
+void bench_blake2s(int iterations) {
+  uint8_t digest[32];
+  for (int i = 0; i < iterations; i++) {
+    blake2s(data, sizeof(data), digest, sizeof(digest));
+  }
+}
+
+void bench_groestl512(int iterations) {
+  GROESTL512_CTX ctx;
+  uint8_t digest[64];
+  for (int i = 0; i < iterations; i++) {
+    groestl512_Init(&ctx);
+    groestl512_Update(&ctx, data, sizeof(data));
+    groestl512_Final(&ctx, digest);
+  }
+}
+
+void bench_ripemd160(int iterations) {
+  uint8_t digest[RIPEMD160_DIGEST_LENGTH];
+  for (int i = 0; i < iterations; i++) {
+    ripemd160(data, sizeof(data), digest);
+  }
+}
+
+void bench_chacha20poly1305(int iterations) {
+  static uint8_t out[sizeof(data)];
+  chacha20poly1305_ctx ctx;
+  uint8_t key[32] = {0}, nonce[12] = {0}, tag[16];
+  for (int i = 0; i < iterations; i++) {
+    rfc7539_init(&ctx, key, nonce);
+    chacha20poly1305_encrypt(&ctx, data, out, sizeof(data));
+    rfc7539_finish(&ctx, 0, sizeof(data), tag);
+  }
+}
+
+void bench_aes256_cbc(int iterations) {
+  static uint8_t out[sizeof(data)];
+  aes_encrypt_ctx ctx;
+  uint8_t key[32] = {0}, iv[AES_BLOCK_SIZE];
+  aes_encrypt_key256(key, &ctx);
+  for (int i = 0; i < iterations; i++) {
+    memset(iv, 0, sizeof(iv));
+    aes_cbc_encrypt(data, out, sizeof(data), iv, &ctx);
+  }
+}
+
+// one derivation of the given number of iterations
+void bench_pbkdf2_hmac_sha256(int iterations) {
+  uint8_t key[32];
+  pbkdf2_hmac_sha256(msg, 32, msg + 32, 16, iterations, key, sizeof(key));
+}
+
+void bench_pbkdf2_hmac_sha512(int iterations) {
+  uint8_t key[64];
+  pbkdf2_hmac_sha512(msg, 32, msg + 32, 16, iterations, key, sizeof(key));
 }
 
 void bench_sign_secp256k1(int iterations) {
@@ -186,18 +287,56 @@ void bench_ckd(int iterations) {
   }
 }
 
-void bench(void (*func)(int), const char *name, int iterations) {
-  clock_t t = clock();
+static bool json = false;
+static bool first = true;
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// bytes is the number of bytes processed by one iteration, 0 for operations
+void bench(void (*func)(int), const char *name, int iterations,
+           size_t bytes) {
+  double t = now();
   func(iterations);
-  float speed = iterations / ((float)(clock() - t) / CLOCKS_PER_SEC);
-  printf("%25s: %8.2f ops/s\n", name, speed);
+  t = now() - t;
+  double speed = iterations / t;
+  if (json) {
+    printf("%s\n  {\"name\": \"%s\", \"iterations\": %d, \"seconds\": %.6f, "
+           "\"ops_per_second\": %.2f, \"bytes_per_second\": %.0f}",
+           first ? "[" : ",", name, iterations, t, speed, speed * bytes);
+    first = false;
+  } else if (bytes > 0) {
+    printf("%25s: %8.2f MB/s\n", name, speed * bytes / 1e6);
+  } else {
+    printf("%25s: %8.2f ops/s\n", name, speed);
+  }
 }
 
-#define BENCH(FUNC, ITER) bench(FUNC, #FUNC, ITER)
+#define BENCH(FUNC, ITER) bench(FUNC, #FUNC, ITER, 0)
+#define BENCH_BYTES(FUNC, ITER) bench(FUNC, #FUNC, ITER, sizeof(data))
+
+int main(int argc, char **argv) {
+  json = argc > 1 && strcmp(argv[1], "--json") == 0;
 
-int main(void) {
   prepare_msg();
 
+  BENCH_BYTES(bench_sha256, 2000);
+  BENCH_BYTES(bench_sha512, 2000);
+  BENCH_BYTES(bench_sha3_256, 1000);
+  BENCH_BYTES(bench_blake2b, 2000);
+  BENCH_BYTES(bench_blake2s, 2000);
+  BENCH_BYTES(bench_groestl512, 500);
+  BENCH_BYTES(bench_ripemd160, 2000);
+  BENCH_BYTES(bench_chacha20poly1305, 2000);
+  BENCH_BYTES(bench_aes256_cbc, 1000);
+
+  // iterations per second
+  BENCH(bench_pbkdf2_hmac_sha256, 100000);
+  BENCH(bench_pbkdf2_hmac_sha512, 50000);
+
   BENCH(bench_sign_secp256k1, 500);
   BENCH(bench_verify_secp256k1_33, 500);
   BENCH(bench_verify_secp256k1_65, 500);
@@ -215,5 +354,9 @@ int main(void) {
 
   BENCH(bench_ckd, 1000);
 
+  if (json) {
+    printf("\n]\n");
+  }
+
   return 0;
 }
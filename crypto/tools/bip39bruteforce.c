@@ -1,22 +1,22 @@
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/wait.h>
 #include <time.h>
+#include <unistd.h>
 #include "bip32.h"
 #include "bip39.h"
 #include "curves.h"
 #include "ecdsa.h"
 #include "secp256k1.h"
 
-char iter[256];
-uint8_t seed[512 / 8];
-char addr[MAX_ADDR_SIZE];
-int count = 0, found = 0;
-HDNode node;
-clock_t start;
-
 #define ACCOUNT_LEGACY 0
 
-// around 280 tries per second
+// around 280 tries per second and worker
 
 // testing data:
 //
@@ -30,15 +30,105 @@ clock_t start;
 //             segwit: "3NcXPfbDP4UHSbuHASALJEBtDeAcWYMMcS"
 // passphrase: "testing"
 
+#define MAX_WORKERS 256
+// number of candidates which may be tried ahead of the first unfinished one,
+// this bounds the state needed for the checkpoints
+#define WINDOW 4096
+// seconds between two checkpoints
+#define CHECKPOINT_INTERVAL 60
+
+// The library keeps some temporaries in static variables, so the workers are
+// processes instead of threads. They read the candidates from a shared pipe
+// and report the results to another one, the records are shorter than PIPE_BUF
+// so the reads and writes are atomic.
+typedef struct {
+  uint64_t index;
+  bool found;
+  char candidate[256];
+} record_t;
+
+static const char *address, *mnemonic;
+
+static bool try_candidate(const char *candidate) {
+  uint8_t seed[512 / 8];
+  char addr[MAX_ADDR_SIZE];
+  HDNode node;
+
+  if (mnemonic) {
+    mnemonic_to_seed(mnemonic, candidate, seed, NULL);
+  } else {
+    mnemonic_to_seed(candidate, "", seed, NULL);
+  }
+  hdnode_from_seed(seed, 512 / 8, SECP256K1_NAME, &node);
+#if ACCOUNT_LEGACY
+  hdnode_private_ckd_prime(&node, 44);
+#else
+  hdnode_private_ckd_prime(&node, 49);
+#endif
+  hdnode_private_ckd_prime(&node, 0);
+  hdnode_private_ckd_prime(&node, 0);
+  hdnode_private_ckd(&node, 0);
+  hdnode_private_ckd(&node, 0);
+  hdnode_fill_public_key(&node);
+#if ACCOUNT_LEGACY
+  // Legacy address
+  ecdsa_get_address(node.public_key, 0, HASHER_SHA2_RIPEMD, HASHER_SHA2D, addr,
+                    sizeof(addr));
+#else
+  // Segwit-in-P2SH
+  ecdsa_get_address_segwit_p2sh(node.public_key, 5, HASHER_SHA2_RIPEMD,
+                                HASHER_SHA2D, addr, sizeof(addr));
+#endif
+  return strcmp(address, addr) == 0;
+}
+
+static void worker(int tasks, int results) {
+  record_t record;
+  while (read(tasks, &record, sizeof(record)) == sizeof(record)) {
+    record.found = try_candidate(record.candidate);
+    if (write(results, &record, sizeof(record)) != sizeof(record)) {
+      break;
+    }
+  }
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void usage(void) {
+  fprintf(stderr,
+          "Usage: bip39bruteforce [-j workers] [-s skip] address "
+          "[mnemonic]\n");
+  exit(1);
+}
+
 int main(int argc, char **argv) {
-  if (argc != 2 && argc != 3) {
-    fprintf(stderr, "Usage: bip39bruteforce address [mnemonic]\n");
-    return 1;
+  long workers = sysconf(_SC_NPROCESSORS_ONLN);
+  uint64_t skip = 0;
+  int opt;
+  while ((opt = getopt(argc, argv, "j:s:")) != -1) {
+    if (opt == 'j') {
+      workers = strtol(optarg, NULL, 10);
+      if (workers <= 0) usage();
+    } else if (opt == 's') {
+      skip = strtoull(optarg, NULL, 10);
+    } else {
+      usage();
+    }
+  }
+  if (argc - optind != 1 && argc - optind != 2) {
+    usage();
   }
-  const char *address = argv[1];
-  const char *mnemonic, *item;
-  if (argc == 3) {
-    mnemonic = argv[2];
+  if (workers < 1) workers = 1;
+  if (workers > MAX_WORKERS) workers = MAX_WORKERS;
+
+  address = argv[optind];
+  const char *item;
+  if (argc - optind == 2) {
+    mnemonic = argv[optind + 1];
     item = "passphrase";
   } else {
     mnemonic = NULL;
@@ -48,51 +138,121 @@ int main(int argc, char **argv) {
     fprintf(stderr, "\"%s\" is not a valid mnemonic\n", mnemonic);
     return 2;
   }
-  printf("Reading %ss from stdin ...\n", item);
-  start = clock();
-  for (;;) {
-    if (fgets(iter, 256, stdin) == NULL) break;
-    int len = strlen(iter);
-    if (len <= 0) {
-      continue;
+
+  int tasks[2], results[2];
+  pid_t pids[MAX_WORKERS];
+  if (pipe(tasks) != 0 || pipe(results) != 0) {
+    perror("pipe");
+    return 1;
+  }
+  for (long w = 0; w < workers; w++) {
+    pids[w] = fork();
+    if (pids[w] < 0) {
+      perror("fork");
+      return 1;
     }
-    count++;
-    iter[len - 1] = 0;
-    if (mnemonic) {
-      mnemonic_to_seed(mnemonic, iter, seed, NULL);
-    } else {
-      mnemonic_to_seed(iter, "", seed, NULL);
+    if (pids[w] == 0) {
+      close(tasks[1]);
+      close(results[0]);
+      worker(tasks[0], results[1]);
+      _exit(0);
     }
-    hdnode_from_seed(seed, 512 / 8, SECP256K1_NAME, &node);
-#if ACCOUNT_LEGACY
-    hdnode_private_ckd_prime(&node, 44);
-#else
-    hdnode_private_ckd_prime(&node, 49);
-#endif
-    hdnode_private_ckd_prime(&node, 0);
-    hdnode_private_ckd_prime(&node, 0);
-    hdnode_private_ckd(&node, 0);
-    hdnode_private_ckd(&node, 0);
-    hdnode_fill_public_key(&node);
-#if ACCOUNT_LEGACY
-    // Legacy address
-    ecdsa_get_address(node.public_key, 0, HASHER_SHA2_RIPEMD, HASHER_SHA2D,
-                      addr, sizeof(addr));
-#else
-    // Segwit-in-P2SH
-    ecdsa_get_address_segwit_p2sh(node.public_key, 5, HASHER_SHA2_RIPEMD,
-                                  HASHER_SHA2D, addr, sizeof(addr));
-#endif
-    if (strcmp(address, addr) == 0) {
-      found = 1;
-      break;
+  }
+  close(tasks[0]);
+  close(results[1]);
+
+  printf("Reading %ss from stdin with %ld workers ...\n", item, workers);
+  fflush(stdout);
+
+  record_t record;
+  uint64_t index = 0;
+  while (index < skip && fgets(record.candidate, sizeof(record.candidate),
+                               stdin) != NULL) {
+    index++;
+  }
+
+  // done[i % WINDOW] tells whether candidate i, first <= i < next, is tried
+  static bool done[WINDOW];
+  uint64_t first = index, next = index, count = 0;
+  bool eof = false, found = false;
+  double start = now(), checkpoint = start;
+
+  while (!found && (!eof || first < next)) {
+    struct pollfd fds[2] = {{.fd = results[0], .events = POLLIN},
+                            {.fd = tasks[1], .events = 0}};
+    if (!eof && next - first < WINDOW) {
+      fds[1].events = POLLOUT;
+    }
+    if (poll(fds, 2, -1) < 0) {
+      perror("poll");
+      return 1;
+    }
+
+    if (fds[0].revents & POLLIN) {
+      if (read(results[0], &record, sizeof(record)) != sizeof(record)) {
+        fprintf(stderr, "A worker failed\n");
+        return 1;
+      }
+      count++;
+      if (record.found) {
+        found = true;
+        break;
+      }
+      done[record.index % WINDOW] = true;
+      while (first < next && done[first % WINDOW]) {
+        done[first % WINDOW] = false;
+        first++;
+      }
+    } else if (fds[0].revents & (POLLERR | POLLHUP)) {
+      fprintf(stderr, "A worker failed\n");
+      return 1;
+    }
+
+    if (fds[1].revents & POLLOUT) {
+      if (fgets(record.candidate, sizeof(record.candidate), stdin) == NULL) {
+        eof = true;
+        close(tasks[1]);
+        continue;
+      }
+      size_t len = strcspn(record.candidate, "\r\n");
+      record.candidate[len] = 0;
+      if (len == 0) {
+        // an empty line is skipped but still counts for the checkpoints
+        done[next % WINDOW] = true;
+        if (first == next) {
+          done[next % WINDOW] = false;
+          first++;
+        }
+        next++;
+        continue;
+      }
+      record.index = next++;
+      record.found = false;
+      if (write(tasks[1], &record, sizeof(record)) != sizeof(record)) {
+        perror("write");
+        return 1;
+      }
+    }
+
+    if (now() - checkpoint >= CHECKPOINT_INTERVAL) {
+      checkpoint = now();
+      fprintf(stderr,
+              "Tried %" PRIu64 " %ss, resume with -s %" PRIu64 "\n", count,
+              item, first);
     }
   }
-  float dur = (float)(clock() - start) / CLOCKS_PER_SEC;
-  printf("Tried %d %ss in %f seconds = %f tries/second\n", count, item, dur,
-         (float)count / dur);
+
+  for (long w = 0; w < workers; w++) {
+    kill(pids[w], SIGTERM);
+  }
+  while (wait(NULL) > 0) {
+  }
+
+  double dur = now() - start;
+  printf("Tried %" PRIu64 " %ss in %f seconds = %f tries/second\n", count,
+         item, dur, count / dur);
   if (found) {
-    printf("Correct %s found! :-)\n\"%s\"\n", item, iter);
+    printf("Correct %s found! :-)\n\"%s\"\n", item, record.candidate);
     return 0;
   }
   printf("Correct %s not found. :-(\n", item);
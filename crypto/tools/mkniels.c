@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <string.h>
+#include "ed25519-donna/ed25519-donna.h"
+#include "monero/xmr.h"
+
+/*
+ * This program prints a table of multiples of an ed25519 point P for
+ * ge25519_scalarmult_base_niels.
+ * The entry table[8*i+j] contains the number (j+1)*256^i*P in packed
+ * {y-x, y+x, 2*d*x*y} form, the first row has 2*x*y instead of 2*d*x*y.
+ * With "basepoint" it prints ge25519_niels_base_multiples, with "xmr_h" the
+ * table of the Monero generator H included in xmr.c.
+ */
+
+static void print_niels(const ge25519 *p, int i) {
+  bignum25519 zi, x, y, t;
+  unsigned char packed[96];
+  curve25519_recip(zi, p->z);
+  curve25519_mul(x, p->x, zi);
+  curve25519_mul(y, p->y, zi);
+  curve25519_sub_reduce(t, y, x);
+  curve25519_contract(packed, t);
+  curve25519_add_reduce(t, y, x);
+  curve25519_contract(packed + 32, t);
+  curve25519_mul(t, x, y);
+  if (i == 0) {
+    // ge25519_scalarmult_base_niels starts from an entry of the first row and
+    // multiplies their 2*x*y by d when adding them
+    curve25519_add_reduce(t, t, t);
+  } else {
+    curve25519_mul(t, t, ge25519_ec2d);
+  }
+  curve25519_contract(packed + 64, t);
+  printf("\t{");
+  for (int k = 0; k < 96; k++) {
+    printf((k < 95 ? "0x%02x," : "0x%02x"), packed[k]);
+  }
+  printf("},\n");
+}
+
+int main(int argc, char **argv) {
+  ge25519 pow256ip, np;
+  if (argc != 2) {
+    printf("Usage: %s basepoint|xmr_h\n", argv[0]);
+    return 1;
+  }
+  if (strcmp(argv[1], "basepoint") == 0) {
+    ge25519_copy(&pow256ip, &ge25519_basepoint);
+  } else if (strcmp(argv[1], "xmr_h") == 0) {
+    ge25519_copy(&pow256ip, &xmr_h);
+  } else {
+    printf("Unknown point '%s'\n", argv[1]);
+    return 1;
+  }
+
+  for (int i = 0; i < 32; i++) {
+    // invariants:
+    //   pow256ip = 256^i * P
+    //   np       = (j+1) * 256^i * P
+    ge25519_copy(&np, &pow256ip);
+    for (int j = 0; j < 8; j++) {
+      print_niels(&np, i);
+      ge25519_add(&np, &np, &pow256ip, 0);
+    }
+    for (int k = 0; k < 8; k++) {
+      ge25519_double(&pow256ip, &pow256ip);
+    }
+  }
+  return 0;
+}
@@ -1,5 +1,7 @@
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "bignum.h"
 #include "bip32.h"
 #include "ecdsa.h"
@@ -7,13 +9,38 @@
 
 /*
  * This program prints the contents of the ecdsa_curve.cp array.
- * The entry cp[i][j] contains the number (2*j+1)*16^i*G,
- * where G is the generator of the specified elliptic curve.
+ * The entry cp[i][j] contains the number (2*j+1)*(2^w)^i*G,
+ * where G is the generator of the specified elliptic curve and w is the
+ * window width (PRECOMPUTED_CP_WINDOW, 4 by default).
+ * With "packed" the coordinates are printed as big-endian bytes
+ * (USE_PRECOMPUTED_CP_PACKED).
  */
+
+static void print_coordinate(const bignum256 *x, int packed) {
+  int k;
+  if (packed) {
+    uint8_t bytes[32];
+    bn_write_be(x, bytes);
+    printf("{");
+    for (k = 0; k < 32; k++) {
+      printf((k < 31 ? "0x%02x, " : "0x%02x"), bytes[k]);
+    }
+    printf("}");
+  } else {
+    printf("{{");
+    for (k = 0; k < 9; k++) {
+      printf((k < 8 ? "0x%08x, " : "0x%04x"), x->val[k]);
+    }
+    printf("}}");
+  }
+}
+
 int main(int argc, char **argv) {
-  int i, j, k;
-  if (argc != 2) {
-    printf("Usage: %s CURVE_NAME\n", argv[0]);
+  int i, j;
+  int window = 4, packed = 0;
+  if (argc < 2 || argc > 4 ||
+      (argc == 4 && strcmp(argv[3], "packed") != 0)) {
+    printf("Usage: %s CURVE_NAME [WINDOW [packed]]\n", argv[0]);
     return 1;
   }
   const char *name = argv[1];
@@ -27,42 +54,56 @@ int main(int argc, char **argv) {
     printf("Unknown curve params");
     return 1;
   }
+  if (argc >= 3) {
+    window = atoi(argv[2]);
+    if (window < 2 || window > 8) {
+      printf("WINDOW must be between 2 and 8\n");
+      return 1;
+    }
+  }
+  packed = (argc == 4);
+  int rows = (256 + window - 1) / window;
+  int cols = 1 << (window - 1);
+
+  // the table is included in the initializer of the curve, make sure it
+  // matches the layout the curve is compiled with
+  printf("#if PRECOMPUTED_CP_WINDOW != %d || USE_PRECOMPUTED_CP_PACKED != %d\n",
+         window, packed);
+  printf("#error \"%s.table was generated for a different layout\"\n", name);
+  printf("#endif\n");
 
   curve_point ng = curve->G;
   curve_point pow2ig = curve->G;
-  for (i = 0; i < 64; i++) {
+  for (i = 0; i < rows; i++) {
     // invariants:
-    //   pow2ig = 16^i * G
+    //   pow2ig = (2^w)^i * G
     //   ng     = pow2ig
     printf("\t{\n");
-    for (j = 0; j < 8; j++) {
+    for (j = 0; j < cols; j++) {
       // invariants:
-      //   pow2ig = 16^i * G
-      //   ng     = (2*j+1) * 16^i * G
+      //   pow2ig = (2^w)^i * G
+      //   ng     = (2*j+1) * (2^w)^i * G
 #ifndef NDEBUG
       curve_point checkresult;
       bignum256 a;
-      bn_zero(&a);
-      a.val[(4 * i) / BN_BITS_PER_LIMB] = ((uint32_t)2 * j + 1)
-                                          << ((4 * i) % BN_BITS_PER_LIMB);
-      bn_normalize(&a);
+      bn_read_uint32(2 * j + 1, &a);
+      for (int k = 0; k < window * i; k++) {
+        bn_lshift(&a);
+        bn_mod(&a, &curve->order);
+      }
       point_multiply(curve, &a, &curve->G, &checkresult);
       assert(point_is_equal(&checkresult, &ng));
 #endif
-      printf("\t\t/* %2d*16^%d*G: */\n\t\t{{{", 2 * j + 1, i);
+      printf("\t\t/* %2d*%d^%d*G: */\n\t\t{", 2 * j + 1, 1 << window, i);
       // print x coordinate
-      for (k = 0; k < 9; k++) {
-        printf((k < 8 ? "0x%08x, " : "0x%04x"), ng.x.val[k]);
-      }
-      printf("}},\n\t\t {{");
+      print_coordinate(&ng.x, packed);
+      printf(",\n\t\t ");
       // print y coordinate
-      for (k = 0; k < 9; k++) {
-        printf((k < 8 ? "0x%08x, " : "0x%04x"), ng.y.val[k]);
-      }
-      if (j == 7) {
-        printf("}}}\n\t},\n");
+      print_coordinate(&ng.y, packed);
+      if (j == cols - 1) {
+        printf("}\n\t},\n");
       } else {
-        printf("}}},\n");
+        printf("},\n");
         point_add(curve, &pow2ig, &ng);
       }
       point_add(curve, &pow2ig, &ng);
@@ -1,48 +1,139 @@
 #include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "bip32.h"
 #include "curves.h"
 #include "ecdsa.h"
 
 #define VERSION_PUBLIC 0x0488b21e
 
-void process_job(uint32_t jobid, const char *xpub, uint32_t change,
-                 uint32_t from, uint32_t to) {
-  HDNode node, child;
+// number of consecutive addresses derived by a worker at once
+#define RANGE_SIZE 64
+#define MAX_WORKERS 256
+
+// The library keeps some temporaries in static variables, so the workers are
+// processes instead of threads. They read the ranges from a shared pipe and
+// write the lines of a range to stdout at once. Both a range and its lines are
+// shorter than PIPE_BUF, so the reads and writes are atomic.
+typedef struct {
+  uint32_t jobid;
+  uint32_t from;
+  uint32_t count;
+  HDNode node;
+} range_t;
+
+static void write_output(const char *output, size_t len) {
+  while (len > 0) {
+    ssize_t r = write(STDOUT_FILENO, output, len);
+    if (r <= 0) {
+      exit(1);
+    }
+    output += r;
+    len -= r;
+  }
+}
+
+static void worker(int fd) {
+  range_t range;
+  HDNode children[RANGE_SIZE];
+  // "<jobid> <index> <address>\n" for all addresses of a range
+  char output[RANGE_SIZE * (10 + 1 + 10 + 1 + 35 + 1)];
+  char address[36];
+
+  while (read(fd, &range, sizeof(range)) == sizeof(range)) {
+    size_t len = 0;
+    if (!hdnode_public_ckd_range(&range.node, range.from, range.count,
+                                 children)) {
+      len = sprintf(output, "%" PRIu32 " error\n", range.jobid);
+    } else {
+      for (uint32_t k = 0; k < range.count; k++) {
+        ecdsa_get_address(children[k].public_key, 0, HASHER_SHA2,
+                          HASHER_SHA2D, address, sizeof(address));
+        len += sprintf(output + len, "%" PRIu32 " %" PRIu32 " %s\n",
+                       range.jobid, range.from + k, address);
+      }
+    }
+    write_output(output, len);
+  }
+}
+
+static void process_job(int fd, uint32_t jobid, const char *xpub,
+                        uint32_t change, uint32_t from, uint32_t to) {
+  range_t range;
+  memset(&range, 0, sizeof(range));
   if (change > 1 || to <= from ||
-      hdnode_deserialize_public(xpub, VERSION_PUBLIC, SECP256K1_NAME, &node,
-                                NULL) != 0) {
-    printf("%d error\n", jobid);
+      hdnode_deserialize_public(xpub, VERSION_PUBLIC, SECP256K1_NAME,
+                                &range.node, NULL) != 0) {
+    char output[32];
+    write_output(output, sprintf(output, "%" PRIu32 " error\n", jobid));
     return;
   }
-  hdnode_public_ckd(&node, change);
-  uint32_t i;
-  char address[36];
-  for (i = from; i < to; i++) {
-    memcpy(&child, &node, sizeof(HDNode));
-    hdnode_public_ckd(&child, i);
-    ecdsa_get_address(child.public_key, 0, HASHER_SHA2, HASHER_SHA2D, address,
-                      sizeof(address));
-    printf("%d %d %s\n", jobid, i, address);
+  hdnode_public_ckd(&range.node, change);
+  range.jobid = jobid;
+  for (uint32_t i = from; i < to; i += range.count) {
+    range.from = i;
+    range.count = to - i < RANGE_SIZE ? to - i : RANGE_SIZE;
+    if (write(fd, &range, sizeof(range)) != sizeof(range)) {
+      exit(1);
+    }
   }
 }
 
-int main(void) {
+int main(int argc, char **argv) {
   char line[1024], xpub[1024];
   uint32_t jobid, change, from, to;
   int r;
+  long workers = sysconf(_SC_NPROCESSORS_ONLN);
+  if (argc > 2 || (argc == 2 && (workers = strtol(argv[1], NULL, 10)) <= 0)) {
+    fprintf(stderr, "Usage: %s [workers]\n", argv[0]);
+    return 1;
+  }
+  if (workers < 1) {
+    workers = 1;
+  }
+  if (workers > MAX_WORKERS) {
+    workers = MAX_WORKERS;
+  }
+
+  int fds[2];
+  if (pipe(fds) != 0) {
+    perror("pipe");
+    return 1;
+  }
+  for (long w = 0; w < workers; w++) {
+    pid_t pid = fork();
+    if (pid < 0) {
+      perror("fork");
+      return 1;
+    }
+    if (pid == 0) {
+      close(fds[1]);
+      worker(fds[0]);
+      _exit(0);
+    }
+  }
+  close(fds[0]);
+
   for (;;) {
     if (!fgets(line, sizeof(line), stdin)) break;
     r = sscanf(line, "%u %s %u %u %u\n", &jobid, xpub, &change, &from, &to);
     if (r < 1) {
-      printf("error\n");
+      write_output("error\n", 6);
     } else if (r != 5) {
-      printf("%d error\n", jobid);
+      char output[32];
+      write_output(output, sprintf(output, "%" PRIu32 " error\n", jobid));
     } else {
-      process_job(jobid, xpub, change, from, to);
+      process_job(fds[1], jobid, xpub, change, from, to);
     }
   }
+
+  // the workers exit once the pipe is empty and closed
+  close(fds[1]);
+  while (wait(NULL) > 0) {
+  }
   return 0;
 }
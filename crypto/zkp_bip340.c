@@ -23,7 +23,10 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "ecdsa.h"
 #include "memzero.h"
+#include "rand.h"
+#include "secp256k1.h"
 #include "sha2.h"
 #include "zkp_context.h"
 
@@ -39,6 +42,12 @@ const uint32_t sha256_initial_taptweak_state[8] = {
     0x95f4e232UL, 0x94fd54f4UL, 0xa2ae8d85UL, 0x47ca590bUL,
 };
 
+// Initial hash value H for SHA-256 BIP0340/challenge:
+static const uint32_t sha256_initial_challenge_state[8] = {
+    0x9cecba11UL, 0x23925381UL, 0x11679112UL, 0xd1627e0fUL,
+    0x97c87550UL, 0x003cc765UL, 0x90f61164UL, 0x33e9b66aUL,
+};
+
 // BIP340 Schnorr public key derivation
 // private_key_bytes has 32 bytes
 // public_key_bytes has 32 bytes
@@ -54,11 +63,6 @@ int zkp_bip340_get_public_key(const uint8_t *private_key_bytes,
       result = -1;
     }
   }
-  if (result == 0) {
-    if (secp256k1_context_writable_randomize(context_writable) != 0) {
-      result = -1;
-    }
-  }
 
   secp256k1_pubkey public_key = {0};
   if (result == 0) {
@@ -115,11 +119,6 @@ int zkp_bip340_sign_digest(const uint8_t *private_key_bytes,
       result = -1;
     }
   }
-  if (result == 0) {
-    if (secp256k1_context_writable_randomize(context_writable) != 0) {
-      result = -1;
-    }
-  }
 
   secp256k1_keypair keypair = {0};
   if (result == 0) {
@@ -205,6 +204,121 @@ int zkp_bip340_verify_publickey(const uint8_t *public_key_bytes) {
   return result;
 }
 
+// Checks that count <= BIP340_VERIFY_BATCH_SIZE signatures are all valid
+// using the randomized batch equation of BIP340
+//   (a_0 s_0 + ... + a_{n-1} s_{n-1}) G - a_0 R_0 - ... - a_{n-1} R_{n-1}
+//     - a_0 e_0 P_0 - ... - a_{n-1} e_{n-1} P_{n-1} = 0
+// where a_0 = 1 and a_1, ..., a_{n-1} are random 128-bit numbers
+// returns 0 if the equation holds, 1 otherwise
+static int bip340_verify_chunk(size_t count,
+                               const uint8_t *const *public_keys,
+                               const uint8_t *const *signatures,
+                               const uint8_t *const *digests) {
+  const ecdsa_curve *curve = &secp256k1;
+  bignum256 k[1 + 2 * BIP340_VERIFY_BATCH_SIZE] = {0};
+  curve_point p[1 + 2 * BIP340_VERIFY_BATCH_SIZE] = {0};
+  curve_point res = {0};
+  uint8_t point_bytes[33] = {0x02};
+  uint8_t a_bytes[32] = {0};
+  uint8_t e_bytes[32] = {0};
+  bignum256 a = {0}, s = {0}, e = {0};
+  SHA256_CTX ctx = {0};
+
+  // p[0] = G, p[1 + i] = -P_i and p[1 + count + i] = -R_i
+  // The R_i come last since their scalars a_i only have 128 bits, so the
+  // chunks of point_multiply_multi made of them need only half the doublings.
+  p[0] = curve->G;
+  bn_zero(&k[0]);
+  for (size_t i = 0; i < count; i++) {
+    memcpy(point_bytes + 1, public_keys[i], 32);
+    if (!ecdsa_read_pubkey(curve, point_bytes, &p[1 + i])) {
+      return 1;
+    }
+    memcpy(point_bytes + 1, signatures[i], 32);
+    if (!ecdsa_read_pubkey(curve, point_bytes, &p[1 + count + i])) {
+      return 1;
+    }
+    bn_read_be(signatures[i] + 32, &s);
+    if (!bn_is_less(&s, &curve->order)) {
+      return 1;
+    }
+
+    // e = int(hash_BIP0340/challenge(bytes(r) || bytes(P) || m)) mod n
+    sha256_Init_ex(&ctx, sha256_initial_challenge_state, 512);
+    sha256_Update(&ctx, signatures[i], 32);
+    sha256_Update(&ctx, public_keys[i], 32);
+    sha256_Update(&ctx, digests[i], 32);
+    sha256_Final(&ctx, e_bytes);
+    bn_read_be(e_bytes, &e);
+    bn_mod(&e, &curve->order);
+
+    if (i == 0) {
+      bn_one(&a);
+    } else {
+      random_buffer(a_bytes + 16, 16);
+      a_bytes[31] |= 1;
+      bn_read_be(a_bytes, &a);
+    }
+
+    // k[0] += a * s
+    bn_multiply(&a, &s, &curve->order);
+    bn_addmod(&k[0], &s, &curve->order);
+    bn_mod(&k[0], &curve->order);
+
+    // k[1 + i] * P_i = (a * e) * (-P_i)
+    k[1 + i] = e;
+    bn_multiply(&a, &k[1 + i], &curve->order);
+    bn_mod(&k[1 + i], &curve->order);
+    bn_subtract(&curve->prime, &p[1 + i].y, &p[1 + i].y);
+
+    // k[1 + count + i] * R_i = a * (-R_i)
+    k[1 + count + i] = a;
+    bn_subtract(&curve->prime, &p[1 + count + i].y, &p[1 + count + i].y);
+  }
+
+  if (point_multiply_multi(curve, 1 + 2 * count, k, p, &res) != 0) {
+    return 1;
+  }
+
+  return point_is_infinity(&res) ? 0 : 1;
+}
+
+// BIP340 Schnorr batch signature verification
+// public_keys[i] has 32 bytes, signatures[i] has 64 bytes and digests[i] has
+// 32 bytes for 0 <= i < count
+// Up to BIP340_VERIFY_BATCH_SIZE signatures at a time are checked by a single
+// multi-scalar multiplication. If a batch fails, its signatures are verified
+// one by one to find the invalid one.
+// returns 0 if all the signatures are valid, otherwise the error code of
+// zkp_bip340_verify_digest for the first invalid signature, whose index is
+// stored in bad_index unless it is NULL
+int zkp_bip340_verify_batch(size_t count, const uint8_t *const *public_keys,
+                            const uint8_t *const *signatures,
+                            const uint8_t *const *digests, size_t *bad_index) {
+  for (size_t i = 0; i < count; i += BIP340_VERIFY_BATCH_SIZE) {
+    size_t n = count - i;
+    if (n > BIP340_VERIFY_BATCH_SIZE) {
+      n = BIP340_VERIFY_BATCH_SIZE;
+    }
+    if (bip340_verify_chunk(n, public_keys + i, signatures + i, digests + i) ==
+        0) {
+      continue;
+    }
+    for (size_t j = i; j < i + n; j++) {
+      int result =
+          zkp_bip340_verify_digest(public_keys[j], signatures[j], digests[j]);
+      if (result != 0) {
+        if (bad_index != NULL) {
+          *bad_index = j;
+        }
+        return result;
+      }
+    }
+  }
+
+  return 0;
+}
+
 // BIP340 Schnorr public key tweak
 // internal_public_key has 32 bytes
 // root_hash has 32 bytes or is empty (NULL)
@@ -287,11 +401,6 @@ int zkp_bip340_tweak_private_key(const uint8_t *internal_private_key,
       result = -1;
     }
   }
-  if (result == 0) {
-    if (secp256k1_context_writable_randomize(context_writable) != 0) {
-      result = -1;
-    }
-  }
 
   secp256k1_keypair keypair = {0};
   if (result == 0) {
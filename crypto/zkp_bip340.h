@@ -1,6 +1,7 @@
 #ifndef __ZKP_BIP340_H__
 #define __ZKP_BIP340_H__
 
+#include <stddef.h>
 #include <stdint.h>
 
 int zkp_bip340_get_public_key(const uint8_t *private_key_bytes,
@@ -11,6 +12,9 @@ int zkp_bip340_sign_digest(const uint8_t *private_key_bytes,
 int zkp_bip340_verify_digest(const uint8_t *public_key_bytes,
                              const uint8_t *signature_bytes,
                              const uint8_t *digest);
+int zkp_bip340_verify_batch(size_t count, const uint8_t *const *public_keys,
+                            const uint8_t *const *signatures,
+                            const uint8_t *const *digests, size_t *bad_index);
 int zkp_bip340_verify_publickey(const uint8_t *public_key_bytes);
 int zkp_bip340_tweak_public_key(const uint8_t *internal_public_key,
                                 const uint8_t *root_hash,
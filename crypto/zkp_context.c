@@ -33,6 +33,8 @@
 static uint8_t context_buffer[SECP256K1_CONTEXT_SIZE];
 static secp256k1_context *context;
 static volatile atomic_flag locked;
+// true iff the context has been randomized since it was last acquired writable
+static volatile bool randomized;
 
 // returns 0 on success
 int secp256k1_context_writable_randomize(secp256k1_context *context_writable) {
@@ -75,6 +77,7 @@ int zkp_context_init(void) {
     zkp_context_destroy();
     return 1;
   }
+  randomized = true;
 
   atomic_flag_clear(&locked);
 
@@ -87,6 +90,7 @@ void zkp_context_destroy(void) {
   secp256k1_context_preallocated_destroy(context);
   memzero(context_buffer, sizeof(context_buffer));
   atomic_flag_clear(&locked);
+  randomized = false;
   context = NULL;
 }
 
@@ -96,6 +100,8 @@ const secp256k1_context *zkp_context_get_read_only(void) {
   return context;
 }
 
+// The returned context is randomized, either in advance by
+// zkp_context_refresh or here if it was not refreshed since its last use
 // returns NULL if context cannot be acquired
 secp256k1_context *zkp_context_acquire_writable(void) {
   assert(context != NULL);
@@ -105,6 +111,12 @@ secp256k1_context *zkp_context_acquire_writable(void) {
     return NULL;
   }
 
+  if (!randomized && secp256k1_context_writable_randomize(context) != 0) {
+    atomic_flag_clear(&locked);
+    return NULL;
+  }
+  randomized = false;
+
   return context;
 }
 
@@ -113,3 +125,26 @@ void zkp_context_release_writable(void) {
 
   atomic_flag_clear(&locked);
 }
+
+// Randomizes the context if it was acquired writable since the last
+// randomization, so that the next zkp_context_acquire_writable doesn't have to.
+// Meant to be called when the device is idle.
+// returns 0 on success
+int zkp_context_refresh(void) {
+  if (context == NULL || randomized) {
+    return 0;
+  }
+
+  if (atomic_flag_test_and_set(&locked)) {
+    return 1;
+  }
+
+  int result = secp256k1_context_writable_randomize(context);
+  if (result == 0) {
+    randomized = true;
+  }
+
+  atomic_flag_clear(&locked);
+
+  return result;
+}
@@ -12,5 +12,6 @@ void zkp_context_destroy(void);
 const secp256k1_context *zkp_context_get_read_only(void);
 secp256k1_context *zkp_context_acquire_writable(void);
 void zkp_context_release_writable(void);
+int zkp_context_refresh(void);
 
 #endif
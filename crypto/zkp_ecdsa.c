@@ -74,11 +74,6 @@ int zkp_ecdsa_get_public_key33(const ecdsa_curve *curve,
       result = 1;
     }
   }
-  if (result == 0) {
-    if (secp256k1_context_writable_randomize(context_writable) != 0) {
-      result = 1;
-    }
-  }
 
   secp256k1_pubkey public_key = {0};
   if (result == 0) {
@@ -131,11 +126,6 @@ int zkp_ecdsa_get_public_key65(const ecdsa_curve *curve,
       result = 1;
     }
   }
-  if (result == 0) {
-    if (secp256k1_context_writable_randomize(context_writable) != 0) {
-      result = 1;
-    }
-  }
 
   secp256k1_pubkey public_key = {0};
   if (result == 0) {
@@ -209,7 +199,9 @@ int zkp_ecdsa_sign_digest(
       result = 1;
     }
 
-    if (result == 0) {
+    if (result == 0 && retry_count != 0) {
+      // zkp_context_acquire_writable randomizes the context for the first
+      // attempt
       if (secp256k1_context_writable_randomize(context_writable) != 0) {
         result = 1;
       }
@@ -454,10 +446,6 @@ int zkp_ecdh_multiply(const ecdsa_curve *curve,
     result = 3;
     goto end;
   }
-  if (secp256k1_context_writable_randomize(context_writable) != 0) {
-    result = 3;
-    goto end;
-  }
 
   if (secp256k1_ecdh(context_writable, session_key, &public_key,
                      private_key_bytes, plain_hash_function, NULL) != 1) {
@@ -510,10 +498,6 @@ ecdsa_tweak_pubkey_result zkp_ecdsa_tweak_pubkey(
     result = ECDSA_TWEAK_PUBKEY_CONTEXT_ERR;
     goto end;
   }
-  if (secp256k1_context_writable_randomize(context_writable) != 0) {
-    result = ECDSA_TWEAK_PUBKEY_CONTEXT_ERR;
-    goto end;
-  }
 
   if (secp256k1_ec_pubkey_tweak_add(context_writable, &public_key,
                                     tweak_bytes) != 1) {
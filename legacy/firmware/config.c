@@ -439,6 +439,13 @@ void session_clearCache(Session *session) {
 void config_lockDevice(void) {
   fsm_abortWorkflows();
   storage_lock();
+  // the caches hold secrets derived from the seed
+#if USE_BIP32_CACHE
+  bip32_cache_clear();
+#endif
+#if USE_BIP39_CACHE
+  bip39_cache_clear();
+#endif
 }
 
 static void get_u2froot_callback(uint32_t iter, uint32_t total) {
@@ -1,4 +1,4 @@
-<% networks = list(supported_on("T1B1", eth)) %>\
+<% networks = sorted(supported_on("T1B1", eth), key=lambda n: n.chain_id) %>\
 // This file is automatically generated from ethereum_networks.c.mako
 // DO NOT EDIT
 
@@ -7,6 +7,7 @@
 
 #define NETWORKS_COUNT ${len(networks)}
 
+// sorted by chain_id for the binary search below
 static const EthereumNetworkInfo networks[NETWORKS_COUNT] = {
 % for n in networks:
   {
@@ -26,9 +27,16 @@ const EthereumNetworkInfo UNKNOWN_NETWORK = {
 };
 
 const EthereumNetworkInfo *ethereum_get_network_by_chain_id(uint64_t chain_id) {
-  for (size_t i = 0; i < NETWORKS_COUNT; i++) {
-    if (networks[i].chain_id == chain_id) {
-      return &networks[i];
+  size_t lo = 0, hi = NETWORKS_COUNT;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (networks[mid].chain_id == chain_id) {
+      return &networks[mid];
+    }
+    if (chain_id < networks[mid].chain_id) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
     }
   }
   return &UNKNOWN_NETWORK;
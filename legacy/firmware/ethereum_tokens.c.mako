@@ -8,8 +8,9 @@
 <% erc20_list = list(supported_on("T1B1", erc20)) %>\
 #define TOKENS_COUNT ${len(erc20_list)}
 
+// sorted by chain_id and address for the binary search below
 static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
-% for t in sorted(erc20_list, key=lambda token: (token.chain_id, token.name)):
+% for t in sorted(erc20_list, key=lambda token: (token.chain_id, token.address_bytes)):
   {
     .symbol = "${ascii(t.symbol)}",
     .decimals = ${t.decimals},
@@ -38,9 +39,22 @@ const EthereumTokenInfo UNKNOWN_TOKEN = {
 const EthereumTokenInfo *ethereum_token_by_address(uint64_t chain_id, const uint8_t *address)
 {
   if (!address) return 0;
-  for (int i = 0; i < TOKENS_COUNT; i++) {
-    if (chain_id == tokens[i].chain_id && memcmp(address, tokens[i].address.bytes, sizeof(tokens[i].address.bytes)) == 0) {
-      return &(tokens[i]);
+  int lo = 0, hi = TOKENS_COUNT;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    int cmp = 0;
+    if (chain_id != tokens[mid].chain_id) {
+      cmp = chain_id < tokens[mid].chain_id ? -1 : 1;
+    } else {
+      cmp = memcmp(address, tokens[mid].address.bytes, sizeof(tokens[mid].address.bytes));
+    }
+    if (cmp == 0) {
+      return &(tokens[mid]);
+    }
+    if (cmp < 0) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
     }
   }
   return &UNKNOWN_TOKEN;
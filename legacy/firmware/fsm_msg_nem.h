@@ -220,11 +220,8 @@ void fsm_msgNEMSignTx(NEMSignTx *msg) {
                         sizeof(resp->data.bytes));
 
   if (msg->has_multisig) {
-    uint8_t buffer[sizeof(resp->data.bytes)];
-
     nem_transaction_ctx inner;
-    nem_transaction_start(&inner, msg->multisig.signer.bytes, buffer,
-                          sizeof(buffer));
+    nem_transaction_start_inner(&inner, &context, msg->multisig.signer.bytes);
 
     if (msg->has_transfer &&
         !nem_fsmTransfer(&inner, NULL, &msg->multisig, &msg->transfer)) {
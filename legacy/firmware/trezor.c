@@ -198,6 +198,10 @@ int main(void) {
 #endif
     check_lock_screen();
     check_busy_screen();
+#ifdef USE_SECP256K1_ZKP
+    // re-randomize the context off the critical path of the next signing
+    zkp_context_refresh();
+#endif
   }
 
   return 0;
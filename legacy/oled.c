@@ -43,6 +43,8 @@
 #define OLED_SETHIGHCOLUMN 0x10
 #define OLED_SETSTARTLINE 0x40
 #define OLED_MEMORYMODE 0x20
+#define OLED_SETCOLUMNADDR 0x21
+#define OLED_SETPAGEADDR 0x22
 #define OLED_COMSCANINC 0xC0
 #define OLED_COMSCANDEC 0xC8
 #define OLED_SEGREMAP 0xA0
@@ -66,6 +68,15 @@
 
 static uint8_t _oledbuffer[OLED_BUFSIZE];
 
+#if !EMULATOR
+/*
+ * Copy of the display RAM, oledRefresh sends only the pages (8 rows) which
+ * differ from it.
+ */
+static uint8_t _oledshadow[OLED_BUFSIZE];
+static bool _oledshadow_valid = false;
+#endif
+
 /*
  * macros to convert coordinate to bit position
  */
@@ -169,6 +180,7 @@ void oledInit() {
   SPISend(SPI_BASE, s, 25);
   gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
 
+  _oledshadow_valid = false;
   oledClear();
   oledRefresh();
 }
@@ -207,22 +219,48 @@ void oledInvertDebugLink(void) {
  */
 #if !EMULATOR
 void oledRefresh() {
-  static const uint8_t s[3] = {OLED_SETLOWCOLUMN | 0x00,
-                               OLED_SETHIGHCOLUMN | 0x00,
-                               OLED_SETSTARTLINE | 0x00};
-
   // draw triangle in upper right corner
   oledInvertDebugLink();
 
-  gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
-  SPISend(SPI_BASE, s, 3);
-  gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
+  bool sent = false;
+  for (int page = 0; page < OLED_HEIGHT / 8; page++) {
+    const uint8_t *data = &_oledbuffer[page * OLED_WIDTH];
+    uint8_t *shadow = &_oledshadow[page * OLED_WIDTH];
 
-  gpio_set(OLED_DC_PORT, OLED_DC_PIN);    // set to DATA
-  gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
-  SPISend(SPI_BASE, _oledbuffer, sizeof(_oledbuffer));
-  gpio_set(OLED_CS_PORT, OLED_CS_PIN);    // SPI deselect
-  gpio_clear(OLED_DC_PORT, OLED_DC_PIN);  // set to CMD
+    if (_oledshadow_valid && memcmp(data, shadow, OLED_WIDTH) == 0) {
+      continue;
+    }
+
+    // limit the display RAM window to the page
+    const uint8_t s[6] = {OLED_SETCOLUMNADDR, 0, OLED_WIDTH - 1,
+                          OLED_SETPAGEADDR,   page, page};
+
+    gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
+    SPISend(SPI_BASE, s, 6);
+    gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
+
+    gpio_set(OLED_DC_PORT, OLED_DC_PIN);    // set to DATA
+    gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
+    SPISend(SPI_BASE, data, OLED_WIDTH);
+    gpio_set(OLED_CS_PORT, OLED_CS_PIN);    // SPI deselect
+    gpio_clear(OLED_DC_PORT, OLED_DC_PIN);  // set to CMD
+
+    memcpy(shadow, data, OLED_WIDTH);
+    sent = true;
+  }
+  _oledshadow_valid = true;
+
+  if (sent) {
+    // restore the full screen window, the firmware may still send the whole
+    // buffer at once
+    static const uint8_t s[7] = {
+        OLED_SETCOLUMNADDR,  0, OLED_WIDTH - 1, OLED_SETPAGEADDR, 0,
+        OLED_HEIGHT / 8 - 1, OLED_SETSTARTLINE | 0x00};
+
+    gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
+    SPISend(SPI_BASE, s, 7);
+    gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
+  }
 
   // return it back
   oledInvertDebugLink();
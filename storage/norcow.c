@@ -60,6 +60,21 @@ static uint32_t norcow_free_offset = 0;
 // Tracks how much data was already flashed in update_bytes function
 static uint16_t norcow_write_buffer_flashed = 0;
 
+#if NORCOW_INDEX_SIZE
+// The offsets of the items in the writing sector sorted by their keys, which
+// find_item looks up instead of scanning the sector. The index is not used
+// when the sector holds more keys than NORCOW_INDEX_SIZE or when some key is
+// stored more than once, which only the version 0 format allowed.
+typedef struct {
+  uint16_t key;
+  uint32_t offset;
+} norcow_index_entry;
+
+static norcow_index_entry norcow_index[NORCOW_INDEX_SIZE];
+static uint32_t norcow_index_count = 0;
+static secbool norcow_index_valid = secfalse;
+#endif
+
 static const void *norcow_ptr(uint8_t sector, uint32_t offset, uint32_t size);
 static secbool find_item(uint8_t sector, uint16_t key, const void **val,
                          uint16_t *len);
@@ -79,6 +94,47 @@ static const void *norcow_ptr(uint8_t sector, uint32_t offset, uint32_t size) {
   return flash_area_get_address(&STORAGE_AREAS[sector], offset, size);
 }
 
+/*
+ * Sets the magic and the version of an erased sector
+ */
+static void write_magic(uint8_t sector) {
+  ensure(flash_unlock_write(), NULL);
+#if FLASH_BLOCK_WORDS == 1
+  flash_block_t block_magic = {NORCOW_MAGIC};
+  ensure(flash_area_write_block(&STORAGE_AREAS[sector], NORCOW_HEADER_LEN,
+                                block_magic),
+         NULL);
+  flash_block_t block_version = {~NORCOW_VERSION};
+  ensure(flash_area_write_block(&STORAGE_AREAS[sector],
+                                NORCOW_HEADER_LEN + NORCOW_MAGIC_LEN,
+                                block_version),
+         "set version failed");
+#else
+  flash_block_t block = {NORCOW_MAGIC, ~NORCOW_VERSION};
+  ensure(flash_area_write_block(&STORAGE_AREAS[sector], NORCOW_HEADER_LEN,
+                                block),
+         "set magic and version failed");
+#endif
+  ensure(flash_lock_write(), NULL);
+}
+
+/*
+ * Checks whether the sector is erased, not counting its header
+ */
+static secbool sector_is_erased(uint8_t sector) {
+  const uint32_t size = NORCOW_SECTOR_SIZE - NORCOW_HEADER_LEN;
+  const uint32_t *words = norcow_ptr(sector, NORCOW_HEADER_LEN, size);
+  if (words == NULL) {
+    return secfalse;
+  }
+  for (uint32_t i = 0; i < size / sizeof(uint32_t); i++) {
+    if (words[i] != 0xFFFFFFFF) {
+      return secfalse;
+    }
+  }
+  return sectrue;
+}
+
 /*
  * Erases sector (and sets a magic)
  */
@@ -104,24 +160,7 @@ static void erase_sector(uint8_t sector, secbool set_magic) {
 #endif
 
   if (sectrue == set_magic) {
-    ensure(flash_unlock_write(), NULL);
-#if FLASH_BLOCK_WORDS == 1
-    flash_block_t block_magic = {NORCOW_MAGIC};
-    ensure(flash_area_write_block(&STORAGE_AREAS[sector], NORCOW_HEADER_LEN,
-                                  block_magic),
-           NULL);
-    flash_block_t block_version = {~NORCOW_VERSION};
-    ensure(flash_area_write_block(&STORAGE_AREAS[sector],
-                                  NORCOW_HEADER_LEN + NORCOW_MAGIC_LEN,
-                                  block_version),
-           "set version failed");
-#else
-    flash_block_t block = {NORCOW_MAGIC, ~NORCOW_VERSION};
-    ensure(flash_area_write_block(&STORAGE_AREAS[sector], NORCOW_HEADER_LEN,
-                                  block),
-           "set magic and version failed");
-#endif
-    ensure(flash_lock_write(), NULL);
+    write_magic(sector);
   }
 }
 
@@ -149,6 +188,96 @@ static secbool find_start_offset(uint8_t sector, uint32_t *offset,
   return sectrue;
 }
 
+#if NORCOW_INDEX_SIZE
+/*
+ * Returns the position of the given key in the index or the position where it
+ * would be inserted
+ */
+static uint32_t index_search(uint16_t key) {
+  uint32_t lo = 0, hi = norcow_index_count;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (norcow_index[mid].key < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+/*
+ * Records that the item with the given key starts at offset, returns secfalse
+ * if the key was already in the index
+ */
+static secbool index_put(uint16_t key, uint32_t offset) {
+  if (sectrue != norcow_index_valid) {
+    return sectrue;
+  }
+
+  uint32_t i = index_search(key);
+  if (i < norcow_index_count && norcow_index[i].key == key) {
+    norcow_index[i].offset = offset;
+    return secfalse;
+  }
+
+  if (norcow_index_count >= NORCOW_INDEX_SIZE) {
+    // Too many keys, fall back to scanning the sector.
+    norcow_index_valid = secfalse;
+    return sectrue;
+  }
+
+  memmove(&norcow_index[i + 1], &norcow_index[i],
+          (norcow_index_count - i) * sizeof(norcow_index[0]));
+  norcow_index[i].key = key;
+  norcow_index[i].offset = offset;
+  norcow_index_count++;
+  return sectrue;
+}
+
+static void index_remove(uint16_t key) {
+  if (sectrue != norcow_index_valid) {
+    return;
+  }
+
+  uint32_t i = index_search(key);
+  if (i < norcow_index_count && norcow_index[i].key == key) {
+    norcow_index_count--;
+    memmove(&norcow_index[i], &norcow_index[i + 1],
+            (norcow_index_count - i) * sizeof(norcow_index[0]));
+  }
+}
+
+/*
+ * Builds the index of the writing sector
+ */
+static void index_build(void) {
+  norcow_index_count = 0;
+  norcow_index_valid = sectrue;
+
+  uint32_t offset = 0;
+  uint32_t version = 0;
+  if (sectrue != find_start_offset(norcow_write_sector, &offset, &version)) {
+    norcow_index_valid = secfalse;
+    return;
+  }
+
+  while (sectrue == norcow_index_valid) {
+    uint16_t k = 0, l = 0;
+    const void *v = NULL;
+    uint32_t pos = 0;
+    if (sectrue != read_item(norcow_write_sector, offset, &k, &v, &l, &pos)) {
+      break;
+    }
+    if (k != NORCOW_KEY_DELETED && sectrue != index_put(k, offset)) {
+      // The key is stored more than once and the last item wins.
+      norcow_index_valid = secfalse;
+    }
+    offset = pos;
+  }
+}
+#endif
+
 /*
  * Finds item in given sector
  */
@@ -157,6 +286,26 @@ static secbool find_item(uint8_t sector, uint16_t key, const void **val,
   *val = NULL;
   *len = 0;
 
+#if NORCOW_INDEX_SIZE
+  if (sector == norcow_write_sector && sectrue == norcow_index_valid &&
+      key != NORCOW_KEY_DELETED) {
+    uint32_t i = index_search(key);
+    if (i >= norcow_index_count || norcow_index[i].key != key) {
+      return secfalse;
+    }
+    uint16_t k = 0;
+    uint32_t pos = 0;
+    if (sectrue == read_item(sector, norcow_index[i].offset, &k, val, len,
+                             &pos) &&
+        k == key) {
+      return sectrue;
+    }
+    // The item is not complete yet, let the scan decide.
+    *val = NULL;
+    *len = 0;
+  }
+#endif
+
   uint32_t offset = 0;
   uint32_t version = 0;
   if (sectrue != find_start_offset(sector, &offset, &version)) {
@@ -212,7 +361,13 @@ static void compact(void) {
   }
 
   norcow_write_sector = (norcow_active_sector + 1) % NORCOW_SECTOR_COUNT;
-  erase_sector(norcow_write_sector, sectrue);
+  // The previous compaction leaves the other sector erased, so that usually
+  // only the active sector has to be erased here.
+  if (sectrue == sector_is_erased(norcow_write_sector)) {
+    write_magic(norcow_write_sector);
+  } else {
+    erase_sector(norcow_write_sector, sectrue);
+  }
   uint32_t offsetw = NORCOW_STORAGE_START;
 
   for (;;) {
@@ -242,6 +397,9 @@ static void compact(void) {
   norcow_active_sector = norcow_write_sector;
   norcow_active_version = NORCOW_VERSION;
   norcow_free_offset = find_free_offset(norcow_write_sector);
+#if NORCOW_INDEX_SIZE
+  index_build();
+#endif
 }
 
 /*
@@ -275,6 +433,9 @@ void norcow_init(uint32_t *norcow_version) {
     norcow_write_sector = norcow_active_sector;
     norcow_free_offset = find_free_offset(norcow_write_sector);
   }
+#if NORCOW_INDEX_SIZE
+  index_build();
+#endif
 }
 
 /*
@@ -296,6 +457,10 @@ void norcow_wipe(void) {
   norcow_active_version = NORCOW_VERSION;
   norcow_write_sector = norcow_active_sector;
   norcow_free_offset = NORCOW_STORAGE_START;
+#if NORCOW_INDEX_SIZE
+  norcow_index_count = 0;
+  norcow_index_valid = sectrue;
+#endif
 }
 
 /*
@@ -392,6 +557,9 @@ secbool norcow_set_ex(uint16_t key, const void *val, uint16_t len,
   // Delete the old item.
   if (sectrue == *found) {
     norcow_delete_item(area, len_old, val_offset);
+#if NORCOW_INDEX_SIZE
+    index_remove(key);
+#endif
   }
 
   // Check whether there is enough free space and compact if full.
@@ -406,6 +574,9 @@ secbool norcow_set_ex(uint16_t key, const void *val, uint16_t len,
                             len, &pos)) {
     return secfalse;
   }
+#if NORCOW_INDEX_SIZE
+  index_put(key, norcow_free_offset);
+#endif
 
   norcow_free_offset = pos;
   return sectrue;
@@ -432,6 +603,9 @@ secbool norcow_delete(uint16_t key) {
       (const uint8_t *)norcow_ptr(norcow_write_sector, 0, NORCOW_SECTOR_SIZE);
 
   norcow_delete_item(area, len, val_offset);
+#if NORCOW_INDEX_SIZE
+  index_remove(key);
+#endif
 
   return sectrue;
 }
@@ -29,6 +29,14 @@
 
 #include "norcow_config.h"
 
+/*
+ * Maximal number of keys of the in-memory index of the writing sector, which
+ * costs 8 bytes of RAM per key, 0 disables the index
+ */
+#ifndef NORCOW_INDEX_SIZE
+#define NORCOW_INDEX_SIZE 0
+#endif
+
 /*
  * Initialize storage
  */
@@ -19,7 +19,9 @@
 
 #include "flash_area.h"
 
-#define COUNTER_TAIL_WORDS 2
+// Every counter item has a tally of 32 * COUNTER_TAIL_WORDS increments, after
+// which norcow_next_counter writes a new item.
+#define COUNTER_TAIL_WORDS 8
 #define NORCOW_MAX_PREFIX_LEN (NORCOW_KEY_LEN + NORCOW_LEN_LEN)
 
 static secbool write_item(uint8_t sector, uint32_t offset, uint16_t key,
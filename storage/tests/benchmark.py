@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Measures the latency of the storage operations of the C implementation and the
+flash usage of norcow on the mocked flash, for both flash layouts and several
+numbers of keys. The times include the ctypes call overhead and are only
+meaningful relative to each other, e.g. before and after a change to norcow.
+
+Usage: ./benchmark.py [key count ...]
+"""
+
+import statistics
+import sys
+import time
+
+from c.storage import Storage
+
+LIBS = ["libtrezor-storage.so", "libtrezor-storage-qw.so"]
+
+# Unique device ID for testing.
+uid = b"\x67\xce\x6a\xe8\xf7\x9b\x73\x96\x83\x88\x21\x5e"
+
+# Protected keys of one app, the values are encrypted.
+APP = 0x01
+VALUE = bytes(range(32))
+
+# Number of compactions caused by overwriting the keys.
+COMPACTIONS = 3
+
+
+def timed(f, *args) -> float:
+    start = time.perf_counter()
+    f(*args)
+    return (time.perf_counter() - start) * 1e6
+
+
+def bench(lib_name: str, key_count: int) -> None:
+    s = Storage(lib_name)
+    s.init(uid)
+    s.unlock("")
+    keys = [(APP << 8) | i for i in range(key_count)]
+
+    set_new = [timed(s.set, key, VALUE) for key in keys]
+    get = [timed(s.get, key) for key in keys for _ in range(4)]
+    s.lock()
+    unlock = [timed(s.unlock, "") for _ in range(2)]
+
+    # Overwrite the keys round robin until the sector was compacted a few
+    # times, a compaction is a set with sector erasures.
+    set_old, compact = [], []
+    erases, written = s._get_flash_stats()
+    i = 0
+    while len(compact) < COMPACTIONS:
+        before = s._get_flash_stats()[0]
+        t = timed(s.set, keys[i % key_count], VALUE)
+        (compact if s._get_flash_stats()[0] != before else set_old).append(t)
+        i += 1
+    erases_now, written_now = s._get_flash_stats()
+
+    s.wipe()
+    print(
+        f"{lib_name:26} {key_count:5} "
+        f"{statistics.median(get):8.1f} {statistics.median(set_new):8.1f} "
+        f"{statistics.median(set_old):8.1f} {statistics.median(unlock):10.1f} "
+        f"{statistics.median(compact):10.1f} {(written_now - written) / i:8.1f} "
+        f"{i / (erases_now - erases):10.1f}"
+    )
+
+
+def main() -> None:
+    key_counts = [int(arg) for arg in sys.argv[1:]] or [16, 64, 192]
+    print("times are medians in us, flash usage per overwrite of a key")
+    print(
+        f"{'library':26} {'keys':>5} {'get':>8} {'set new':>8} {'set old':>8} "
+        f"{'unlock':>10} {'compact':>10} {'bytes':>8} {'sets/erase':>10}"
+    )
+    for lib_name in LIBS:
+        for key_count in key_counts:
+            bench(lib_name, key_count)
+
+
+if __name__ == "__main__":
+    main()
@@ -59,6 +59,11 @@ static const uint32_t FLASH_SECTOR_TABLE[FLASH_SECTOR_COUNT + 1] = {
 const uint32_t FLASH_SIZE = FLASH_END - FLASH_START;
 uint8_t *FLASH_BUFFER = NULL;
 
+// Statistics for benchmark.py, the number of erased sectors and the number of
+// programmed bytes.
+uint32_t FLASH_ERASE_COUNT = 0;
+uint32_t FLASH_WRITE_COUNT = 0;
+
 secbool flash_unlock_write(void) { return sectrue; }
 
 secbool flash_lock_write(void) { return sectrue; }
@@ -108,6 +113,7 @@ secbool flash_sector_erase(uint16_t sector) {
   const uint32_t size =
       FLASH_SECTOR_TABLE[sector + 1] - FLASH_SECTOR_TABLE[sector];
   memset(FLASH_BUFFER + offset, 0xFF, size);
+  FLASH_ERASE_COUNT++;
   return sectrue;
 }
 
@@ -132,6 +138,7 @@ static secbool flash_write(uint16_t sector, uint32_t offset,
   }
 
   memcpy(flash, data, data_size);
+  FLASH_WRITE_COUNT += data_size;
 
   return sectrue;
 }
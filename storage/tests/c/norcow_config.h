@@ -25,6 +25,7 @@
 
 #define NORCOW_SECTOR_COUNT 2
 #define NORCOW_SECTOR_SIZE (64 * 1024)
+#define NORCOW_INDEX_SIZE 256
 
 /*
  * The length of the sector header in bytes. The header is preserved between
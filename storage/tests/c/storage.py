@@ -108,6 +108,13 @@ class Storage:
             raise RuntimeError("Failed to set flash buffer due to length mismatch.")
         self.flash_buffer.value = buf
 
+    def _get_flash_stats(self) -> (int, int):
+        # number of erased sectors and of programmed bytes since the library was loaded
+        return (
+            c.c_uint32.in_dll(self.lib, "FLASH_ERASE_COUNT").value,
+            c.c_uint32.in_dll(self.lib, "FLASH_WRITE_COUNT").value,
+        )
+
     def _get_active_sector(self) -> int:
         if self._dump()[0][:8].hex() == consts.NORCOW_MAGIC_AND_VERSION.hex():
             return 0
@@ -69,9 +69,8 @@ WIPE_CODE_TAG_SIZE = 8
 # special handling when both the PIN and wipe code are not set.
 WIPE_CODE_EMPTY = "\0\0\0\0"
 
-# Size of counter. 4B integer and 8B tail.
-COUNTER_TAIL_SIZE = 8
-COUNTER_MAX_TAIL = 64
+# Size of counter. 4B integer and 32B tail.
+COUNTER_TAIL_SIZE = 32
 
 # ----- PIN logs ----- #
 
@@ -170,20 +170,21 @@ class Storage:
 
         if self.nc.is_byte_access():
             base = int.from_bytes(current[:4], sys.byteorder)
+            # Counters written by older versions may have a shorter tail.
+            tail_size = len(current) - 4
             tail = helpers.to_int_by_words(current[4:])
-            tail_count = f"{tail:064b}".count("0")
+            tail_count = f"{tail:0{tail_size * 8}b}".count("0")
             increased_count = base + tail_count + 1
             if increased_count > consts.UINT32_MAX:
                 raise RuntimeError("Failed to set value in storage.")
 
-            if tail_count == consts.COUNTER_MAX_TAIL:
+            if tail_count == tail_size * 8:
                 self.set_counter(key, increased_count)
                 return increased_count
 
             self.set(
                 key,
-                current[:4]
-                + helpers.to_bytes_by_words(tail >> 1, consts.COUNTER_TAIL_SIZE),
+                current[:4] + helpers.to_bytes_by_words(tail >> 1, tail_size),
             )
         else:
             increased_count = base + 1
@@ -257,7 +257,7 @@ def test_set_locked(nc_class):
 @pytest.mark.parametrize("nc_class", NC_CLASSES)
 def test_counter(nc_class):
     sc, sp = common.init(nc_class, unlock=True)
-    for i in range(0, 200):
+    for i in range(0, 600):
         for s in (sc, sp):
             assert i == s.next_counter(0xC001)
         assert common.memory_equals(sc, sp)